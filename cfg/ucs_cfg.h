@@ -49,6 +49,7 @@ extern "C"
  * is connected to one network.
  * It is possible access multiple networks by having multiple API instances. Each API instance
  * requires communication with an exclusive INIC.
+ * Further instances can be created in application provided memory by Ucs_CreateInstanceEx().
  * Valid range: 1..10. Default value: 1.
  */
 /* #define UCS_NUM_INSTANCES                1 */
@@ -74,6 +75,13 @@ extern "C"
  */
 /* #define UCS_AMS_SIZE_RX_MSG              45 */
 
+/* Defines the number of Rx message objects which are reserved for single telegram messages if 
+ * no further Rx message object can be allocated. The objects are taken from UCS_AMS_NUM_RX_MSGS.
+ * See also Ucs_AmsRx_InitData_t::is_prio_msg_fptr.
+ * Valid values: 1..(UCS_AMS_NUM_RX_MSGS - 1). Default value: 1.
+ */
+/* #define UCS_AMS_NUM_RSVD_RX_MSGS         1 */
+
 /* Defines the number of reserved Tx message objects.
  * Valid values: 5..255. Default value: 20.
  */
@@ -84,6 +92,29 @@ extern "C"
  */
 /* #define UCS_AMS_SIZE_TX_MSG              45 */
 
+/*------------------------------------------------------------------------------------------------*/
+/* Timer Management                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+/* Define the following macro to use a 32 bit tick count instead of a 16 bit tick count. If this 
+ * macro is defined the callback functions Ucs_GetTickCountCb_t and Ucs_SetAppTimerCb_t use 
+ * 32 bit values and internal timers are no longer limited to 65535 milliseconds. Timer values
+ * are limited to 2^30-1 milliseconds (about 12 days) instead.
+ */
+/* #define UCS_TICK_COUNT_32BIT */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Low-Level Driver                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+/* Define the following macro to allow the low-level driver to call the functions of Ucs_Lld_Api_t
+ * from a different thread or interrupt context. The messages are handed over to the UNICENS 
+ * thread by lock-free queues and the function request_service_fptr() is invoked from the context 
+ * of the low-level driver. Rx message objects are retrieved from a lock-free pool. Thus, 
+ * rx_allocate_fptr() and rx_free_unused_fptr() do not require any locking, but rx_allocate_fptr()
+ * must not be called from multiple threads concurrently.
+ * The macro requires a compiler which supports C11 atomics (<stdatomic.h>).
+ */
+/* #define UCS_ATOMIC_EVENTS */
+
 /*------------------------------------------------------------------------------------------------*/
 /* Memory Optimization                                                                            */
 /*------------------------------------------------------------------------------------------------*/
@@ -91,9 +122,25 @@ extern "C"
  * certain features. If this macro is defined the following changes apply:
  * - Reduction of low-level buffers
  * - AMS does not support segmentation (payload > 45 bytes)
+ * - Timer management uses a delta list instead of a timer wheel
  */
 /* #define UCS_FOOTPRINT_TINY */
 
+/* Define the following macro to speed up the internal functions Misc_MemSet() and Misc_MemCpy(),
+ * which are used if UCS_MEM_SET and UCS_MEM_CPY are not defined. Memory is processed by 32 bit 
+ * accesses after the destination is word aligned. Memory is copied bytewise if source and 
+ * destination have a different word alignment. The word accesses are declared as may-alias for 
+ * GCC and Clang. Other compilers must not apply strict aliasing optimizations to the UNICENS 
+ * sources, e.g. by an option like -fno-strict-aliasing.
+ */
+/* #define UCS_MEM_WORD_ACCESS */
+
+/* Define the following macro to omit the built-in Rx message pool of the low-level driver 
+ * interface. The application must assign the memory of the Rx pool by means of 
+ * Ucs_InitData_t::lld_rx_pool, otherwise Ucs_Init() fails.
+ */
+/* #define UCS_LLD_RX_POOL_EXTERNAL */
+
 /*------------------------------------------------------------------------------------------------*/
 /* Tracing & Debugging                                                                            */
 /*------------------------------------------------------------------------------------------------*/
@@ -107,6 +154,21 @@ extern "C"
 /* extern void App_TraceError(void *ucs_user_ptr, const char module_str[], const char entry_str[], uint16_t vargs_cnt, ...); */
 /* extern void App_TraceInfo(void *ucs_user_ptr, const char module_str[], const char entry_str[], uint16_t vargs_cnt, ...); */
 
+/* Define the following macro to enable execution profiling of the internal services. The macro 
+ * must be mapped to a user defined function which returns a free-running high-resolution time 
+ * stamp, e.g. a CPU cycle counter. The statistics can be read by Ucs_Diag_GetServiceStats().
+ * If the macro is not defined, the profiling is completely removed.
+ */
+/* #define UCS_PROF_GET_TIME    App_GetProfilingTime */
+
+/* extern uint32_t App_GetProfilingTime(void); */
+
+/* Define the following macro to cross-check every list membership test against a search of the 
+ * whole list. Mismatches are reported by UCS_TR_ERROR. The check is expensive and intended for 
+ * debugging only.
+ */
+/* #define UCS_DL_CHECK_MEMBERSHIP */
+
 #ifdef __cplusplus
 }
 #endif
@@ -138,17 +138,23 @@ extern void Ams_TxSetDefaultRetries(CAms *self, uint8_t llrbc);
 extern void Ams_TxAssignMsgFreedObs(CAms *self, CObserver *observer_ptr);
 extern void Ams_TxAssignTrcvSelector(CAms *self, Ams_TxIsRcmMsgCb_t cb_fptr);
 extern Ucs_AmsTx_Msg_t* Ams_TxGetMsg(CAms *self, uint16_t size);
+extern bool Ams_TxGetMsgBatch(CAms *self, uint8_t count, const uint16_t sizes[], Ucs_AmsTx_Msg_t *msgs[]);
 extern void Ams_TxFreeUnusedMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr);
+extern Ucs_Return_t Ams_TxSetSharedPayload(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_SharedPayload_t *payload_ptr);
 extern uint16_t Ams_TxGetMsgCnt(CAms *self);
 extern bool Ams_TxIsValidMessage(Ucs_AmsTx_Msg_t *msg_ptr);
 extern void Ams_TxSendMsgDirect(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr);
 extern Ucs_Return_t Ams_TxSendMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr, Amsg_TxCompleteSiaCb_t tx_complete_sia_fptr, 
                                   Amsg_TxCompleteCb_t tx_complete_fptr, void* tx_complete_inst_ptr);
+extern Ucs_Return_t Ams_TxSendMsgBatch(CAms *self, uint8_t count, Ucs_AmsTx_Msg_t *msgs[], 
+                                       Amsg_TxCompleteSiaCb_t tx_complete_sia_fptr, 
+                                       Amsg_TxCompleteCb_t tx_complete_fptr, void* tx_complete_inst_ptr);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Public methods / Rx                                                                            */
 /*------------------------------------------------------------------------------------------------*/
 extern void Ams_RxAssignReceiver(CAms *self, Amsg_RxCompleteCb_t cb_fptr, void *inst_ptr);
+extern void Ams_RxSetZeroCopy(CAms *self, bool enabled);
 extern void Ams_RxFreeMsg(CAms *self, Ucs_AmsRx_Msg_t *msg_ptr);
 extern void Ams_RxOnMcmTelComplete(void *self, Msg_MostTel_t *tel_ptr);
 extern void Ams_RxOnRcmTelComplete(void *self, Msg_MostTel_t *tel_ptr);
@@ -45,6 +45,7 @@
 /*------------------------------------------------------------------------------------------------*/
 #include "ucs_rules.h"
 #include "ucs_message_pb.h"
+#include "ucs_memory_pb.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -63,6 +64,25 @@ typedef enum Ucs_AmsRx_ReceiveType_
 /*------------------------------------------------------------------------------------------------*/
 /* Types                                                                                          */
 /*------------------------------------------------------------------------------------------------*/
+/*! \brief Maximum number of Tx messages which can be allocated or transmitted in one batch.
+ *  \see   Ucs_AmsTx_AllocMsgBatch(), Ucs_AmsTx_SendMsgBatch()
+ */
+#define UCS_AMSTX_MAX_BATCH_SIZE    16U
+
+/*! \brief   Transmission priority of an application message
+ *  \details Messages of a higher priority overtake waiting messages of a lower
+ *           priority in the port message FIFO. Messages of the same priority keep
+ *           their order. A high priority message may still wait for lower priority
+ *           messages which are already transmitted or queued for segmentation.
+ */
+typedef enum Ucs_AmsTx_Priority_
+{
+    UCS_AMSTX_PRIO_NORMAL       = 0U,           /*!< \brief Default priority */
+    UCS_AMSTX_PRIO_HIGH         = 1U,           /*!< \brief Priority for control messages */
+    UCS_AMSTX_PRIO_LOW          = 2U            /*!< \brief Priority for bulk transfers */
+
+} Ucs_AmsTx_Priority_t;
+
 /*! \brief Application message Tx type */
 typedef struct Ucs_AmsTx_Msg_
 {
@@ -81,6 +101,9 @@ typedef struct Ucs_AmsTx_Msg_
                                                  *            by the UNICENS library with \c NULL and will not alter until the 
                                                  *            transmission has finished.
                                                  */
+    Ucs_AmsTx_Priority_t priority;              /*!< \brief   Transmission priority
+                                                 *   \details Default value: \ref UCS_AMSTX_PRIO_NORMAL.
+                                                 */
 } Ucs_AmsTx_Msg_t;
 
 /*! \brief Application message Rx type */
@@ -92,9 +115,48 @@ typedef struct Ucs_AmsRx_Msg_
     uint16_t        data_size;                  /*!< \brief Payload size in bytes */
     void           *custom_info_ptr;            /*!< \brief Customer specific reference */
     Ucs_AmsRx_ReceiveType_t receive_type;       /*!< \brief Defines which address type was used by the transmitter of this message */
+    Ucs_Mem_Buffer_t *segments_ptr;             /*!< \brief Reference to the payload as chain of received segments or \c NULL
+                                                 *   \details The chain is only used for segmented messages if 
+                                                 *            \ref Ucs_AmsRx_InitData_t::zero_copy_segments "zero_copy_segments" 
+                                                 *            is enabled. In this case \c data_ptr is \c NULL and 
+                                                 *            \c data_size is the sum of all segment sizes. The last 
+                                                 *            segment may contain the copied payload of several 
+                                                 *            telegrams. The segments are valid until the message is 
+                                                 *            released.
+                                                 */
 
 } Ucs_AmsRx_Msg_t;
 
+/* necessary forward declaration */
+struct Ucs_AmsTx_SharedPayload_;
+
+/*! \brief  Callback function type which is invoked as soon as the last Tx message
+ *          referring to a shared payload has finished its transmission.
+ *  \param  payload_ptr  Reference to the shared payload which is no longer used by UNICENS
+ *  \param  user_ptr     User reference provided in \ref Ucs_InitData_t "Ucs_InitData_t::user_ptr"
+ */
+typedef void (*Ucs_AmsTx_PayloadReleasedCb_t)(struct Ucs_AmsTx_SharedPayload_ *payload_ptr, void *user_ptr);
+
+/*! \brief   Application owned Tx payload which can be shared by multiple Tx messages
+ *  \details The payload is provided as chain of memory buffers and is transmitted
+ *           without copying it to the Tx message object. See Ucs_AmsTx_SetSharedPayload().
+ */
+typedef struct Ucs_AmsTx_SharedPayload_
+{
+    Ucs_Mem_Buffer_t *buffer_ptr;               /*!< \brief   Reference to the first memory buffer of the payload chain
+                                                 *   \details The chain is walked by means of Ucs_Mem_Buffer_t::next_buffer_ptr
+                                                 *            and Ucs_Mem_Buffer_t::data_size. A segment which is located
+                                                 *            in two memory buffers is copied to the telegram. Therefore, 
+                                                 *            memory buffers of a multiple of 44 bytes avoid any copy.
+                                                 */
+    Ucs_AmsTx_PayloadReleasedCb_t released_fptr;/*!< \brief   Callback function which is invoked when the payload is released */
+    void             *custom_info_ptr;          /*!< \brief   Customer specific reference */
+    uint16_t          ref_cnt;                  /*!< \brief   Number of Tx messages which are referring to the payload
+                                                 *   \details The value is managed by UNICENS and must be initialized 
+                                                 *            with \c 0 by the application.
+                                                 */
+} Ucs_AmsTx_SharedPayload_t;
+
 /*! \brief Transmission result of an application message */
 typedef enum Ucs_AmsTx_Result_
 {
@@ -211,6 +273,15 @@ typedef void (*Ucs_AmsTx_MsgFreedCb_t)(void *user_ptr);
  */
 typedef void (*Ucs_AmsRx_MsgReceivedCb_t)(void *user_ptr);
 
+/*! \brief  Callback function type that is invoked to check if a received single telegram message
+ *          has a high priority and is allowed to use all reserved Rx message objects.
+ *  \param  source_address  Source address of the received message
+ *  \param  msg_id          16bit message descriptor of the received message
+ *  \param  user_ptr        User reference provided in \ref Ucs_InitData_t "Ucs_InitData_t::user_ptr"
+ *  \return Returns \c true if the message has a high priority, otherwise \c false.
+ */
+typedef bool (*Ucs_AmsRx_IsPrioMsgCb_t)(uint16_t source_address, uint16_t msg_id, void *user_ptr);
+
 #ifdef __cplusplus
 }               /* extern "C" */
 #endif
@@ -84,6 +84,22 @@ typedef void* (*Ams_AllocMemCb_t)(void *inst_ptr, uint16_t mem_size, Ams_MemUsag
  */
 typedef void (*Ams_FreeMemCb_t)(void *inst_ptr, void *mem_ptr, Ams_MemUsage_t type, void* custom_info_ptr);
 
+/*! \brief  Callback function type that is invoked to allocate several memory chunks of the same 
+ *          size and usage type in one operation
+ *  \param  inst_ptr            Reference to the (external) memory management
+ *  \param  mem_size            Required memory size of every chunk in bytes
+ *  \param  type                Declares how the memory is used by UNICENS
+ *  \param  count               Number of required memory chunks
+ *  \param  mem_ptrs            Array of \c count elements which receives the references to the 
+ *                              memory chunks
+ *  \param  custom_info_ptrs    Array of \c count elements which receives the custom references 
+ *                              of the memory chunks
+ *  \return Returns \c true if all memory chunks are allocated. If not all chunks are available 
+ *          the function must not allocate any chunk and has to return \c false.
+ */
+typedef bool (*Ams_AllocMemBulkCb_t)(void *inst_ptr, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, 
+                                     void* mem_ptrs[], void* custom_info_ptrs[]);
+
 /*------------------------------------------------------------------------------------------------*/
 /* Allocator interface                                                                            */
 /*------------------------------------------------------------------------------------------------*/
@@ -93,6 +109,8 @@ typedef struct Ams_MemAllocator_
     void *inst_ptr;                /*!< \brief The instance of the (external) memory management */
     Ams_AllocMemCb_t alloc_fptr;   /*!< \brief This function is invoked to allocate Rx user payload */
     Ams_FreeMemCb_t  free_fptr;    /*!< \brief This function is invoked to free Rx user payload */
+    Ams_AllocMemBulkCb_t alloc_bulk_fptr; /*!< \brief Optional function which is invoked to allocate several 
+                                           *          memory chunks at once, or \c NULL */
 
 } Ams_MemAllocator_t;
 
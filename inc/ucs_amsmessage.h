@@ -125,6 +125,11 @@ typedef struct Amsg_IntMsgTx_
                                                  */
     CDlNode             node;                   /*!< \brief Node required for message pool */
 
+    Ucs_AmsTx_SharedPayload_t *shared_ptr;      /*!< \brief Application owned payload or \c NULL */
+    void               *shared_user_ptr;        /*!< \brief User reference passed to the release callback of shared_ptr */
+    Ucs_Mem_Buffer_t   *shared_curr_ptr;        /*!< \brief Memory buffer of shared_ptr which contains the next segment */
+    uint16_t            shared_curr_idx;        /*!< \brief Payload index of the first byte of shared_curr_ptr */
+
     Amsg_TxCompleteSiaCb_t complete_sia_fptr;   /*!< \brief Single instance API Callback function which is invoked
                                                  *          after transmission completed
                                                  */
@@ -146,6 +151,11 @@ typedef struct Amsg_IntMsgRx_
     uint16_t            memory_sz;              /*!< \brief The size of the allocated user payload in bytes */
 
     CDlNode             node;                   /*!< \brief Node required for message pool */
+    Ucs_Mem_Buffer_t   *segm_tail_ptr;          /*!< \brief Last element of Ucs_AmsRx_Msg_t::segments_ptr */
+    Ucs_Mem_Buffer_t    copy_segment;           /*!< \brief Segment which refers to the copied part of the payload
+                                                 *          if the zero-copy reception falls back to copying */
+    uint16_t            segm_size;              /*!< \brief Number of payload bytes in kept telegrams */
+    uint16_t            exp_size;               /*!< \brief Message size announced by TelId "4" or 0 if unknown */
 
     uint8_t             exp_tel_cnt;            /*!< \brief The expected TelCnt used for segmented transfer */
     bool                gc_marker;              /*!< \brief Identifies message objects that were already
@@ -160,6 +170,8 @@ typedef struct Amsg_IntMsgRx_
 extern void Amsg_TxCtor(Ucs_AmsTx_Msg_t *self, void *info_ptr, Amsg_TxFreedCb_t free_fptr, void *free_inst_ptr);
 extern void Amsg_TxSetInternalPayload(Ucs_AmsTx_Msg_t *self, uint8_t *mem_ptr, uint16_t mem_size, void *mem_info_ptr);
 extern void Amsg_TxReuse(Ucs_AmsTx_Msg_t *self);
+extern bool Amsg_TxSetSharedPayload(Ucs_AmsTx_Msg_t *self, Ucs_AmsTx_SharedPayload_t *payload_ptr, void *user_ptr);
+extern uint8_t* Amsg_TxGetPayload(Ucs_AmsTx_Msg_t *self, uint16_t index, uint8_t size, uint8_t *copy_ptr);
 extern void Amsg_TxSetCompleteCallback(Ucs_AmsTx_Msg_t *self, Amsg_TxCompleteSiaCb_t compl_sia_fptr, 
                                 Amsg_TxCompleteCb_t compl_fptr, void* compl_inst_ptr);
 extern void Amsg_TxNotifyComplete(Ucs_AmsTx_Msg_t *self, Ucs_AmsTx_Result_t result, Ucs_AmsTx_Info_t info);
@@ -174,6 +186,7 @@ extern void Amsg_TxSetFollowerId(Ucs_AmsTx_Msg_t *self, uint8_t id);
 extern void Amsg_TxReplaceDestinationAddr(Ucs_AmsTx_Msg_t *self, uint16_t new_destination);
 extern void Amsg_TxRemoveFromQueue(Ucs_AmsTx_Msg_t *self, CDlList *list_ptr);
 extern void Amsg_TxEnqueue(Ucs_AmsTx_Msg_t* self, CDlList* list_ptr);
+extern bool Amsg_TxIsQueued(Ucs_AmsTx_Msg_t* self);
 extern Ucs_AmsTx_Msg_t* Amsg_TxPeek(CDlList* list_ptr);
 extern Ucs_AmsTx_Msg_t* Amsg_TxDequeue(CDlList* list_ptr);
 
@@ -187,11 +200,16 @@ extern void Amsg_RxCopySignatureFromTel(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* sr
 extern void Amsg_RxCopySignatureToTel(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* target_ptr);
 extern void Amsg_RxCopyToPayload(Ucs_AmsRx_Msg_t *self, uint8_t data[], uint8_t data_sz);
 extern bool Amsg_RxAppendPayload(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* src_ptr);
+extern bool Amsg_RxCheckSize(Ucs_AmsRx_Msg_t *self, uint8_t size);
+extern void Amsg_RxAppendSegment(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* src_ptr);
+extern Msg_MostTel_t* Amsg_RxRemoveSegment(Ucs_AmsRx_Msg_t *self);
 extern bool Amsg_RxHasExternalPayload(Ucs_AmsRx_Msg_t *self);
 extern void Amsg_RxEnqueue(Ucs_AmsRx_Msg_t* self, CDlList* list_ptr);
 extern void Amsg_RxSetGcMarker(Ucs_AmsRx_Msg_t* self, bool value);
 extern bool Amsg_RxGetGcMarker(Ucs_AmsRx_Msg_t* self);
 extern uint8_t Amsg_RxGetExpTelCnt(Ucs_AmsRx_Msg_t* self);
+extern void Amsg_RxSetExpSize(Ucs_AmsRx_Msg_t* self, uint16_t size);
+extern uint16_t Amsg_RxGetExpSize(Ucs_AmsRx_Msg_t* self);
 /* Rx helpers */
 extern Ucs_AmsRx_Msg_t* Amsg_RxPeek(CDlList* list_ptr);
 extern Ucs_AmsRx_Msg_t* Amsg_RxDequeue(CDlList* list_ptr);
@@ -46,12 +46,40 @@
 #include "ucs_ams_pb.h"
 #include "ucs_obs.h"
 #include "ucs_amsallocator.h"
+#include "ucs_timer.h"
+#include "ucs_smm_pb.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+/*------------------------------------------------------------------------------------------------*/
+/* Internal constants                                                                             */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Number of memory usage types, see \ref Ams_MemUsage_t */
+#define AMSP_NUM_MEM_USAGES     4U
+/*! \brief Number of reserved Rx message objects */
+#define AMSP_NUM_RSVD_RX_MSGS   ((uint8_t)UCS_AMS_NUM_RSVD_RX_MSGS)
+
+/*------------------------------------------------------------------------------------------------*/
+/* Types                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Memory statistics of one memory usage type */
+typedef struct Amsp_MemStats_
+{
+    uint32_t            allocs;                     /*!< \brief  Number of successful allocations */
+    uint32_t            frees;                      /*!< \brief  Number of released memory chunks */
+    uint32_t            failures;                   /*!< \brief  Number of failed allocations */
+    uint32_t            bytes_in_use;               /*!< \brief  Number of currently allocated bytes */
+    uint32_t            peak_bytes;                 /*!< \brief  Maximum number of allocated bytes */
+    uint32_t            blocked_time;               /*!< \brief  Accumulated time in milliseconds between a failed 
+                                                     *           allocation and the next release of memory */
+    Tm_Tick_t           blocked_start;              /*!< \brief  Tick count of the first failed allocation */
+    bool                blocked;                    /*!< \brief  Is \c true if an allocation has failed and 
+                                                     *           memory was not released since then */
+} Amsp_MemStats_t;
+
 /*------------------------------------------------------------------------------------------------*/
 /* Classes                                                                                        */
 /*------------------------------------------------------------------------------------------------*/
@@ -59,11 +87,15 @@ extern "C"
 typedef struct CAmsMsgPool_
 {
     Ams_MemAllocator_t *allocator_ptr;              /*!< \brief  Interface to memory allocator */
-    Ucs_AmsRx_Msg_t    *rx_rsvd_msg_ptr;            /*!< \brief  Pre-allocated Rx message or NULL if no 
-                                                     *           reserved message is available */
-    Ucs_AmsRx_Msg_t    *rx_rsvd_msg_ref;            /*!< \brief  Stores the reference of the reserved message
-                                                     *           to identify it and restore the 
-                                                     *           \c rx_rsvd_msg_ptr. */
+    Ucs_AmsRx_Msg_t    *rx_rsvd_msgs[AMSP_NUM_RSVD_RX_MSGS];  /*!< \brief  Stores the references of the pre-allocated 
+                                                     *           Rx messages to identify them when they are freed.
+                                                     *           A reference is \c NULL if the message was released 
+                                                     *           by a cleanup. */
+    Ucs_AmsRx_Msg_t    *rx_rsvd_avail[AMSP_NUM_RSVD_RX_MSGS]; /*!< \brief  Stack of available pre-allocated Rx messages */
+    uint8_t             rx_rsvd_avail_cnt;          /*!< \brief  Number of available pre-allocated Rx messages */
+    Ucs_AmsRx_IsPrioMsgCb_t rx_rsvd_prio_fptr;      /*!< \brief  Identifies high priority messages or \c NULL */
+    uint8_t             rx_rsvd_prio_num;           /*!< \brief  Number of pre-allocated Rx messages which are kept 
+                                                     *           for high priority messages */
     CSubject            tx_freed_subject;           /*!< \brief  Allows to observe freed Tx message event */
     CSubject            rx_freed_subject;           /*!< \brief  Allows to observe freed Rx message event */
     bool                tx_notify_freed;            /*!< \brief  Is \c true when to notify the next Tx freed object */
@@ -71,21 +103,28 @@ typedef struct CAmsMsgPool_
     bool                terminated;                 /*!< \brief  Is \c true if a cleanup was done. Helps to release the 
                                                      *           pre-allocated message after the first cleanup attempt. */
     void               *ucs_user_ptr;               /*!< \brief User reference that needs to be passed in every callback function */
+    CTimerManagement   *tm_ptr;                     /*!< \brief  Reference to the timer management */
+    Amsp_MemStats_t     mem_stats[AMSP_NUM_MEM_USAGES]; /*!< \brief Memory statistics per \ref Ams_MemUsage_t */
 
 } CAmsMsgPool;
 
 /*------------------------------------------------------------------------------------------------*/
 /* Class methods                                                                                  */
 /*------------------------------------------------------------------------------------------------*/
-extern void Amsp_Ctor(CAmsMsgPool *self, Ams_MemAllocator_t *mem_allocator_ptr, void *ucs_user_ptr);
+extern void Amsp_Ctor(CAmsMsgPool *self, Ams_MemAllocator_t *mem_allocator_ptr, CTimerManagement *tm_ptr, 
+                      void *ucs_user_ptr);
 extern void Amsp_Cleanup(CAmsMsgPool *self);
+extern void Amsp_GetMemStats(CAmsMsgPool *self, Ams_MemUsage_t type, Amsp_MemStats_t *stats_ptr);
 /* Tx */
 extern void Amsp_AssignTxFreedObs(CAmsMsgPool *self, CObserver *observer_ptr);
 extern Ucs_AmsTx_Msg_t* Amsp_AllocTxObj(CAmsMsgPool *self, uint16_t payload_sz);
+extern bool Amsp_AllocTxObjBatch(CAmsMsgPool *self, uint8_t count, const uint16_t payload_sizes[], 
+                                 Ucs_AmsTx_Msg_t *msgs[]);
 /* Rx */
 extern void Amsp_AssignRxFreedObs(CAmsMsgPool *self, CObserver *observer_ptr);
 extern Ucs_AmsRx_Msg_t* Amsp_AllocRxObj(CAmsMsgPool *self, uint16_t payload_sz);
-extern Ucs_AmsRx_Msg_t* Amsp_AllocRxRsvd(CAmsMsgPool *self);
+extern Ucs_AmsRx_Msg_t* Amsp_AllocRxRsvd(CAmsMsgPool *self, uint16_t source_address, uint16_t msg_id);
+extern void Amsp_SetRxRsvdPolicy(CAmsMsgPool *self, Ucs_AmsRx_IsPrioMsgCb_t is_prio_fptr, uint8_t prio_num);
 extern bool Amsp_AllocRxPayload(CAmsMsgPool *self, uint16_t payload_sz, Ucs_AmsRx_Msg_t* msg_ptr);
 extern void Amsp_FreeRxObj(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr);
 extern void Amsp_FreeRxPayload(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr);
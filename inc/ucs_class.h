@@ -58,6 +58,7 @@
 #include "ucs_prog.h"
 #include "ucs_exc.h"
 #include "ucs_smm.h"
+#include "ucs_slab.h"
 #include "ucs_amd.h"
 #include "ucs_cmd.h"
 #include "ucs_mgr.h"
@@ -197,6 +198,8 @@ typedef struct Ucs_MsgData_
     CAms ams;
     /*! \brief Static memory management */
     CStaticMemoryManager smm;
+    /*! \brief Slab memory management which is used if the application assigns an arena */
+    CSlabMemoryManager slab;
     /*! \brief Observer to proxy callback tx_message_freed_fptr() */
     CObserver ams_tx_freed_obs;
     /*! \brief Signals that tx_message_freed_fptr() must be called as soon as 
@@ -217,6 +220,8 @@ typedef struct CUcs_
 {
     /*! \brief Stores the instance id, which is generated by Ucs_CreateInstance() */
     uint8_t ucs_inst_id;
+    /*! \brief Allocator of an instance created by Ucs_CreateInstanceEx(), otherwise all members are \c NULL */
+    Ucs_Allocator_t allocator;
     /*! \brief User reference that needs to be passed in every callback function */
     void *ucs_user_ptr;
     /*! \brief Backup of initialization data */
@@ -281,6 +286,8 @@ typedef struct CUcs_
 
     /*! \brief Is \c true if initialization completed successfully */
     bool init_complete;
+    /*! \brief Is \c true from Ucs_Init() until the initialization result is reported */
+    bool init_pending;
 
 } CUcs;
 
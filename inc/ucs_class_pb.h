@@ -92,12 +92,43 @@ typedef void (*Ucs_ErrorCb_t)(Ucs_Error_t error_code, void *user_ptr);
  */
 typedef void (*Ucs_DebugErrorMsgCb_t)(Msg_MostTel_t *msg_ptr, void *user_ptr);
 
+/*! \brief Data type of the system tick count and of application timer values in milliseconds.
+ *  \details The tick count is 16 bit wide by default and wraps around every 65.5 seconds. If the 
+ *           macro \c UCS_TICK_COUNT_32BIT is defined in ucs_cfg.h the tick count is 32 bit wide, 
+ *           which allows the application to pass its native millisecond counter and allows timers 
+ *           longer than 65.5 seconds.
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+#ifdef UCS_TICK_COUNT_32BIT
+typedef uint32_t Ucs_TickCount_t;
+#else
+typedef uint16_t Ucs_TickCount_t;
+#endif
+
+/*! \brief Function signature used for the callback function which allocates the memory of an 
+ *         instance created by Ucs_CreateInstanceEx().
+ *  \param size         Size of the requested memory in bytes
+ *  \param arena_ptr    Arena reference provided in \ref Ucs_Allocator_t "Ucs_Allocator_t::arena_ptr"
+ *  \return Reference to the allocated memory or \c NULL if no memory is available. The memory must 
+ *          be suitably aligned for any object type.
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+typedef void* (*Ucs_AllocCb_t)(uint32_t size, void *arena_ptr);
+
+/*! \brief Function signature used for the callback function which frees the memory of an 
+ *         instance destroyed by Ucs_DestroyInstance().
+ *  \param mem_ptr      Reference to the memory which was allocated by Ucs_AllocCb_t()
+ *  \param arena_ptr    Arena reference provided in \ref Ucs_Allocator_t "Ucs_Allocator_t::arena_ptr"
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+typedef void (*Ucs_FreeCb_t)(void *mem_ptr, void *arena_ptr);
+
 /*! \brief Function signature used for callback function to get system tick count.
  *  \param user_ptr     User reference provided in \ref Ucs_InitData_t "Ucs_InitData_t::user_ptr"
  *  \return Tick count in milliseconds
  *  \ingroup G_UCS_INIT_AND_SRV
  */
-typedef uint16_t (*Ucs_GetTickCountCb_t)(void *user_ptr);
+typedef Ucs_TickCount_t (*Ucs_GetTickCountCb_t)(void *user_ptr);
 
 /*! \brief Function signature used for timer callback function.
  *  \param timeout  The specified time-out value. 
@@ -109,7 +140,7 @@ typedef uint16_t (*Ucs_GetTickCountCb_t)(void *user_ptr);
  *  <!--\ucs_ic_started{ See <i>Getting Started</i>, section \ref P_UM_ADVANCED_SERVICE "Event Driven Service". }-->
  *  \ingroup G_UCS_INIT_AND_SRV
  */
-typedef void (*Ucs_SetAppTimerCb_t)(uint16_t timeout, void *user_ptr);
+typedef void (*Ucs_SetAppTimerCb_t)(Ucs_TickCount_t timeout, void *user_ptr);
 
 /*! \brief  Function signature used for the results and reports of the Routing Manager.
  *  \param  route_ptr       Reference to the route to be looked for
@@ -181,6 +212,153 @@ typedef void (*Ucs_Network_StatusCb_t)(uint16_t change_mask,
 /*------------------------------------------------------------------------------------------------*/
 /* Structures                                                                                     */
 /*------------------------------------------------------------------------------------------------*/
+/*! \brief Memory allocator of instances which are created by Ucs_CreateInstanceEx()
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Allocator_
+{
+    /*! \brief Mandatory callback function which allocates the memory of an instance */
+    Ucs_AllocCb_t alloc_fptr;
+    /*! \brief Mandatory callback function which frees the memory of an instance */
+    Ucs_FreeCb_t free_fptr;
+    /*! \brief Optional reference to the arena which is passed to alloc_fptr() and free_fptr() */
+    void *arena_ptr;
+
+} Ucs_Allocator_t;
+
+#ifdef UCS_PROF_GET_TIME
+/*! \brief Execution statistics of an internal service. All times are measured in units of the 
+ *         function which is assigned to \c UCS_PROF_GET_TIME in ucs_cfg.h. Accumulated values 
+ *         wrap around on overflow.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_ServiceStats_
+{
+    /*! \brief Name of the service */
+    const char *name_str;
+    /*! \brief Priority of the service. Services of higher priority are executed first. */
+    uint8_t priority;
+    /*! \brief Number of service invocations */
+    uint32_t invocations;
+    /*! \brief Accumulated execution time */
+    uint32_t total_time;
+    /*! \brief Maximum execution time of a single invocation */
+    uint32_t max_time;
+    /*! \brief Accumulated time between setting an event and the execution of the service */
+    uint32_t total_dwell_time;
+    /*! \brief Maximum time between setting an event and the execution of the service */
+    uint32_t max_dwell_time;
+
+} Ucs_Diag_ServiceStats_t;
+#endif
+
+/*! \brief Statistics of the Rx message pool which is used by the low-level driver. The values 
+ *         help to size the pool by means of Ucs_Lld_RxPoolInitData_t. Times are measured in 
+ *         milliseconds. Accumulated values wrap around on overflow.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_RxPoolStats_
+{
+    /*! \brief Number of messages in the pool */
+    uint16_t size;
+    /*! \brief Number of currently available messages */
+    uint16_t available;
+    /*! \brief Minimum number of available messages since initialization */
+    uint16_t low_water_mark;
+    /*! \brief Number of allocations which failed since no message was available */
+    uint32_t alloc_failures;
+    /*! \brief Number of times the low-level driver was notified that messages are available again */
+    uint32_t stall_count;
+    /*! \brief Accumulated time the low-level driver waited for messages. Always 0 if the macro 
+     *         \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h. 
+     */
+    uint32_t total_stall_time;
+    /*! \brief Maximum time the low-level driver waited for messages. Always 0 if the macro 
+     *         \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h. 
+     */
+    uint32_t max_stall_time;
+
+} Ucs_Diag_RxPoolStats_t;
+
+/*! \brief Memory statistics of one allocation type of the Application Message Service.
+ *         Times are measured in milliseconds. Accumulated values wrap around on overflow.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_AmsMemTypeStats_
+{
+    /*! \brief Number of successful allocations */
+    uint32_t allocs;
+    /*! \brief Number of released memory chunks */
+    uint32_t frees;
+    /*! \brief Number of failed allocations */
+    uint32_t failures;
+    /*! \brief Number of currently allocated bytes */
+    uint32_t bytes_in_use;
+    /*! \brief Maximum number of allocated bytes since initialization */
+    uint32_t peak_bytes;
+    /*! \brief Accumulated time between a failed allocation and the next release of memory 
+     *         which may notify that message objects are available again
+     */
+    uint32_t blocked_time;
+
+} Ucs_Diag_AmsMemTypeStats_t;
+
+/*! \brief Memory statistics of the Application Message Service. The values help to size the 
+ *         memory which is provided by \ref Ucs_Ams_InitData_t for peak load.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_AmsMemStats_
+{
+    /*! \brief Statistics of Rx message objects */
+    Ucs_Diag_AmsMemTypeStats_t rx_object;
+    /*! \brief Statistics of Rx message payload */
+    Ucs_Diag_AmsMemTypeStats_t rx_payload;
+    /*! \brief Statistics of Tx message objects */
+    Ucs_Diag_AmsMemTypeStats_t tx_object;
+    /*! \brief Statistics of Tx message payload */
+    Ucs_Diag_AmsMemTypeStats_t tx_payload;
+
+} Ucs_Diag_AmsMemStats_t;
+
+/*! \brief Statistics of one port message FIFO. The ratio of \c status_msgs and \c data_msgs 
+ *         is the number of acknowledges per data message. Accumulated values wrap around on overflow.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_FifoChannelStats_
+{
+    /*! \brief Number of received data messages */
+    uint32_t data_msgs;
+    /*! \brief Number of transmitted status messages which acknowledge data messages */
+    uint32_t status_msgs;
+    /*! \brief Current number of data messages which are acknowledged by one status message */
+    uint8_t ack_threshold;
+    /*! \brief Current time in milliseconds after which pending data messages are acknowledged, 
+     *         or 0 if the FIFO uses a static threshold
+     */
+    uint16_t ack_delay;
+    /*! \brief Number of Tx handles, i.e. the maximum number of data messages in flight to the 
+     *         low-level driver. See \ref Ucs_Lld_TxWindowInitData_t.
+     */
+    uint8_t tx_window_size;
+    /*! \brief Number of times the transmission stalled since all Tx handles were in flight */
+    uint32_t tx_window_stalls;
+
+} Ucs_Diag_FifoChannelStats_t;
+
+/*! \brief Statistics of the port message FIFOs
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Diag_FifoStats_
+{
+    /*! \brief Statistics of the ICM FIFO */
+    Ucs_Diag_FifoChannelStats_t icm;
+    /*! \brief Statistics of the MCM FIFO */
+    Ucs_Diag_FifoChannelStats_t mcm;
+    /*! \brief Statistics of the RCM FIFO */
+    Ucs_Diag_FifoChannelStats_t rcm;
+
+} Ucs_Diag_FifoStats_t;
+
 /*! \brief The general section of initialization data 
  *  \ingroup G_UCS_INIT_AND_SRV_TYPES
  */
@@ -263,6 +441,48 @@ typedef struct Ucs_Network_InitData_
 /*! \brief The initialization structure of the Low-Level Driver */
 typedef Ucs_Lld_Callbacks_t Ucs_Lld_InitData_t;
 
+/*! \brief The initialization structure of the Rx message pool of the low-level driver interface
+ *  \details The pool provides the messages which are allocated by the low-level driver by means 
+ *           of \ref Ucs_Lld_Api_t::rx_allocate_fptr "rx_allocate_fptr". If no memory is assigned
+ *           the built-in pool is used, which comprises 35 messages or 10 messages if 
+ *           \c UCS_FOOTPRINT_TINY is defined. If \c UCS_LLD_RX_POOL_EXTERNAL is defined the 
+ *           built-in pool is omitted and the memory must be assigned.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Lld_RxPoolInitData_
+{
+    /*! \brief Optional memory of the pool. The required size is calculated by 
+     *         Ucs_Lld_GetRxPoolMemSize(). The memory must be aligned like memory returned by 
+     *         malloc() and must not be accessed by the application until Ucs_Stop() has completed.
+     *         Set to \c NULL (default value) to use the built-in pool.
+     */
+    void *mem_ptr;
+    /*! \brief Number of messages fitting in \c mem_ptr. Valid values: 10..65535. */
+    uint16_t size;
+
+} Ucs_Lld_RxPoolInitData_t;
+
+/*! \brief The initialization structure of the Tx window of the low-level driver interface
+ *  \details Each port message FIFO provides a number of Tx handles which limits the number of
+ *           data messages in flight to the low-level driver until they are acknowledged by the 
+ *           INIC. If no memory is assigned the built-in handles are used, which comprise 5 
+ *           handles per FIFO. A larger window keeps high-latency links busy if the INIC 
+ *           provides more credits.
+ *  \ingroup G_UCS_INIT_AND_SRV_TYPES
+ */
+typedef struct Ucs_Lld_TxWindowInitData_
+{
+    /*! \brief Optional memory of the Tx handles of all FIFOs. The required size is calculated by 
+     *         Ucs_Lld_GetTxWindowMemSize(). The memory must be aligned like memory returned by 
+     *         malloc() and must not be accessed by the application until Ucs_Stop() has completed.
+     *         Set to \c NULL (default value) to use the built-in handles.
+     */
+    void *mem_ptr;
+    /*! \brief Number of Tx handles per FIFO. Valid values: 5..63. */
+    uint8_t size;
+
+} Ucs_Lld_TxWindowInitData_t;
+
 /*! \brief The initialization structure of the Extended Resource Manager
  *  \ingroup G_UCS_XRM_TYPES
  */
@@ -498,6 +718,39 @@ typedef struct Ucs_AmsRx_InitData_
      */
     Ucs_AmsRx_MsgReceivedCb_t message_received_fptr;
 
+    /*! \brief   Optional setting to receive segmented messages without copying the payload. 
+     *           Default value: \c false.
+     *  \details If set to \c true the received telegrams of a segmented message are kept and the
+     *           payload is provided as chain of memory buffers in Ucs_AmsRx_Msg_t::segments_ptr.
+     *           The telegrams are returned to the Rx pool of the low-level driver interface when 
+     *           the message is released by Ucs_AmsRx_ReleaseMsg(). Kept telegrams do not hold back
+     *           the flow control of the INIC, but a segmented message occupies 
+     *           one Rx message object per 44 bytes of payload until it is released. At most half
+     *           of the Rx pool is used for kept telegrams, the other half remains available for
+     *           the control traffic. If this limit is reached the remaining payload of a message
+     *           is copied to payload memory, which is provided as last segment of the chain. 
+     *           Therefore, the Rx pool should be enlarged by means of Ucs_InitData_t::lld_rx_pool 
+     *           according to the expected message sizes. Non-segmented messages and messages 
+     *           without any kept telegram are still provided in Ucs_AmsRx_Msg_t::data_ptr.
+     */
+    bool zero_copy_segments;
+
+    /*! \brief   Optional callback function which identifies received single telegram messages 
+     *           with a high priority. Default value: \c NULL.
+     *  \details The Rx message objects which are reserved by \c UCS_AMS_NUM_RSVD_RX_MSGS are used 
+     *           if no further Rx message object can be allocated, e.g. while large segmented messages 
+     *           occupy the AMS memory. The last \c num_prio_rsvd_msgs reserved objects are only 
+     *           provided for messages which are identified as high priority messages by this function.
+     *           Thus, control messages are still received under memory pressure.
+     */
+    Ucs_AmsRx_IsPrioMsgCb_t is_prio_msg_fptr;
+
+    /*! \brief   Number of reserved Rx message objects which are kept for high priority messages.
+     *           The value is only effective if \c is_prio_msg_fptr is assigned.
+     *           Valid values: 0..UCS_AMS_NUM_RSVD_RX_MSGS. Default value: 0.
+     */
+    uint8_t num_prio_rsvd_msgs;
+
 } Ucs_AmsRx_InitData_t;
 
 /*! \brief The Tx initialization data of the Application Message Service 
@@ -527,6 +780,25 @@ typedef struct Ucs_Ams_InitData_
 {
     Ucs_AmsRx_InitData_t rx;    /*!< \brief Rx related initialization parameters */
     Ucs_AmsTx_InitData_t tx;    /*!< \brief Tx related initialization parameters */
+    void *arena_ptr;            /*!< \brief Optional memory arena for Rx and Tx messages and their payload. 
+                                 *   \details If assigned, message objects and payload are allocated from 
+                                 *            five size classes: payload of \c UCS_AMS_SIZE_RX_MSG and
+                                 *            \c UCS_AMS_SIZE_TX_MSG bytes, Rx message objects, Tx message
+                                 *            objects, and 1024 and 4096 bytes for segmented payload. Twelve
+                                 *            sixteenths of the arena hold an equal number of Rx and Tx
+                                 *            messages with single telegram payload. The rest is split 1:3
+                                 *            among the large size classes. Blocks are carved from the
+                                 *            partition of their size class on demand. If a size class is
+                                 *            exhausted, blocks are borrowed from the next larger size class.
+                                 *            Thus, the number of messages is limited by the arena size
+                                 *            rather than by \c UCS_AMS_NUM_RX_MSGS and
+                                 *            \c UCS_AMS_NUM_TX_MSGS. Payload larger than 4096 bytes cannot
+                                 *            be allocated. The memory must be aligned like memory returned
+                                 *            by malloc(). Ucs_Init() fails if the arena is too small. Set
+                                 *            to \c NULL (default value) to use the static memory
+                                 *            configured in ucs_cfg.h.
+                                 */
+    uint32_t arena_size;        /*!< \brief Size of the memory arena in bytes */
     bool enabled;               /*!< \brief If set to \c false the AMS and CMD modules are  
                                  *          not initialized and the related features are 
                                  *          not available.
@@ -547,6 +819,10 @@ typedef struct Ucs_InitData_
     Ucs_General_InitData_t general;
     /*! \brief Comprises assignment to low-level driver communication interfaces */
     Ucs_Lld_InitData_t lld;
+    /*! \brief Optional memory of the Rx message pool of the low-level driver interface */
+    Ucs_Lld_RxPoolInitData_t lld_rx_pool;
+    /*! \brief Optional memory of the Tx window of the low-level driver interface */
+    Ucs_Lld_TxWindowInitData_t lld_tx_window;
     /*! \brief The initialization data of the Routing Management */
     Ucs_Rm_InitData_t rm;
     /*! \brief Initialization structure of the GPIO */
@@ -581,6 +857,39 @@ typedef struct Ucs_InitData_
  */
 extern Ucs_Inst_t* Ucs_CreateInstance(void);
 
+/*! \brief   Creates a UNICENS API instance in memory provided by the application
+ *  \details In contrast to Ucs_CreateInstance() the number of instances is not limited by
+ *           \c UCS_NUM_INSTANCES. The memory of the instance is requested from the given allocator
+ *           and returned to it by Ucs_DestroyInstance(). The function does not access any 
+ *           shared state. Thus, it may be called concurrently from different threads as long 
+ *           as the allocator is thread-safe. All instances created by this function have the 
+ *           instance ID 0.
+ *  \param   allocator_ptr  Reference to the allocator. The structure is copied, thus it may be 
+ *                          located on the stack.
+ *  \return  Returns a reference to new instance of UNICENS or \c NULL, if the allocator is 
+ *           invalid or no memory is available. The returned instance must be used as argument \c self.
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Inst_t* Ucs_CreateInstanceEx(const Ucs_Allocator_t *allocator_ptr);
+
+/*! \brief   Destroys an instance which was created by Ucs_CreateInstanceEx()
+ *  \details The memory of the instance is returned to the allocator. The instance must 
+ *           not be initialized, or Ucs_Stop() must be completed. The function is rejected while 
+ *           Ucs_Init() is still running and while the LLD is started, e.g. after an initialization 
+ *           failure or a general error which did not stop the LLD. Call Ucs_Stop() first in this case.
+ *           The reference \c self becomes invalid after the function has succeeded.
+ *  \note    <b>Do not call this function within any of the UNICENS callbacks!</b>
+ *  \param   self   The instance
+ *  \return  Possible return values are shown in the table below.
+ *           Value                  | Description
+ *           ---------------------- | -----------------------------------------------------------------------
+ *           UCS_RET_SUCCESS        | No error
+ *           UCS_RET_ERR_PARAM      | The instance was not created by Ucs_CreateInstanceEx()
+ *           UCS_RET_ERR_API_LOCKED | The instance is initializing, initialized, the LLD is started or the termination is still running
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Return_t Ucs_DestroyInstance(Ucs_Inst_t *self);
+
 /*! \brief   Assigns default values to a provided UNICENS init structure
  *  \param   init_ptr    Reference to a provided MNS init structure. Must not be \c NULL.
  *  \return  Possible return values are shown in the table below.
@@ -614,7 +923,8 @@ Ucs_Return_t Ucs_SetDefaultConfig(Ucs_InitData_t *init_ptr);
  *           Value             | Description 
  *           ----------------- | ------------------------------------
  *           UCS_RET_SUCCESS   | No error.
- *           UCS_RET_ERR_PARAM | Parameter \c init_ptr or one of its attributes is not set correctly.
+ *           UCS_RET_ERR_PARAM | Parameter \c init_ptr or one of its attributes is not set correctly,
+ *                             e.g. the AMS arena is too small.
  *  \ingroup G_UCS_INIT_AND_SRV
  */
 extern Ucs_Return_t Ucs_Init(Ucs_Inst_t* self, const Ucs_InitData_t *init_ptr, Ucs_InitResultCb_t init_result_fptr);
@@ -626,7 +936,9 @@ extern Ucs_Return_t Ucs_Init(Ucs_Inst_t* self, const Ucs_InitData_t *init_ptr, U
  *           UNICENS will call stopped_fptr() and will no longer invoke the 
  *           request_service_fptr. \n\n
  *           The application shall no longer call any API function. Any previously retrieved
- *           UNICENS objects (e.g. messages) become invalid.
+ *           UNICENS objects (e.g. messages) become invalid. \n\n
+ *           The function can also be used after a failed initialization or a general error 
+ *           to stop an LLD which is still started.
  *  \note    <b>Do not call this function within any of the UNICENS callbacks!</b>
  *  \param   self                The instance
  *  \param   stopped_fptr        Mandatory callback function which is invoked as soon as the termination has
@@ -641,7 +953,7 @@ extern Ucs_Return_t Ucs_Init(Ucs_Inst_t* self, const Ucs_InitData_t *init_ptr, U
  *           ---------------------- | -----------------------------------------------------------------------
  *           UCS_RET_SUCCESS        | No error
  *           UCS_RET_ERR_PARAM      | Mandatory callback function not provided
- *           UCS_RET_ERR_API_LOCKED | Initialization was not completed or termination has been started before
+ *           UCS_RET_ERR_API_LOCKED | Initialization is running, the stack is already stopped or termination has been started before
  *  \ingroup G_UCS_INIT_AND_SRV
  */
 extern Ucs_Return_t Ucs_Stop(Ucs_Inst_t *self, Ucs_StdResultCb_t stopped_fptr);
@@ -652,12 +964,113 @@ extern Ucs_Return_t Ucs_Stop(Ucs_Inst_t *self, Ucs_StdResultCb_t stopped_fptr);
  */
 extern void Ucs_Service(Ucs_Inst_t *self);
 
+/*! \brief   Variant of Ucs_Service() which limits the work done per call.
+ *  \details The function executes at most \c max_services internal services and returns afterwards.
+ *           Internal services which were not executed keep their pending events. In this case the 
+ *           callback function \ref Ucs_General_InitData_t "request_service_fptr" is invoked 
+ *           so that the application calls Ucs_Service() or Ucs_ServiceBudget() again to process 
+ *           the remaining work. Limiting the work per call bounds the time spent within a single 
+ *           call, e.g. under a burst of received application messages.
+ *  \param   self           The instance
+ *  \param   max_services   Maximum number of internal services to execute. The value 0 executes 
+ *                          all pending services like Ucs_Service().
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern void Ucs_ServiceBudget(Ucs_Inst_t *self, uint16_t max_services);
+
+#ifdef UCS_PROF_GET_TIME
+/*! \brief   Retrieves the execution statistics of all internal services
+ *  \details The function is only available if the macro \c UCS_PROF_GET_TIME is defined in 
+ *           ucs_cfg.h. The statistics are reported in priority order of the services.
+ *  \param   self          The instance
+ *  \param   stats_list    Array which receives the statistics
+ *  \param   list_size     Number of entries of \c stats_list
+ *  \param   count_ptr     Returns the number of entries written to \c stats_list
+ *  \return  Possible return values are shown in the table below.
+ *           Value                       | Description 
+ *           --------------------------- | ------------------------------------
+ *           UCS_RET_SUCCESS             | No error
+ *           UCS_RET_ERR_PARAM           | \c stats_list or \c count_ptr is \c NULL
+ *           UCS_RET_ERR_NOT_INITIALIZED | UNICENS is not initialized
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Return_t Ucs_Diag_GetServiceStats(Ucs_Inst_t *self, Ucs_Diag_ServiceStats_t stats_list[], 
+                                             uint8_t list_size, uint8_t *count_ptr);
+#endif
+
+/*! \brief   Calculates the memory which is required for an Rx message pool
+ *  \param   size   Number of messages of the pool
+ *  \return  The required memory in bytes which shall be assigned to 
+ *           \ref Ucs_Lld_RxPoolInitData_t "Ucs_InitData_t::lld_rx_pool"
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern uint32_t Ucs_Lld_GetRxPoolMemSize(uint16_t size);
+
+/*! \brief   Calculates the memory which is required for the Tx window of the low-level driver interface
+ *  \param   size    Number of Tx handles per FIFO. Valid values: 5..63.
+ *  \return  The required memory in bytes which shall be assigned to 
+ *           \ref Ucs_Lld_TxWindowInitData_t "Ucs_InitData_t::lld_tx_window"
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern uint32_t Ucs_Lld_GetTxWindowMemSize(uint8_t size);
+
+/*! \brief   Retrieves the statistics of the Rx message pool of the low-level driver interface
+ *  \param   self          The instance
+ *  \param   stats_ptr     Reference to the structure which receives the statistics
+ *  \return  Possible return values are shown in the table below.
+ *           Value                       | Description 
+ *           --------------------------- | ------------------------------------
+ *           UCS_RET_SUCCESS             | No error
+ *           UCS_RET_ERR_PARAM           | \c stats_ptr is \c NULL
+ *           UCS_RET_ERR_NOT_INITIALIZED | UNICENS is not initialized
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Return_t Ucs_Diag_GetRxPoolStats(Ucs_Inst_t *self, Ucs_Diag_RxPoolStats_t *stats_ptr);
+
+/*! \brief   Retrieves the memory statistics of the Application Message Service
+ *  \param   self          The instance
+ *  \param   stats_ptr     Reference to the structure which receives the statistics
+ *  \return  Possible return values are shown in the table below.
+ *           Value                       | Description 
+ *           --------------------------- | ------------------------------------
+ *           UCS_RET_SUCCESS             | No error
+ *           UCS_RET_ERR_PARAM           | \c stats_ptr is \c NULL
+ *           UCS_RET_ERR_NOT_INITIALIZED | UNICENS is not initialized or the Application Message Service is disabled
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Return_t Ucs_Diag_GetAmsMemStats(Ucs_Inst_t *self, Ucs_Diag_AmsMemStats_t *stats_ptr);
+
+/*! \brief   Retrieves the statistics of the port message FIFOs
+ *  \details The MCM FIFO adapts its acknowledge threshold to the current load. The statistics 
+ *           help to evaluate the number of acknowledges per data message and to size the 
+ *           Tx window by means of \ref Ucs_Lld_TxWindowInitData_t.
+ *  \param   self          The instance
+ *  \param   stats_ptr     Reference to the structure which receives the statistics
+ *  \return  Possible return values are shown in the table below.
+ *           Value                       | Description 
+ *           --------------------------- | ------------------------------------
+ *           UCS_RET_SUCCESS             | No error
+ *           UCS_RET_ERR_PARAM           | \c stats_ptr is \c NULL
+ *           UCS_RET_ERR_NOT_INITIALIZED | UNICENS is not initialized
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern Ucs_Return_t Ucs_Diag_GetFifoStats(Ucs_Inst_t *self, Ucs_Diag_FifoStats_t *stats_ptr);
+
 /*! \brief   The application must call this function if the application timer expires.
  *  \param   self           The instance
  *  \ingroup G_UCS_INIT_AND_SRV
  */
 extern void Ucs_ReportTimeout(Ucs_Inst_t *self);
 
+/*! \brief   Retrieves the number of service calls which were saved by timer coalescing.
+ *  \details Internal timers which tolerate a delayed expiry are handled together with other
+ *           timers within one service run. Hence, the application timer is started less often.
+ *  \param   self           The instance
+ *  \return  Number of timer expiry points which were handled together with a later expiry point
+ *  \ingroup G_UCS_INIT_AND_SRV
+ */
+extern uint32_t Ucs_GetSavedWakeups(Ucs_Inst_t *self);
+
 /*------------------------------------------------------------------------------------------------*/
 /* Routing Management                                                                             */
 /*------------------------------------------------------------------------------------------------*/
@@ -1923,6 +2336,28 @@ Ucs_Return_t Ucs_Prog_Start(Ucs_Inst_t *self,
  */
 Ucs_AmsTx_Msg_t* Ucs_AmsTx_AllocMsg(Ucs_Inst_t *self, uint16_t data_size);
 
+/*! \brief   Allocates several Tx message objects in one operation
+ *  \details The function allocates either all or none of the requested Tx message objects. 
+ *           Every message object is provided with a payload buffer of the respective size.
+ *           The same rules as for Ucs_AmsTx_AllocMsg() apply to every allocated message object.
+ *  \param   self           The instance
+ *  \param   count          Number of Tx message objects. Valid values: 1..UCS_AMSTX_MAX_BATCH_SIZE.
+ *  \param   sizes          Array of \c count required payload sizes. Valid values: 0..65535.
+ *  \param   msgs           Array of \c count elements which receives the allocated Tx message objects.
+ *  \return  Possible return values are shown in the table below.
+ *           <table>
+ *            <tr><th>Value</th><th>Description</th></tr>
+ *            <tr><td>UCS_RET_SUCCESS</td><td>No error</td></tr>
+ *            <tr><td>UCS_RET_ERR_PARAM</td><td>\c sizes or \c msgs is \c NULL, or \c count is out of range</td></tr>
+ *            <tr><td>UCS_RET_ERR_BUFFER_OVERFLOW</td><td>Not enough message objects or payload are available. 
+ *                The application can use \ref Ucs_AmsTx_InitData_t::message_freed_fptr "ams.tx.message_freed_fptr" 
+ *                as trigger to request the message objects again.</td></tr>
+ *            <tr><td>UCS_RET_ERR_NOT_INITIALIZED</td><td>UNICENS is not initialized</td></tr>
+ *           </table>
+ *  \ingroup G_UCS_AMS
+ */
+Ucs_Return_t Ucs_AmsTx_AllocMsgBatch(Ucs_Inst_t *self, uint8_t count, const uint16_t sizes[], Ucs_AmsTx_Msg_t *msgs[]);
+
 /*! \brief   Transmits an application message
  *  \param   self                The instance
  *  \param   msg_ptr             Reference to the related Tx message object
@@ -1957,6 +2392,29 @@ Ucs_AmsTx_Msg_t* Ucs_AmsTx_AllocMsg(Ucs_Inst_t *self, uint16_t data_size);
  */
 Ucs_Return_t Ucs_AmsTx_SendMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_CompleteCb_t tx_complete_fptr);
 
+/*! \brief   Transmits several application messages in one operation
+ *  \details All messages are checked before the first one is scheduled. Thus, either all or none 
+ *           of the messages is transmitted. The callback function is invoked separately for every 
+ *           message.
+ *  \param   self                The instance
+ *  \param   count               Number of Tx message objects. Valid values: 1..UCS_AMSTX_MAX_BATCH_SIZE.
+ *  \param   msgs                Array of \c count references to Tx message objects obtained from 
+ *                               Ucs_AmsTx_AllocMsg() or Ucs_AmsTx_AllocMsgBatch()
+ *  \param   tx_complete_fptr    Callback function that is invoked as soon as the transmission of a message 
+ *                               was finished. See Ucs_AmsTx_SendMsg().
+ *  \return  Possible return values are shown in the table below.
+ *           <table>
+ *            <tr><th>Value</th><th>Description</th></tr>
+ *            <tr><td>UCS_RET_SUCCESS</td><td>No error</td></tr>
+ *            <tr><td>UCS_RET_ERR_PARAM</td><td>\c msgs is \c NULL, \c count is out of range or 
+ *                at least one message is invalid, listed twice or already scheduled for transmission. 
+ *                See Ucs_AmsTx_SendMsg(). None of the messages is transmitted.</td></tr>
+ *            <tr><td>UCS_RET_ERR_NOT_INITIALIZED</td><td>UNICENS is not initialized</td></tr>
+ *           </table>
+ *  \ingroup G_UCS_AMS
+ */
+Ucs_Return_t Ucs_AmsTx_SendMsgBatch(Ucs_Inst_t *self, uint8_t count, Ucs_AmsTx_Msg_t *msgs[], Ucs_AmsTx_CompleteCb_t tx_complete_fptr);
+
 /*! \brief   Frees an unused Tx message object
  *  \param   self     The instance
  *  \param   msg_ptr  Reference to the Tx message object
@@ -1966,6 +2424,34 @@ Ucs_Return_t Ucs_AmsTx_SendMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_A
  */
 void Ucs_AmsTx_FreeUnusedMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr);
 
+/*! \brief   Assigns an application owned payload to a Tx message object
+ *  \details The payload is transmitted directly from the given chain of memory buffers, without
+ *           copying it to the message object. The same payload can be assigned to multiple Tx 
+ *           message objects, e.g. to transmit a large payload to several destinations. 
+ *           Every assignment increments Ucs_AmsTx_SharedPayload_t::ref_cnt. As soon as a message 
+ *           has finished its transmission or is freed via Ucs_AmsTx_FreeUnusedMsg(), the reference 
+ *           counter is decremented. When it reaches \c 0 the callback function 
+ *           Ucs_AmsTx_SharedPayload_t::released_fptr is invoked and the application is allowed 
+ *           to modify or free the payload again.\n
+ *           The function sets Ucs_AmsTx_Msg_t::data_size to the size of the complete chain and 
+ *           Ucs_AmsTx_Msg_t::data_ptr to the first memory buffer. The application must not 
+ *           modify both attributes afterwards.
+ *  \param   self        The instance
+ *  \param   msg_ptr     Reference to a Tx message object obtained from Ucs_AmsTx_AllocMsg(). The 
+ *                       message object shall be allocated with data_size \c 0.
+ *  \param   payload_ptr Reference to the application owned payload
+ *  \return  Possible return values are shown in the table below.
+ *           <table>
+ *            <tr><th>Value</th><th>Description</th></tr>
+ *            <tr><td>UCS_RET_SUCCESS</td><td>No error</td></tr>
+ *            <tr><td>UCS_RET_ERR_PARAM</td><td>\c msg_ptr or \c payload_ptr is \c NULL, or
+ *                the size of the payload chain exceeds 65535 bytes</td></tr>
+ *            <tr><td>UCS_RET_ERR_NOT_INITIALIZED</td><td>UNICENS is not initialized</td></tr>
+ *           </table>
+ *  \ingroup G_UCS_AMS
+ */
+Ucs_Return_t Ucs_AmsTx_SetSharedPayload(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_SharedPayload_t *payload_ptr);
+
 /*! \brief   Retrieves a reference to the front-most message in the Rx queue 
  *  \details The Application Message Service already provides a queue of
  *           completed Rx messages. Ucs_AmsRx_PeekMsg() always returns a reference
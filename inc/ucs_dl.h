@@ -82,7 +82,8 @@ typedef struct DlNode_
     struct DlNode_ *prev;       /*!< \brief Reference to previous node in list */
     struct DlNode_ *next;       /*!< \brief Reference to next node in list */
     void *data_ptr;             /*!< \brief Reference to optional data */
-    bool in_use;                /*!< \brief Flag which signals that the node is in use */
+    struct CDlList_ *list_ptr;  /*!< \brief Reference to the list which contains the node or 
+                                 *          \c NULL if the node is not part of a list */
 
 } CDlNode;
 
@@ -102,7 +102,7 @@ typedef void (*Ehobs_UpdateCb_t)(void *self, uint32_t event_code);
 typedef struct CEventHandler_
 {
     /*! \brief Subject used for internal events */
-    CSubject internal_event_subject;
+    CMaskedSubject internal_event_subject;
     /*! \brief Single subject to report error to application */
     CSingleSubject public_error_subject;
     /*! \brief UNICENS instance ID */
@@ -75,7 +75,12 @@ typedef struct Ucs_Lld_TxMsg_
     struct Ucs_Lld_TxMsg_ *custom_next_msg_ptr;/*!< \brief     Shall be used by the LLD implementation to queue messages for
                                                 *              asynchronous transmission
                                                 *   \details   UNICENS will set this value to \c NULL since only 
-                                                *              single messages are forwarded to the LLD. Within the transmit function 
+                                                *              single messages are forwarded to the LLD, unless 
+                                                *              \ref Ucs_Lld_Callbacks_t::tx_batch_enabled "tx_batch_enabled" is set. 
+                                                *              In this case UNICENS forwards a chain of messages linked by 
+                                                *              this pointer and the last message of the chain refers to \c NULL.
+                                                *              The LLD must set this value to \c NULL before it releases the 
+                                                *              respective message. Within the transmit function 
                                                 *              it is recommended that the LLD queues the message for asynchronous 
                                                 *              transmission. Despite a driver's transmit function might signal busy for 
                                                 *              a short term the UNICENS library might forward multiple messages for 
@@ -119,12 +124,17 @@ typedef struct Ucs_Lld_RxMsg_
  *          The function will also return \c NULL if the requested \c buffer_size exceeds the valid range.
  *          In such a case the UNICENS cannot guarantee that Ucs_Lld_RxMsgAvailableCb_t() is 
  *          called as expected. Received messages exceeding the valid range must be discarded by the LLD.
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context, but not from multiple threads
+ *          concurrently.
  */
 typedef Ucs_Lld_RxMsg_t* (*Ucs_Lld_RxAllocateCb_t)(void *inst_ptr, uint16_t buffer_size);
 
 /*! \brief  Frees an unused Rx message object
  *  \param  inst_ptr    Reference to internal UNICENS handler
  *  \param  msg_ptr     Reference to the unused Rx message object
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context.
  */
 typedef void (*Ucs_Lld_RxFreeUnusedCb_t)(void *inst_ptr, Ucs_Lld_RxMsg_t *msg_ptr);
 
@@ -132,13 +142,43 @@ typedef void (*Ucs_Lld_RxFreeUnusedCb_t)(void *inst_ptr, Ucs_Lld_RxMsg_t *msg_pt
  *  \param  inst_ptr    Reference to internal UNICENS handler
  *  \param  msg_ptr     Reference to the Rx message object containing the received
  *                      message.
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context.
  */
 typedef void (*Ucs_Lld_RxReceiveCb_t)(void *inst_ptr, Ucs_Lld_RxMsg_t *msg_ptr);
 
+/*! \brief  Allocates several Rx message objects of the same size in one call
+ *  \param  inst_ptr    Reference to an internal UNICENS handler
+ *  \param  buffer_size The size in bytes of every Rx message. Valid values: 6..72.
+ *  \param  msgs        Array of \c count elements which receives the Rx message objects
+ *  \param  count       Number of requested Rx message objects
+ *  \return The number of allocated Rx message objects which are stored at the beginning of \c msgs. 
+ *          If the returned number is smaller than \c count, the low-level driver can wait until 
+ *          Ucs_Lld_RxMsgAvailableCb_t() is invoked. See also Ucs_Lld_RxAllocateCb_t().
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context, but not from multiple threads
+ *          concurrently.
+ */
+typedef uint8_t (*Ucs_Lld_RxAllocateBatchCb_t)(void *inst_ptr, uint16_t buffer_size, Ucs_Lld_RxMsg_t *msgs[], uint8_t count);
+
+/*! \brief  Pass several Rx messages to UNICENS in one call
+ *  \details The messages are processed in the order of the array. In contrast to calling 
+ *           Ucs_Lld_RxReceiveCb_t() for every message, UNICENS requests a service call 
+ *           only once for the whole batch.
+ *  \param  inst_ptr    Reference to internal UNICENS handler
+ *  \param  msgs        Array of \c count Rx message objects containing the received messages
+ *  \param  count       Number of Rx message objects
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context.
+ */
+typedef void (*Ucs_Lld_RxReceiveBatchCb_t)(void *inst_ptr, Ucs_Lld_RxMsg_t *msgs[], uint8_t count);
+
 /*! \brief  Notifies that the LLD no longer needs to access the Tx message object
  *  \param  inst_ptr    Reference to internal UNICENS handler
  *  \param  msg_ptr     Reference to the Tx message object which is no longer accessed
  *                      by the low-level driver
+ *  \note   If the macro \c UCS_ATOMIC_EVENTS is defined in ucs_cfg.h this function may be 
+ *          called from a different thread or interrupt context.
  */
 typedef void (*Ucs_Lld_TxReleaseCb_t)(void *inst_ptr, Ucs_Lld_TxMsg_t *msg_ptr);
 
@@ -150,6 +190,8 @@ typedef struct Ucs_Lld_Api_
     Ucs_Lld_RxFreeUnusedCb_t rx_free_unused_fptr;  /*!< \brief  Frees an unused Rx message object */
     Ucs_Lld_RxReceiveCb_t    rx_receive_fptr;      /*!< \brief  Pass an Rx message to the UNICENS library */
     Ucs_Lld_TxReleaseCb_t    tx_release_fptr;      /*!< \brief  Notifies that the LLD no longer needs to access the Tx message object */
+    Ucs_Lld_RxAllocateBatchCb_t rx_allocate_batch_fptr; /*!< \brief  Allocates several Rx message objects */
+    Ucs_Lld_RxReceiveBatchCb_t  rx_receive_batch_fptr;  /*!< \brief  Pass several Rx messages to the UNICENS library */
 
 } Ucs_Lld_Api_t;
 
@@ -193,7 +235,11 @@ typedef void (*Ucs_Lld_ResetInicCb_t)(void *lld_user_ptr);
 typedef void (*Ucs_Lld_RxMsgAvailableCb_t)(void *lld_user_ptr);
 
 /*! \brief      Callback function which is invoked to transmit a single message to the INIC
- *  \param      msg_ptr         Reference to a single Tx message.
+ *  \details    If \ref Ucs_Lld_Callbacks_t::tx_batch_enabled "tx_batch_enabled" is set, \c msg_ptr 
+ *              refers to the first message of a chain which is linked by 
+ *              \ref Ucs_Lld_TxMsg_t::custom_next_msg_ptr "custom_next_msg_ptr". The LLD may 
+ *              coalesce the whole chain into a single transfer.
+ *  \param      msg_ptr         Reference to a single Tx message or to the first message of a chain.
  *  \param      lld_user_ptr    User defined pointer which is provided in \ref Ucs_Lld_Callbacks_t structure.
  */
 typedef void (*Ucs_Lld_TxTransmitCb_t)(Ucs_Lld_TxMsg_t *msg_ptr, void *lld_user_ptr);
@@ -214,6 +260,12 @@ typedef struct Ucs_Lld_Callbacks_
     Ucs_Lld_StopCb_t           stop_fptr;          /*!< \brief    Callback function to stop/abort the transmission and reception of messages */
     Ucs_Lld_RxMsgAvailableCb_t rx_available_fptr;  /*!< \brief    Callback function which is invoked as soon as Rx message objects are available again */
     Ucs_Lld_TxTransmitCb_t     tx_transmit_fptr;   /*!< \brief    Callback function to transmit one or multiple messages to the INIC */
+    bool                       tx_batch_enabled;   /*!< \brief    Set to \c true if the LLD accepts a chain of Tx messages in one 
+                                                    *             call of \ref Ucs_Lld_Callbacks_t::tx_transmit_fptr "tx_transmit_fptr".
+                                                    *  \details   If enabled, every message FIFO forwards all data messages it is able to 
+                                                    *             transmit with the current credits in a single chain. The default 
+                                                    *             value is \c false, i.e. messages are forwarded one by one.
+                                                    */
 
 } Ucs_Lld_Callbacks_t;
 
@@ -56,8 +56,10 @@ extern "C"
 /*------------------------------------------------------------------------------------------------*/
 /* Macros                                                                                         */
 /*------------------------------------------------------------------------------------------------*/
-/*! \brief Number of LLD Tx handles dedicated to each FIFO */
+/*! \brief Number of built-in LLD Tx handles dedicated to each FIFO */
 #define LLDP_NUM_HANDLES              5U
+/*! \brief Maximum number of LLD Tx handles dedicated to each FIFO, i.e. the maximum number of INIC credits */
+#define LLDP_NUM_HANDLES_MAX          63U
 
 /*------------------------------------------------------------------------------------------------*/
 /* Internal types                                                                                 */
@@ -73,6 +75,9 @@ typedef struct Lld_IntTxMsg_
                                  *              \c NULL if the object is a command */
     void       *owner_ptr;      /*!< \brief     Points to the FIFO which owns the message object 
                                  *              or NULL if the object is a command */
+#ifdef UCS_ATOMIC_EVENTS
+    struct Lld_IntTxMsg_ *async_next_ptr;   /*!< \brief Link of the lock-free Tx release queue */
+#endif
 
 } Lld_IntTxMsg_t;
 
@@ -83,6 +88,9 @@ typedef struct Lld_IntRxMsg_
                                  *   \details   This attribute needs to be the first one in this structure
                                  */
     CMessage        *msg_ptr;   /*!< \brief     Reference to the associated common message object*/
+#ifdef UCS_ATOMIC_EVENTS
+    struct Lld_IntRxMsg_ *async_next_ptr;   /*!< \brief Link of the lock-free Rx queue */
+#endif
 
 } Lld_IntRxMsg_t;
 
@@ -90,16 +98,23 @@ typedef struct Lld_IntRxMsg_
 typedef struct CLldPool_
 { 
     CDlList list;                             /*!< \brief Points to the first available message in Tx pool */
-    Lld_IntTxMsg_t messages[LLDP_NUM_HANDLES];/*!< \brief Available messages in Tx pool */
+    Lld_IntTxMsg_t messages_default[LLDP_NUM_HANDLES];/*!< \brief Built-in messages of the Tx pool */
+    Lld_IntTxMsg_t *messages;                 /*!< \brief Messages of the Tx pool in use */
+    uint8_t size;                             /*!< \brief Number of messages in the Tx pool */
+    bool stalled;                             /*!< \brief Is \c true if the pool is exhausted since the last allocation attempt */
+    uint32_t stall_count;                     /*!< \brief Number of times the pool was exhausted */
 
 } CLldPool;
 
 /*------------------------------------------------------------------------------------------------*/
 /* Function prototypes                                                                            */
 /*------------------------------------------------------------------------------------------------*/
-extern void Lldp_Ctor(CLldPool *self, void *owner_ptr, void *ucs_user_ptr);
+extern void Lldp_Ctor(CLldPool *self, void *owner_ptr, void *mem_ptr, uint8_t size, void *ucs_user_ptr);
 extern void Lldp_ReturnTxToPool(CLldPool *self, Lld_IntTxMsg_t *msg_ptr);
 extern Lld_IntTxMsg_t* Lldp_GetTxFromPool(CLldPool *self);
+extern uint32_t Lldp_GetMemSize(uint8_t size);
+extern uint8_t Lldp_GetSize(CLldPool *self);
+extern uint32_t Lldp_GetStallCount(CLldPool *self);
 
 
 #ifdef __cplusplus
@@ -88,6 +88,19 @@ typedef struct CMessage_ CMessage;
  */
 typedef void (*Msg_TxStatusCb_t)(void *self, Msg_MostTel_t *tel_ptr, Ucs_MsgTxStatus_t status);
 
+/*! \brief   Transmission priority classes of a message
+ *  \details Each port message FIFO provides a separate Tx queue per priority class.
+ *           The value \c 0 denotes the highest priority.
+ */
+typedef enum Msg_TxPrio_
+{
+    MSG_TX_PRIO_BYPASS  = 0U,   /*!< \brief Message bypasses all other messages in the FIFO */
+    MSG_TX_PRIO_HIGH    = 1U,   /*!< \brief Control messages */
+    MSG_TX_PRIO_NORMAL  = 2U,   /*!< \brief Default priority */
+    MSG_TX_PRIO_LOW     = 3U    /*!< \brief Bulk transfers */
+
+} Msg_TxPrio_t;
+
 /*------------------------------------------------------------------------------------------------*/
 /* Macros                                                                                         */
 /*------------------------------------------------------------------------------------------------*/
@@ -98,6 +111,8 @@ typedef void (*Msg_TxStatusCb_t)(void *self, Msg_MostTel_t *tel_ptr, Ucs_MsgTxSt
 /*! \brief      Size in bytes of pre-allocated message buffer
  *  \details    Size = 24(header) + 45(payload) + 3(stuffing) = 72 */
 #define MSG_SIZE_RSVD_BUFFER  72U
+/*! \brief      Number of transmission priority classes, see Msg_TxPrio_t */
+#define MSG_NUM_TX_PRIO       4U
 
 /*------------------------------------------------------------------------------------------------*/
 /* Class CMessage                                                                                 */
@@ -129,7 +144,7 @@ struct CMessage_
     void               *tx_status_inst;         /*!< \brief  Reference to instance which needs Tx status notification */
 
     bool                tx_active;              /*!< \brief  Is \c true if the object is occupied by the LLD, otherwise \c false */
-    bool                tx_bypass;              /*!< \brief  Is \c true if a message was queued as bypass message */
+    Msg_TxPrio_t        tx_prio;                /*!< \brief  Priority class the message is queued with */
 
 };
 
@@ -164,10 +179,12 @@ extern CDlNode         *Msg_GetNode(CMessage *self);
 
 extern void             Msg_SetTxStatusHandler(CMessage *self, Msg_TxStatusCb_t callback_fptr, void *inst_ptr);
 extern void             Msg_SetExtPayload(CMessage *self, uint8_t *payload_ptr, uint8_t payload_sz, void* mem_info_ptr);
+extern Ucs_Mem_Buffer_t* Msg_GetRxSegment(CMessage *self);
+extern CMessage        *Msg_GetRxSegmentOwner(Ucs_Mem_Buffer_t *buffer_ptr);
 extern void             Msg_SetTxActive(CMessage *self, bool active);
 extern bool             Msg_IsTxActive(CMessage *self);
-extern void             Msg_SetTxBypass(CMessage *self, bool bypass);
-extern bool             Msg_IsTxBypass(CMessage *self);
+extern void             Msg_SetTxPrio(CMessage *self, Msg_TxPrio_t prio);
+extern Msg_TxPrio_t     Msg_GetTxPrio(CMessage *self);
 
 extern bool             Msg_VerifyContent(CMessage *self);
 
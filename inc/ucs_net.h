@@ -113,7 +113,7 @@ typedef struct Net_NetworkStatus_
     /*! \brief Subject to notify MOST Network Status the first time a observer has been added */
     CSubject pre_subject;
     /*! \brief Subject to notify MOST Network Status */
-    CSubject subject;
+    CMaskedSubject subject;
 
 } Net_NetworkStatus_t;
 
@@ -141,7 +141,7 @@ typedef struct Net_NetworkConfiguration_
     /*! \brief Subject to notify MOST Network Configuration the first time a observer has been added */
     CSubject pre_subject;
     /*! \brief Subject to notify MOST Network Configuration */
-    CSubject subject;
+    CMaskedSubject subject;
 
 } Net_NetworkConfiguration_t;
 
@@ -53,6 +53,15 @@ extern "C"
 {
 #endif
 
+/*------------------------------------------------------------------------------------------------*/
+/* Definitions                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Number of observer groups of a masked-subject. Masked-observers with the same 
+ *         notification mask share one group. If all groups are occupied, the last group takes 
+ *         the observers of all further masks.
+ */
+#define MSUB_NUM_GROUPS     6U
+
 /*------------------------------------------------------------------------------------------------*/
 /* Type definitions                                                                               */
 /*------------------------------------------------------------------------------------------------*/
@@ -142,6 +151,25 @@ typedef struct CMaskedObserver_
 
 } CMaskedObserver;
 
+/*! \brief Group of masked-observers of a masked-subject */
+typedef struct Msub_Group_
+{
+    CDlList list;                   /*!< \brief Masked-observers of the group */
+    uint32_t mask;                  /*!< \brief Union of the notification masks of the group */
+
+} Msub_Group_t;
+
+/*! \brief Class structure of masked-subjects. The masked-observers are indexed by their 
+ *         notification mask. A notification only visits the groups whose mask matches.
+ */
+typedef struct CMaskedSubject_
+{
+    CSubject parent;                        /*!< \brief Parent class instance, the list of the 
+                                             *          parent is not used */
+    Msub_Group_t groups[MSUB_NUM_GROUPS];   /*!< \brief Observer groups */
+
+} CMaskedSubject;
+
 /*------------------------------------------------------------------------------------------------*/
 /* Prototypes of class CSubject                                                                   */
 /*------------------------------------------------------------------------------------------------*/
@@ -181,11 +209,14 @@ extern void Mobs_SetNotificationMask(CMaskedObserver *self, uint32_t mask);
 extern uint32_t Mobs_GetNotificationMask(CMaskedObserver *self);
 
 /*------------------------------------------------------------------------------------------------*/
-/* Additional prototypes of class CSubject used in combination with CMaskedObserver               */
+/* Prototypes of class CMaskedSubject                                                             */
 /*------------------------------------------------------------------------------------------------*/
-extern Sub_Ret_t Msub_AddObserver(CSubject *self, CMaskedObserver *obs_ptr);
-extern Sub_Ret_t Msub_RemoveObserver(CSubject *self, CMaskedObserver *obs_ptr);
-extern void Msub_Notify(CSubject *self, void *data_ptr, uint32_t notification_mask);
+extern void Msub_Ctor(CMaskedSubject *self, void *ucs_user_ptr);
+extern Sub_Ret_t Msub_AddObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr);
+extern Sub_Ret_t Msub_RemoveObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr);
+extern void Msub_Notify(CMaskedSubject *self, void *data_ptr, uint32_t notification_mask);
+extern uint8_t Msub_GetNumObservers(CMaskedSubject *self);
+extern Sub_Ret_t Msub_SwitchObservers(CMaskedSubject *sub_target, CSubject *sub_source);
 
 #ifdef __cplusplus
 }   /* extern "C" */
@@ -64,6 +64,10 @@ extern "C"
 
 #define PMCH_MCM_CREDITS_OPT        21U  /*!< \brief Optimal number of credits configured for MCM FIFO */
 #define PMCH_MCM_THRESHOLD_OPT      8U   /*!< \brief Optimal threshold configured for MCM FIFO */
+#define PMCH_MCM_THRESHOLD_MIN_OPT  4U   /*!< \brief Lower bound of the adaptive threshold of the MCM FIFO */
+#define PMCH_MCM_THRESHOLD_MAX_OPT  16U  /*!< \brief Upper bound of the adaptive threshold of the MCM FIFO */
+#define PMCH_MCM_ACK_DELAY_MIN      2U   /*!< \brief Lower bound of the delayed acknowledge time of the MCM FIFO in ms */
+#define PMCH_MCM_ACK_DELAY_MAX      8U   /*!< \brief Upper bound of the delayed acknowledge time of the MCM FIFO in ms */
 
 #define PMCH_FIFO_CREDITS_OPT       5U   /*!< \brief Optimal number of credits configured for conventional FIFOs */
 #define PMCH_FIFO_THRESHOLD_OPT     4U   /*!< \brief Optimal threshold configured for conventional FIFO */
@@ -94,6 +98,8 @@ extern "C"
 # define PMCH_MCM_CREDITS           (PMCH_FIFO_CREDITS_MIN)
 # define PMCH_FIFO_CREDITS          (PMCH_FIFO_CREDITS_MIN)
 # define PMCH_MCM_THRESHOLD         (PMCH_FIFO_THRESHOLD_MIN)
+# define PMCH_MCM_THRESHOLD_MIN     (PMCH_FIFO_THRESHOLD_MIN)
+# define PMCH_MCM_THRESHOLD_MAX     (PMCH_FIFO_THRESHOLD_MIN)
 # define PMCH_FIFO_THRESHOLD        (PMCH_FIFO_THRESHOLD_MIN)
 # define MNSL_CHANNEL_POOL_SIZE_RX  (PMCH_POOL_SIZE_RX_MIN)
 #elif defined MNSL_CHANNEL_POOL_SIZE_RX
@@ -101,12 +107,16 @@ extern "C"
 # define PMCH_MCM_CREDITS           (PMCH_FIFO_CREDITS_MIN)
 # define PMCH_FIFO_CREDITS          (PMCH_FIFO_CREDITS_MIN)
 # define PMCH_MCM_THRESHOLD         (PMCH_FIFO_THRESHOLD_MIN)
+# define PMCH_MCM_THRESHOLD_MIN     (PMCH_FIFO_THRESHOLD_MIN)
+# define PMCH_MCM_THRESHOLD_MAX     (PMCH_FIFO_THRESHOLD_MIN)
 # define PMCH_FIFO_THRESHOLD        (PMCH_FIFO_THRESHOLD_MIN)
 #else
 # define PMCH_POOL_SIZE_RX          (PMCH_POOL_SIZE_RX_OPT)
 # define PMCH_MCM_CREDITS           (PMCH_MCM_CREDITS_OPT)
 # define PMCH_FIFO_CREDITS          (PMCH_FIFO_CREDITS_OPT)
 # define PMCH_MCM_THRESHOLD         (PMCH_MCM_THRESHOLD_OPT)
+# define PMCH_MCM_THRESHOLD_MIN     (PMCH_MCM_THRESHOLD_MIN_OPT)
+# define PMCH_MCM_THRESHOLD_MAX     (PMCH_MCM_THRESHOLD_MAX_OPT)
 # define PMCH_FIFO_THRESHOLD        (PMCH_FIFO_THRESHOLD_OPT)
 # define MNSL_CHANNEL_POOL_SIZE_RX  (PMCH_POOL_SIZE_RX_OPT)
 #endif
@@ -123,9 +133,28 @@ typedef struct Pmch_InitData_
     void *ucs_user_ptr;         /*!< \brief User reference that needs to be passed in every callback function */
     Ucs_Lld_Callbacks_t lld_iface;              /*!< \brief LLD callback functions */
     Pmch_OnTxRelease_t tx_release_fptr;         /*!< \brief Callback which releases a FIFO dedicated LLD buffer */
+    CBase *base_ptr;                            /*!< \brief Reference to base instance */
+    void *rx_pool_mem_ptr;                      /*!< \brief Optional memory of the Rx pool or \c NULL to use 
+                                                 *          the built-in pool of \ref PMCH_POOL_SIZE_RX messages. 
+                                                 *          Mandatory if \c UCS_LLD_RX_POOL_EXTERNAL is defined. */
+    uint16_t rx_pool_size;                      /*!< \brief Number of messages fitting in \c rx_pool_mem_ptr */
 
 } Pmch_InitData_t;
 
+/*! \brief  Snapshot of the Rx pool statistics */
+typedef struct Pmch_RxPoolStats_
+{
+    uint16_t size;                              /*!< \brief Number of messages in the Rx pool */
+    uint16_t available;                         /*!< \brief Number of currently available messages */
+    uint16_t low_water_mark;                    /*!< \brief Minimum number of available messages */
+    uint32_t alloc_failures;                    /*!< \brief Number of failed allocations */
+    uint32_t stall_count;                       /*!< \brief Number of times the LLD was notified by
+                                                 *          \c rx_available_fptr() */
+    uint32_t total_stall_time;                  /*!< \brief Accumulated time the LLD waited for messages */
+    uint32_t max_stall_time;                    /*!< \brief Maximum time the LLD waited for messages */
+
+} Pmch_RxPoolStats_t;
+
 /*! \brief  Combination of callback and instance for a receiving FIFO */
 typedef struct Pmch_Receiver_
 {
@@ -142,16 +171,48 @@ typedef struct CPmChannel_
 { 
     Pmch_InitData_t init_data;                      /*!< \brief Copy of initialization data */
 
-    Lld_IntRxMsg_t  lld_rx_msgs[PMCH_POOL_SIZE_RX]; /*!< \brief Pre-allocated LLD Rx message objects */
-    CMessage        rx_msgs[PMCH_POOL_SIZE_RX];     /*!< \brief Pre-allocated Rx message objects */
+#ifndef UCS_LLD_RX_POOL_EXTERNAL
+    Lld_IntRxMsg_t  lld_rx_msgs_default[PMCH_POOL_SIZE_RX]; /*!< \brief Pre-allocated LLD Rx message objects */
+    CMessage        rx_msgs_default[PMCH_POOL_SIZE_RX];     /*!< \brief Pre-allocated Rx message objects */
+#endif
+    Lld_IntRxMsg_t *lld_rx_msgs;                    /*!< \brief LLD Rx message objects in use */
+    CMessage       *rx_msgs;                        /*!< \brief Rx message objects in use */
+    uint16_t        rx_pool_size;                   /*!< \brief Number of Rx message objects in use */
+#ifdef UCS_ATOMIC_EVENTS
+    CLfPool         rx_msgs_pool;                   /*!< \brief Pre-allocated Rx message pool, the LLD may 
+                                                     *          allocate from its own thread */
+    atomic_bool     rx_trigger_available;           /*!< \brief Triggers LLD callback function if a buffer
+                                                     *          is available again.
+                                                     */
+    atomic_uint_least16_t rx_low_water_mark;        /*!< \brief Minimum number of available Rx messages */
+    atomic_uint_least32_t rx_alloc_failures;        /*!< \brief Number of failed Rx allocations */
+    atomic_uint_least32_t rx_stall_count;           /*!< \brief Number of Rx message available notifications */
+#else
     CPool           rx_msgs_pool;                   /*!< \brief Pre-allocated Rx message pool */
     bool            rx_trigger_available;           /*!< \brief Triggers LLD callback function if a buffer
                                                      *          is available again.
                                                      */
+    uint16_t        rx_low_water_mark;              /*!< \brief Minimum number of available Rx messages */
+    uint32_t        rx_alloc_failures;              /*!< \brief Number of failed Rx allocations */
+    uint32_t        rx_stall_count;                 /*!< \brief Number of Rx message available notifications */
+    Tm_Tick_t       rx_stall_start;                 /*!< \brief Tick count when the LLD started to wait for messages */
+    uint32_t        rx_total_stall_time;            /*!< \brief Accumulated time the LLD waited for messages */
+    uint32_t        rx_max_stall_time;              /*!< \brief Maximum time the LLD waited for messages */
+#endif
+    uint16_t        rx_detached_cnt;                /*!< \brief Number of Rx messages which are retained by 
+                                                     *          receivers after their credit was released */
+    uint16_t        rx_detached_max;                /*!< \brief Upper limit of \c rx_detached_cnt, the remaining
+                                                     *          Rx messages are kept for other traffic */
     bool            lld_active;                     /*!< \brief Determines whether the LLD is running */
     Ucs_Lld_Api_t   ucs_iface;                      /*!< \brief PMS function pointers */
 
     Pmch_Receiver_t receivers[PMP_MAX_NUM_FIFOS];   /*!< \brief Registered FIFOs for Rx */
+#ifdef UCS_ATOMIC_EVENTS
+    CService        service;                        /*!< \brief Service which dispatches messages handed 
+                                                     *          over by the LLD from another thread */
+    _Atomic(Lld_IntRxMsg_t*) rx_async_head;         /*!< \brief Lock-free LIFO of received messages */
+    _Atomic(Lld_IntTxMsg_t*) tx_async_head;         /*!< \brief Lock-free LIFO of released Tx messages */
+#endif
 
 } CPmChannel;
 
@@ -165,7 +226,14 @@ extern void Pmch_Initialize(CPmChannel *self);
 extern void Pmch_Uninitialize(CPmChannel *self);
 extern void Pmch_RegisterReceiver(CPmChannel *self, Pmp_FifoId_t fifo_id, Pmch_OnRxMsg_t rx_fptr, void *inst_ptr);
 extern void Pmch_Transmit(CPmChannel *self, Ucs_Lld_TxMsg_t *msg_ptr);
+extern void Pmch_TransmitChain(CPmChannel *self, Ucs_Lld_TxMsg_t *msg_ptr);
+extern bool Pmch_IsLldActive(CPmChannel *self);
+extern bool Pmch_IsTxBatchEnabled(CPmChannel *self);
 extern void Pmch_ReturnRxToPool(void *self, CMessage *msg_ptr);
+extern bool Pmch_DetachRx(CPmChannel *self);
+extern void Pmch_ReturnDetachedRxToPool(CPmChannel *self, CMessage *msg_ptr);
+extern uint32_t Pmch_GetRxPoolMemSize(uint16_t size);
+extern void Pmch_GetRxPoolStats(CPmChannel *self, Pmch_RxPoolStats_t *stats_ptr);
 
 #ifdef __cplusplus
 }                                               /* extern "C" */
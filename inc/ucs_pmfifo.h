@@ -58,12 +58,6 @@ extern "C"
 {
 #endif
 
-/*------------------------------------------------------------------------------------------------*/
-/* Macros                                                                                         */
-/*------------------------------------------------------------------------------------------------*/
-/*! \brief Number of LLD Tx handles dedicated to each FIFO */
-#define FIFO_TX_HANDLES     5U
-
 /*------------------------------------------------------------------------------------------------*/
 /* Types                                                                                          */
 /*------------------------------------------------------------------------------------------------*/
@@ -73,6 +67,24 @@ extern "C"
  */
 typedef void (*Fifo_OnRxMsg_t)(void *self, CMessage *msg_ptr);
 
+/*! \brief  Acknowledge statistics of the Rx direction of a FIFO */
+typedef struct Fifo_RxAckStats_
+{
+    uint32_t data_msgs;                 /*!< \brief Number of received data messages */
+    uint32_t status_msgs;               /*!< \brief Number of transmitted Rx status messages */
+    uint8_t  ack_threshold;             /*!< \brief Current acknowledge threshold */
+    uint16_t ack_delay;                 /*!< \brief Current delayed acknowledge time in ms, or 0 if not used */
+
+} Fifo_RxAckStats_t;
+
+/*! \brief  Statistics of the Tx window of a FIFO */
+typedef struct Fifo_TxWindowStats_
+{
+    uint8_t  size;                      /*!< \brief Number of LLD Tx handles, i.e. maximum number of messages in flight */
+    uint32_t stalls;                    /*!< \brief Number of times the transmission stalled since no LLD Tx handle was free */
+
+} Fifo_TxWindowStats_t;
+
 /*------------------------------------------------------------------------------------------------*/
 /* Structures                                                                                     */
 /*------------------------------------------------------------------------------------------------*/
@@ -86,6 +98,9 @@ typedef struct Fifo_InitData_
     IEncoder           *rx_encoder_ptr; /*!< \brief Encoder for Rx messages */
     Fifo_OnRxMsg_t      rx_cb_fptr;     /*!< \brief Callback function invoked for Rx */
     void               *rx_cb_inst;     /*!< \brief Instance which is referred when invoking rx_cb_fptr */
+    void               *tx_handles_ptr; /*!< \brief Optional memory of the LLD Tx handles or \c NULL to use
+                                         *          the built-in handles. See Lldp_GetMemSize(). */
+    uint8_t             tx_handles_size;/*!< \brief Number of LLD Tx handles fitting in \c tx_handles_ptr */
 
 } Fifo_InitData_t;
 
@@ -108,6 +123,17 @@ typedef struct Fifo_Config_
     uint16_t        tx_wd_timer_value;  /*!< \brief Timer value used to trigger the watchdog in ms */
     uint8_t         rx_ack_timeout;     /*!< \brief Rx status timeout in x100ms. */
     uint8_t         rx_busy_allowed;    /*!< \brief Number of allowed RxStatus busy responds. 0..14, or 0xF (infinite) */
+    uint8_t         rx_threshold_min;   /*!< \brief Lower bound of the adaptive acknowledge threshold.
+                                         *   \details The adaptive acknowledge policy is enabled if 
+                                         *            \c rx_threshold_max is greater than \c rx_threshold_min
+                                         *            and \c rx_ack_delay_max is not 0. Otherwise \c rx_threshold
+                                         *            is used as static threshold.
+                                         */
+    uint8_t         rx_threshold_max;   /*!< \brief Upper bound of the adaptive acknowledge threshold. 
+                                         *          The value needs to be smaller or equal than \c rx_credits.
+                                         */
+    uint16_t        rx_ack_delay_min;   /*!< \brief Lower bound of the adaptive delayed acknowledge time in ms */
+    uint16_t        rx_ack_delay_max;   /*!< \brief Upper bound of the adaptive delayed acknowledge time in ms */
 
 } Fifo_Config_t;
 
@@ -161,6 +187,14 @@ typedef struct CPmFifo_
         uint8_t expected_sid;                   /*!< \brief The next expected Rx message SeqId */
         uint8_t busy_num;                       /*!< \brief The number of currently processing data messages */
 
+        bool adaptive;                          /*!< \brief Is \c true if the adaptive acknowledge policy is enabled */
+        CTimer ack_timer;                       /*!< \brief Triggers a delayed acknowledge if the threshold is not reached */
+        uint16_t ack_delay;                     /*!< \brief Current delayed acknowledge time in ms */
+        uint16_t avg_interval;                  /*!< \brief Smoothed interval between two data messages in ms */
+        Tm_Tick_t last_arrival;                 /*!< \brief Time stamp of the latest data message */
+        uint32_t data_msgs;                     /*!< \brief Number of received data messages */
+        uint32_t status_msgs;                   /*!< \brief Number of transmitted Rx status messages */
+
         bool wait_processing;                   /*!< \brief If set: Wait until transmission of e.g. NACK has finished 
                                                  *          before continuing with further Rx message processing.
                                                  *          The flag is used if a status must be sent explicitly.
@@ -171,7 +205,10 @@ typedef struct CPmFifo_
 
     struct CPmFifo_tx_
     {
-        CDlList waiting_queue;                  /*!< \brief Queue containing all outgoing messages */
+        CDlList waiting_queues[MSG_NUM_TX_PRIO];/*!< \brief Queues containing all outgoing messages, one per priority class */
+        uint8_t prio_served[MSG_NUM_TX_PRIO];   /*!< \brief Number of messages a weighted priority class has sent
+                                                 *          in a row while lower priority messages were waiting
+                                                 */
         CDlList pending_q;                      /*!< \brief Queue containing all messages waiting for Tx status */
         IEncoder *encoder_ptr;                  /*!< \brief Encoder for Tx messages */
         uint8_t credits;                        /*!< \brief Remaining Tx credits */
@@ -217,9 +254,13 @@ extern void Fifo_RemoveStateObserver(CPmFifo *self, CObserver *obs_ptr);
 
 /* Rx interface */
 extern void Fifo_RxReleaseMsg(CPmFifo *self, CMessage *msg_ptr);
+extern bool Fifo_RxDetachMsg(CPmFifo *self, CMessage *msg_ptr);
+extern void Fifo_RxReleaseDetachedMsg(CPmFifo *self, CMessage *msg_ptr);
+extern void Fifo_GetRxAckStats(CPmFifo *self, Fifo_RxAckStats_t *stats_ptr);
+extern void Fifo_GetTxWindowStats(CPmFifo *self, Fifo_TxWindowStats_t *stats_ptr);
 
 /* Tx interface */
-extern void Fifo_Tx(CPmFifo *self, CMessage *msg_ptr, bool bypass);
+extern void Fifo_Tx(CPmFifo *self, CMessage *msg_ptr);
 extern void Fifo_TxOnRelease(void *self, Ucs_Lld_TxMsg_t *handle_ptr);
 
 #ifdef __cplusplus
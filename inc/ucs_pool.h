@@ -44,6 +44,9 @@
 /*------------------------------------------------------------------------------------------------*/
 #include "ucs_message.h"
 #include "ucs_dl.h"
+#ifdef UCS_ATOMIC_EVENTS
+# include <stdatomic.h>
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -72,6 +75,30 @@ extern CMessage* Pool_GetMsg(CPool *self);
 extern void Pool_ReturnMsg(CMessage *msg_ptr);
 extern uint16_t Pool_GetCurrentSize(CPool *self);
 
+#ifdef UCS_ATOMIC_EVENTS
+/*------------------------------------------------------------------------------------------------*/
+/* Class CLfPool                                                                                  */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief   Lock-free message pool
+ *  \details Messages are kept in a lock-free LIFO which is linked by the list node of the
+ *           messages. Messages can be returned from any number of threads. Messages must be 
+ *           retrieved by one thread at a time only, which avoids the ABA problem of the LIFO.
+ */
+typedef struct CLfPool_
+{
+    uint16_t    initial_size;       /*!< \brief The size of a provided message array */
+    _Atomic(CDlNode*) head;         /*!< \brief Reference to the first available message */
+    atomic_uint_least16_t size;     /*!< \brief Current number of available messages */
+    void *ucs_user_ptr;             /*!< \brief User reference that needs to be passed in every callback function */
+
+} CLfPool;
+
+extern void Lfp_Ctor(CLfPool *self, CMessage messages[], uint16_t size, void *ucs_user_ptr);
+extern CMessage* Lfp_GetMsg(CLfPool *self);
+extern void Lfp_ReturnMsg(CLfPool *self, CMessage *msg_ptr);
+extern uint16_t Lfp_GetCurrentSize(CLfPool *self);
+#endif
+
 #ifdef __cplusplus
 }                                                   /* extern "C" */
 #endif
@@ -51,6 +51,7 @@
  *  \details    If this macro is defined the following changes apply:
  *              - Reduction of low-level buffers
  *              - AMS does not support segmentation (payload > 45 bytes)
+ *              - Timer management uses a delta list instead of a timer wheel
  *              . 
  */
 #ifndef UCS_FOOTPRINT_TINY
@@ -59,6 +60,7 @@
 # define AMS_FOOTPRINT_TINY
 # define MNSL_FOOTPRINT_TINY
 # define SMM_FOOTPRINT_TINY
+# define TM_FOOTPRINT_TINY
 #endif
 
 #endif /* UCS_SHARED_CONFIG_H */
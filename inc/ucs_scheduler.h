@@ -47,6 +47,9 @@
 #include "ucs_rules.h"
 #include "ucs_dl.h"
 #include "ucs_obs.h"
+#ifdef UCS_ATOMIC_EVENTS
+# include <stdatomic.h>
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -65,11 +68,46 @@ typedef void (*Srv_Cb_t)(void *self);
 /*! \brief Data type of event masks */
 typedef uint32_t Srv_Event_t;
 
+#ifdef UCS_PROF_GET_TIME
+/*! \brief Execution statistics of a service. Times are measured in units of UCS_PROF_GET_TIME(). */
+typedef struct Srv_Stats_
+{
+    const char *name_str;           /*!< \brief Name of the service */
+    uint8_t priority;               /*!< \brief Priority of the service */
+    uint32_t invocations;           /*!< \brief Number of service callback invocations */
+    uint32_t total_time;            /*!< \brief Accumulated execution time */
+    uint32_t max_time;              /*!< \brief Maximum execution time of a single invocation */
+    uint32_t total_dwell_time;      /*!< \brief Accumulated time between becoming ready and execution */
+    uint32_t max_dwell_time;        /*!< \brief Maximum time between becoming ready and execution */
+
+} Srv_Stats_t;
+
+/*! \brief Function signature used to process the execution statistics of a service
+ *  \param self        Instance pointer
+ *  \param stats_ptr   Reference to the statistics of the service
+ *  \return true: Stop the iteration
+ *  \return false: Continue with the next service
+ */
+typedef bool (*Scd_StatsCb_t)(void *self, const Srv_Stats_t *stats_ptr);
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Definitions                                                                                    */
 /*------------------------------------------------------------------------------------------------*/
 extern const Srv_Event_t SRV_EMPTY_EVENT_MASK;  /*!< \brief Empty event mask */
 
+/*! \def   SRV_SET_NAME
+ *  \brief Assigns a name to a service which is reported by the execution statistics. 
+ *         The macro is empty if UCS_PROF_GET_TIME is not defined.
+ */
+#ifdef UCS_PROF_GET_TIME
+# define SRV_SET_NAME(srv_ptr, name)    ((srv_ptr)->stats.name_str = (name))
+#else
+# define SRV_SET_NAME(srv_ptr, name)
+#endif
+/*! \brief Budget value of Scd_ServiceBudget() which executes all ready services */
+#define SCD_UNLIMITED_BUDGET    0U
+
 /*------------------------------------------------------------------------------------------------*/
 /* Enumerators                                                                                    */
 /*------------------------------------------------------------------------------------------------*/
@@ -102,8 +140,21 @@ typedef struct CScheduler_
     CSingleSubject service_request_subject;
     /*! \brief Service list of the scheduler */
     CDlList srv_list;
+    /*! \brief List of services with pending events, arranged in priority order */
+    CDlList ready_list;
+    /*! \brief Reference to the service which is currently executed by Scd_Service() */
+    struct CService_ *current_srv_ptr;
     /*! \brief Indicates if the scheduler services is running */
     bool scd_srv_is_running;
+    /*! \brief Indicates that service requests are collected instead of being notified immediately */
+    bool request_deferred;
+    /*! \brief Indicates that a service request was collected while requests are deferred */
+    bool request_pending;
+#ifdef UCS_ATOMIC_EVENTS
+    /*! \brief Indicates that at least one service has pending events which were set by 
+     *         Srv_SetEventAsync() and are not yet transferred to the ready list */
+    atomic_bool async_pending;
+#endif
     /*! \brief UNICENS instance ID */
     void * ucs_user_ptr;
 
@@ -112,12 +163,20 @@ typedef struct CScheduler_
 /*! \brief   Class structure of services used by the scheduler. */
 typedef struct CService_
 {
-    CDlNode list_node;              /*!< \brief Administration area for the linked list */
+    CDlNode list_node;              /*!< \brief Administration area for the linked list. Must be the first attribute. */
+    CDlNode ready_node;             /*!< \brief Administration area for the list of ready services */
     CScheduler *scd_ptr;            /*!< \brief Back link to scheduler */
     void *instance_ptr;             /*!< \brief Reference of instance passed to service_fptr() */
     Srv_Cb_t service_fptr;          /*!< \brief Reference of the service callback function */
     Srv_Event_t event_mask;         /*!< \brief Event mask of the service */
+#ifdef UCS_ATOMIC_EVENTS
+    _Atomic Srv_Event_t async_event_mask; /*!< \brief Events set by Srv_SetEventAsync() */
+#endif
     uint8_t priority;               /*!< \brief Priority of the service */
+#ifdef UCS_PROF_GET_TIME
+    uint32_t ready_time;            /*!< \brief Time stamp when the service has become ready */
+    Srv_Stats_t stats;              /*!< \brief Execution statistics */
+#endif
 
 } CService;
 
@@ -126,15 +185,24 @@ typedef struct CService_
 /*------------------------------------------------------------------------------------------------*/
 extern void Scd_Ctor(CScheduler *self, Scd_InitData_t *init_ptr, void *ucs_user_ptr);
 extern void Scd_Service(CScheduler *self);
+extern void Scd_ServiceBudget(CScheduler *self, uint16_t max_services);
 extern Scd_Ret_t Scd_AddService(CScheduler *self, CService *srv_ptr);
 extern Scd_Ret_t Scd_RemoveService(CScheduler *self, CService *srv_ptr);
 extern bool Scd_AreEventsPending(CScheduler *self);
+extern void Scd_DeferRequest(CScheduler *self);
+extern void Scd_ReleaseRequest(CScheduler *self);
+#ifdef UCS_PROF_GET_TIME
+extern void Scd_GetServiceStats(CScheduler *self, Scd_StatsCb_t stats_fptr, void *inst_ptr);
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Prototypes of class CService                                                                   */
 /*------------------------------------------------------------------------------------------------*/
 extern void Srv_Ctor(CService *self, uint8_t priority, void *instance_ptr, Srv_Cb_t service_fptr);
 extern void Srv_SetEvent(CService *self, Srv_Event_t event_mask);
+#ifdef UCS_ATOMIC_EVENTS
+extern void Srv_SetEventAsync(CService *self, Srv_Event_t event_mask);
+#endif
 extern void Srv_GetEvent(CService *self, Srv_Event_t *event_mask_ptr);
 extern void Srv_ClearEvent(CService *self, Srv_Event_t event_mask);
 
@@ -90,7 +90,9 @@ typedef enum Segm_Error_
 typedef enum Segm_Result_
 {
     SEGM_RES_OK,        /*!< \brief Telegram was processed */
-    SEGM_RES_RETRY      /*!< \brief Telegram shall be processed again as soon as messages are freed to the Rx pool */
+    SEGM_RES_RETRY,     /*!< \brief Telegram shall be processed again as soon as messages are freed to the Rx pool */
+    SEGM_RES_KEPT       /*!< \brief Telegram was processed and is kept as payload segment of an Rx message.
+                         *           It must not be released by the caller. */
 
 } Segm_Result_t;
 
@@ -119,6 +121,8 @@ typedef struct CSegmentation_
     CTimer                       gc_timer;              /*!< \brief  Timer to trigger the garbage collector */
     uint16_t                     rx_default_payload_sz; /*!< \brief  Payload size that shall be allocated if size-prefixes
                                                          *           segmentation message is missing */
+    bool                         rx_zero_copy;          /*!< \brief  If \c true the received telegrams of segmented 
+                                                         *           messages are kept as payload segments */
 
 } CSegmentation;
 
@@ -128,6 +132,7 @@ typedef struct CSegmentation_
 extern void Segm_Ctor(CSegmentation *self, CBase *base_ptr, CAmsMsgPool *pool_ptr, uint16_t rx_def_payload_sz);
 extern void Segm_AssignRxErrorHandler(CSegmentation *self, Segm_OnError_t error_fptr, void *error_inst);
 extern void Segm_Cleanup(CSegmentation *self);
+extern void Segm_RxSetZeroCopy(CSegmentation *self, bool enabled);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Public method prototypes                                                                       */
@@ -135,6 +140,7 @@ extern void Segm_Cleanup(CSegmentation *self);
 extern bool Segm_TxBuildSegment(CSegmentation *self, Ucs_AmsTx_Msg_t *msg_ptr, Msg_MostTel_t *tel_ptr);
 extern Ucs_AmsRx_Msg_t* Segm_RxExecuteSegmentation(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
 extern void Segm_RxGcScanProcessingHandles(void *self);
+extern void Segm_RxFreePayload(CSegmentation *self, Ucs_AmsRx_Msg_t *msg_ptr);
 
 #ifdef __cplusplus
 }               /* extern "C" */
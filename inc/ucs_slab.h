@@ -0,0 +1,118 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \file
+ * \brief Header file of the class CSlabMemoryManager.
+ * \cond UCS_INTERNAL_DOC
+ * \addtogroup G_UCS_SLAB_CLASS
+ * @{
+ */
+
+#ifndef UCS_SLAB_H
+#define UCS_SLAB_H
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include "ucs_rules.h"
+#include "ucs_ret_pb.h"
+#include "ucs_amsallocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/* Macros                                                                                         */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Number of size classes */
+#define SLAB_NUM_CLASSES    5U
+
+/*------------------------------------------------------------------------------------------------*/
+/* Type definitions                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Header of an unused memory block. The header is overwritten as soon as the block 
+ *         is allocated.
+ */
+typedef struct Slab_FreeBlock_
+{
+    struct Slab_FreeBlock_ *next_ptr;   /*!< \brief Next unused block of the same size class */
+
+} Slab_FreeBlock_t;
+
+/*! \brief Descriptor of one size class */
+typedef struct Slab_Class_
+{
+    Slab_FreeBlock_t *free_ptr;         /*!< \brief List of unused blocks */
+    uint8_t *area_ptr;                  /*!< \brief Start of the arena partition which is not yet carved */
+    uint32_t area_remaining;            /*!< \brief Number of bytes of the partition which are not yet carved */
+    uint32_t num_blocks;                /*!< \brief Number of blocks carved from the partition */
+    uint32_t num_free;                  /*!< \brief Number of unused blocks */
+    uint16_t block_size;                /*!< \brief The size of all blocks of this class */
+
+} Slab_Class_t;
+
+/*------------------------------------------------------------------------------------------------*/
+/* Class definitions                                                                              */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Structure of the class CSlabMemoryManager. */
+typedef struct CSlabMemoryManager_
+{
+    Slab_Class_t classes[SLAB_NUM_CLASSES]; /*!< \brief Size classes, see SLAB_BLOCK_SIZES */
+    uint8_t *arena_ptr;                 /*!< \brief Start of the arena */
+    uint32_t arena_size;                /*!< \brief Size of the arena in bytes */
+
+    void *ucs_user_ptr;                 /*!< \brief User reference that needs to be passed in every callback function */
+
+} CSlabMemoryManager;
+
+/*------------------------------------------------------------------------------------------------*/
+/* Prototypes of class CSlabMemoryManager                                                         */
+/*------------------------------------------------------------------------------------------------*/
+extern void Slab_Ctor(CSlabMemoryManager *self, void *arena_ptr, uint32_t arena_size, void *ucs_user_ptr);
+extern Ucs_Return_t Slab_LoadPlugin(CSlabMemoryManager *self, Ams_MemAllocator_t *allocator_ptr, uint16_t rx_def_payload_size);
+
+#ifdef __cplusplus
+}   /* extern "C" */
+#endif
+
+#endif  /* #ifndef UCS_SLAB_H */
+
+/*!
+ * @}
+ * \endcond
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+
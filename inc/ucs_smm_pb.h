@@ -79,6 +79,20 @@ extern "C"
 #  endif
 #endif
 
+/*! \def     UCS_AMS_NUM_RSVD_RX_MSGS
+ *  \brief   Defines the number of Rx message objects which are pre-allocated for single telegram
+ *           messages and used if no further Rx message object is available. The objects are 
+ *           taken from the Rx message objects defined by UCS_AMS_NUM_RX_MSGS.
+ *           Valid values: 1..(UCS_AMS_NUM_RX_MSGS - 1). Default value: 1.
+ */
+#ifndef UCS_AMS_NUM_RSVD_RX_MSGS
+#   define UCS_AMS_NUM_RSVD_RX_MSGS  1
+#else
+#  if (UCS_AMS_NUM_RSVD_RX_MSGS < 1) || (UCS_AMS_NUM_RSVD_RX_MSGS >= UCS_AMS_NUM_RX_MSGS)
+#    error "UCS_AMS_NUM_RSVD_RX_MSGS is not properly defined. Choose a value between: 1 and (UCS_AMS_NUM_RX_MSGS - 1)."
+#  endif
+#endif
+
 /*! \def     UCS_AMS_NUM_TX_MSGS
  *  \brief   Defines the number of reserved Tx message objects.
  *           Valid values: 5..255. Default value: 20.
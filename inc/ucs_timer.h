@@ -52,6 +52,39 @@ extern "C"
 {
 #endif
 
+/*------------------------------------------------------------------------------------------------*/
+/* Definitions                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+/*! \def     TM_TICK_MAX
+ *  \brief   Maximum value of a tick count or time period of the timer management
+ */
+#ifdef UCS_TICK_COUNT_32BIT
+# define TM_TICK_MAX            0xFFFFFFFFU
+#else
+# define TM_TICK_MAX            0xFFFFU
+#endif
+
+/*! \def     TM_TIMEOUT_MAX
+ *  \brief   Maximum elapse time, period and slack of a timer in milliseconds. Greater values are 
+ *           limited to this value. The timer wheel compares points in time by the sign of their 
+ *           difference, which requires that the expiry time plus slack lies less than 2^31 
+ *           milliseconds ahead. With a 16 bit tick count the limit is never reached.
+ */
+#ifdef UCS_TICK_COUNT_32BIT
+# define TM_TIMEOUT_MAX         0x3FFFFFFFU
+#else
+# define TM_TIMEOUT_MAX         0xFFFFU
+#endif
+
+#ifndef TM_FOOTPRINT_TINY
+/*! \brief Number of levels of the hierarchical timer wheel */
+# define TM_WHEEL_LEVELS        4U
+/*! \brief Number of bits which are used to address a slot within one level */
+# define TM_WHEEL_SLOT_BITS     5U
+/*! \brief Number of slots per level of the timer wheel */
+# define TM_WHEEL_SLOTS         (1U << TM_WHEEL_SLOT_BITS)
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Types                                                                                          */
 /*------------------------------------------------------------------------------------------------*/
@@ -60,6 +93,15 @@ extern "C"
  */
 typedef void (*Tm_Handler_t)(void *args);
 
+/*! \brief Data type of tick counts and time periods in milliseconds. The width is 32 bit if 
+ *         \ref UCS_TICK_COUNT_32BIT is defined, otherwise 16 bit. 
+ */
+#ifdef UCS_TICK_COUNT_32BIT
+typedef uint32_t Tm_Tick_t;
+#else
+typedef uint16_t Tm_Tick_t;
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Structures                                                                                     */
 /*------------------------------------------------------------------------------------------------*/
@@ -85,11 +127,26 @@ typedef struct CTimer_
     /*! \brief Reference to optional parameter */
     void *args_ptr;
     /*! \brief The Timeout value before the timer expires for the first time, in milliseconds */
-    uint16_t elapse;
+    Tm_Tick_t elapse;
     /*! \brief The period of the timer, in milliseconds */
-    uint16_t period;
+    Tm_Tick_t period;
+    /*! \brief Tolerated delay of the timer expiry, in milliseconds */
+    Tm_Tick_t slack;
+#ifdef TM_FOOTPRINT_TINY
     /*! \brief Delta time related to next timer in list */
-    uint16_t delta;
+    Tm_Tick_t delta;
+    /*! \brief Delay of the current expiry behind the nominal expiry time */
+    Tm_Tick_t late;
+#else
+    /*! \brief Absolute expiry time in ticks of the timer wheel */
+    uint32_t expiry;
+    /*! \brief Reference to the list (wheel slot or list of expired timers) the timer is part of */
+    CDlList *list_ptr;
+    /*! \brief Wheel level of the slot the timer is part of */
+    uint8_t level;
+    /*! \brief Index of the slot within the wheel level */
+    uint8_t slot;
+#endif
     /*! \brief Flag which signals that the timer is in use */
     bool in_use;
     /*! \brief Flag to check if timer object has changed within timer handler callback function */
@@ -100,8 +157,26 @@ typedef struct CTimer_
 /*! \brief   Class structure of the timer management */
 typedef struct CTimerManagement_
 {
+#ifdef TM_FOOTPRINT_TINY
     /*! \brief Doubly linked list to manage the active timers */
     CDlList timer_list;
+#else
+    /*! \brief Slots of the hierarchical timer wheel. Slot i of level n contains all timers which 
+     *         expire within the i-th interval of (TM_WHEEL_SLOTS^n) ticks. */
+    CDlList wheel[TM_WHEEL_LEVELS][TM_WHEEL_SLOTS];
+    /*! \brief Bit mask per level which signals the slots that contain at least one timer */
+    uint32_t slot_mask[TM_WHEEL_LEVELS];
+    /*! \brief List of expired timers whose handlers are currently processed */
+    CDlList expired_list;
+    /*! \brief Expired timer whose handler is currently invoked, otherwise \c NULL */
+    CTimer *handled_timer_ptr;
+    /*! \brief Next tick of the timer wheel which has to be processed */
+    uint32_t wheel_time;
+    /*! \brief Current time of the timer wheel, accumulated from the application tick count */
+    uint32_t current_time;
+    /*! \brief Number of running timers */
+    uint16_t timer_cnt;
+#endif
     /*! \brief Subject to request current tick count */
     CSingleSubject get_tick_count_subject;
     /*! \brief Subject to start the application timer which triggers a UCS service call */
@@ -109,11 +184,14 @@ typedef struct CTimerManagement_
     /*! \brief Service instance to add the timer management to the scheduler */
     CService tm_srv;
     /*! \brief Last tick count value (saved at TM service) */
-    uint16_t last_tick_count;
+    Tm_Tick_t last_tick_count;
     /*! \brief Signals that the application timer callbacks are used */
     bool delayed_tm_service_enabled;
     /*! \brief Indicates that the application timer must be started */
     bool set_service_timer;
+    /*! \brief Number of timer expiry points which were handled together with a later expiry point
+     *         within the same TM service run */
+    uint32_t saved_wakeups;
     /*! \brief UNICENS instance ID */
     void * ucs_user_ptr;
 
@@ -124,11 +202,15 @@ typedef struct CTimerManagement_
 /*------------------------------------------------------------------------------------------------*/
 extern void Tm_Ctor(CTimerManagement *self, CScheduler *scd, const Tm_InitData_t *init_ptr, void * ucs_user_ptr);
 extern void Tm_SetTimer(CTimerManagement *self, CTimer *timer_ptr, Tm_Handler_t handler_fptr, 
-                        void *args_ptr, uint16_t elapse, uint16_t period);
+                        void *args_ptr, Tm_Tick_t elapse, Tm_Tick_t period);
+extern void Tm_SetTimerEx(CTimerManagement *self, CTimer *timer_ptr, Tm_Handler_t handler_fptr, 
+                          void *args_ptr, Tm_Tick_t elapse, Tm_Tick_t period, Tm_Tick_t slack);
 extern void Tm_ClearTimer(CTimerManagement *self, CTimer *timer_ptr);
 extern void Tm_CheckForNextService(CTimerManagement *self);
 extern void Tm_TriggerService(CTimerManagement *self);
 extern void Tm_StopService(CTimerManagement *self);
+extern uint32_t Tm_GetSavedWakeups(CTimerManagement *self);
+extern Tm_Tick_t Tm_GetTickCount(CTimerManagement *self);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Prototypes of class CTimer                                                                     */
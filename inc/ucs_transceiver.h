@@ -119,10 +119,13 @@ extern void Trcv_TxSendMsgExt(CTransceiver *self, Msg_MostTel_t *tel_ptr, Msg_Tx
 extern void Trcv_TxSendMsgBypass(CTransceiver *self, Msg_MostTel_t *tel_ptr, Msg_TxStatusCb_t callback_fptr, void *inst_ptr);
 extern void Trcv_TxReleaseMsg(Msg_MostTel_t *tel_ptr);
 extern void Trcv_TxReuseMsg(Msg_MostTel_t *tel_ptr);
+extern void Trcv_TxSetPriority(Msg_MostTel_t *tel_ptr, Msg_TxPrio_t prio);
 /* Rx */
 extern void Trcv_RxAssignReceiver(CTransceiver *self, Trcv_RxCompleteCb_t callback_fptr, void *inst_ptr);
 extern void Trcv_RxAssignFilter(CTransceiver *self, Trcv_RxFilterCb_t callback_fptr, void *inst_ptr);
 extern void Trcv_RxReleaseMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr);
+extern bool Trcv_RxDetachMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr);
+extern void Trcv_RxReleaseDetachedMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr);
 extern void Trcv_RxOnMsgComplete(void *self, CMessage *tel_ptr);
 
 #ifdef __cplusplus
@@ -48,6 +48,8 @@
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief Interval for garbage collection */
 static const uint16_t ALM_GARBAGE_COLLECTOR_INTERVAL = 2600U;   /* parasoft-suppress  MISRA2004-8_7 "Value shall be part of the module, not part of a function." */
+/*! \brief Tolerated delay of the garbage collection */
+static const uint16_t ALM_GARBAGE_COLLECTOR_SLACK = 400U;       /* parasoft-suppress  MISRA2004-8_7 "Value shall be part of the module, not part of a function." */
 
 /*------------------------------------------------------------------------------------------------*/
 /* Internal prototypes                                                                            */
@@ -160,12 +162,13 @@ static void Alm_StartTimeout(CApiLockingManager *self)
 {
     if(T_IsTimerInUse(&self->garbage_collector) == false)
     {
-        Tm_SetTimer(self->tm_ptr,
-                    &self->garbage_collector,
-                    &Alm_GarbageCollector,
-                    self,
-                    ALM_GARBAGE_COLLECTOR_INTERVAL,
-                    ALM_GARBAGE_COLLECTOR_INTERVAL);
+        Tm_SetTimerEx(self->tm_ptr,
+                      &self->garbage_collector,
+                      &Alm_GarbageCollector,
+                      self,
+                      ALM_GARBAGE_COLLECTOR_INTERVAL,
+                      ALM_GARBAGE_COLLECTOR_INTERVAL,
+                      ALM_GARBAGE_COLLECTOR_SLACK);
     }
 }
 
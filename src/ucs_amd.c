@@ -74,6 +74,7 @@ void Amd_Ctor(CAmd *self, CBase *base_ptr, CAms *ams_ptr)
 
     self->started = false;
     Srv_Ctor(&self->service, AMD_SRV_PRIO, self, &Amd_Service);   /* register service */
+    SRV_SET_NAME(&self->service, "AMD");
     (void)Scd_AddService(&self->base_ptr->scd, &self->service);
 
     Dl_Ctor(&self->pre_queue, self->base_ptr->ucs_user_ptr);       /* init preprocessor queue */
@@ -67,6 +67,7 @@ static void Ams_OnEhEvent(void *self, void *error_code_ptr);
 static void Ams_TxService(CAms *self);
 static void Ams_TxOnStatus(void *self, Msg_MostTel_t *tel_ptr, Ucs_MsgTxStatus_t status);
 static uint8_t Ams_TxGetNextFollowerId(CAms *self);
+static void Ams_TxEnqueueMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr);
 
 static void Ams_RxOnTelComplete(CAms *self, Msg_MostTel_t *tel_ptr);
 static void Ams_RxReleaseTel(CAms *self, Msg_MostTel_t *tel_ptr);
@@ -107,6 +108,7 @@ void Ams_Ctor(CAms *self, CBase *base_ptr, CTransceiver *mcm_trcv_ptr, CTranscei
     Dl_Ctor(&self->tx.queue, self->base_ptr->ucs_user_ptr);
 
     Srv_Ctor(&self->service, AMS_SRV_PRIO, self, &Ams_Service);             /* register service */
+    SRV_SET_NAME(&self->service, "AMS");
     (void)Scd_AddService(&self->base_ptr->scd, &self->service);
 
     Segm_Ctor(&self->segmentation, self->base_ptr,  self->pool_ptr, rx_def_payload_sz);
@@ -145,6 +147,15 @@ void Ams_RxAssignReceiver(CAms *self, Amsg_RxCompleteCb_t cb_fptr, void *inst_pt
     self->rx.complete_inst_ptr = inst_ptr;
 }
 
+/*! \brief  Enables or disables zero-copy reception of segmented application messages
+ *  \param  self            The instance
+ *  \param  enabled         \c true to keep received telegrams as payload segments, otherwise \c false
+ */
+void Ams_RxSetZeroCopy(CAms *self, bool enabled)
+{
+    Segm_RxSetZeroCopy(&self->segmentation, enabled);
+}
+
 /*! \brief   Assigns an observer which is invoked if a Tx application message is freed.
  *  \details The observer is only notified a previous allocation of a Tx object has failed.
  *           The data_ptr of the update callback function is not used (always \c NULL).
@@ -299,11 +310,38 @@ Ucs_AmsTx_Msg_t * Ams_TxGetMsg(CAms *self, uint16_t size)
     {
         msg_ptr->destination_address = AMS_ADDR_RSVD_RANGE; /* set invalid address to prevent internal transmission*/
         msg_ptr->llrbc = self->tx.default_llrbc;
+        msg_ptr->priority = UCS_AMSTX_PRIO_NORMAL;
     }
 
     return msg_ptr;
 }
 
+/*! \brief   Retrieves several message Tx handles in one operation
+ *  \details The function retrieves either all or no message objects.
+ *  \param   self    The instance
+ *  \param   count   Number of message objects. Valid values: 1..UCS_AMSTX_MAX_BATCH_SIZE.
+ *  \param   sizes   Array of \c count payload sizes in bytes. See Ams_TxGetMsg().
+ *  \param   msgs    Array of \c count elements which receives the message objects
+ *  \return  Returns \c true if all message objects are retrieved, otherwise \c false.
+ */
+bool Ams_TxGetMsgBatch(CAms *self, uint8_t count, const uint16_t sizes[], Ucs_AmsTx_Msg_t *msgs[])
+{
+    bool success = Amsp_AllocTxObjBatch(self->pool_ptr, count, sizes, msgs);
+    uint8_t i;
+
+    if (success != false)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            msgs[i]->destination_address = AMS_ADDR_RSVD_RANGE;    /* set invalid address to prevent internal transmission*/
+            msgs[i]->llrbc = self->tx.default_llrbc;
+            msgs[i]->priority = UCS_AMSTX_PRIO_NORMAL;
+        }
+    }
+
+    return success;
+}
+
 /*! \brief  Frees an unused or completed Tx message to the pool
  *  \param  self    The instance
  *  \param  msg_ptr Reference to the related message object
@@ -314,6 +352,28 @@ void Ams_TxFreeUnusedMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr)
     Amsg_TxFreeUnused(msg_ptr);     /* the object is automatically freed to the pool */
 }
 
+/*! \brief   Assigns an application owned payload to a Tx message
+ *  \details The payload is released as soon as the transmission of the message has 
+ *           finished or the message is freed.
+ *  \param   self        The instance
+ *  \param   msg_ptr     Reference to the related message object
+ *  \param   payload_ptr Reference to the application owned payload
+ *  \return  Possible return values are
+ *           - \c UCS_RET_SUCCESS if the payload was assigned
+ *           - \c UCS_RET_ERR_PARAM if the size of the payload exceeds 65535 bytes
+ */
+Ucs_Return_t Ams_TxSetSharedPayload(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_SharedPayload_t *payload_ptr)
+{
+    Ucs_Return_t ret_val = UCS_RET_ERR_PARAM;
+
+    if (Amsg_TxSetSharedPayload(msg_ptr, payload_ptr, self->base_ptr->ucs_user_ptr) != false)
+    {
+        ret_val = UCS_RET_SUCCESS;
+    }
+
+    return ret_val;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* AMS Transmission                                                                               */
 /*------------------------------------------------------------------------------------------------*/
@@ -353,6 +413,64 @@ Ucs_Return_t Ams_TxSendMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr, Amsg_TxComplete
     return ret_val;
 }
 
+/*! \brief      Transmits several MOST Application Messages in one operation
+ *  \details    The messages are checked before any of them is scheduled. Thus, either all or 
+ *              none of the messages is transmitted. A message must not be listed twice or be 
+ *              scheduled already. The Tx service is triggered only once for 
+ *              the whole batch. The same callback function is assigned to all messages.
+ *  \param  self                    The instance
+ *  \param  count                   Number of messages
+ *  \param  msgs                    Array of \c count references to the related message objects
+ *  \param  tx_complete_sia_fptr    Single instance API callback function which is invoked as soon as 
+ *                                  the transmission of a message was finished.
+ *  \param  tx_complete_fptr        Multi instance callback function which is invoked as soon as 
+ *                                  the transmission of a message was finished.
+ *  \param  tx_complete_inst_ptr    Instance pointer which is referred when tx_complete_fptr is invoked. 
+ *  \return Possible return values are
+ *          - \c UCS_RET_SUCCESS if the transmission of all messages was started successfully
+ *          - \c UCS_RET_ERR_PARAM if the transmission was refused due to an invalid parameter
+ */
+Ucs_Return_t Ams_TxSendMsgBatch(CAms *self, uint8_t count, Ucs_AmsTx_Msg_t *msgs[], 
+                                Amsg_TxCompleteSiaCb_t tx_complete_sia_fptr, 
+                                Amsg_TxCompleteCb_t tx_complete_fptr, void* tx_complete_inst_ptr)
+{
+    Ucs_Return_t ret_val = UCS_RET_SUCCESS;
+    uint8_t i;
+    uint8_t j;
+
+    TR_INFO((self->base_ptr->ucs_user_ptr, "[AMS]", "Called Ams_TxSendMsgBatch(count=%d)", 1U, count));
+    TR_ASSERT(self->base_ptr->ucs_user_ptr, "[AMS]", (((tx_complete_sia_fptr != NULL) && (tx_complete_fptr != NULL)) == false))
+
+    for (i = 0U; (i < count) && (ret_val == UCS_RET_SUCCESS); i++)
+    {
+        if ((msgs[i] == NULL) || (Ams_TxIsValidMessage(msgs[i]) == false) || 
+            (Amsg_TxIsQueued(msgs[i]) != false))                        /* message is already scheduled */
+        {
+            ret_val = UCS_RET_ERR_PARAM;
+        }
+        for (j = 0U; (j < i) && (ret_val == UCS_RET_SUCCESS); j++)
+        {
+            if (msgs[j] == msgs[i])                                     /* message is listed twice */
+            {
+                ret_val = UCS_RET_ERR_PARAM;
+            }
+        }
+    }
+
+    if (ret_val == UCS_RET_SUCCESS)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            Amsg_TxSetCompleteCallback(msgs[i], tx_complete_sia_fptr, tx_complete_fptr, tx_complete_inst_ptr);
+            Ams_TxEnqueueMsg(self, msgs[i]);
+        }
+
+        Srv_SetEvent(&self->service, AMS_EV_TX_SERVICE);
+    }
+
+    return ret_val;
+}
+
 /*! \brief          Transmits a MOST Application Message without attributes check
  *  \details        This method shall be only be used by AMD and AMS internally
  *  \param  self    The instance
@@ -362,13 +480,23 @@ void Ams_TxSendMsgDirect(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr)
 {
     TR_INFO((self->base_ptr->ucs_user_ptr, "[AMS]", "Called Ams_TxSendMsg(0x%p)", 1U, msg_ptr));
 
+    Ams_TxEnqueueMsg(self, msg_ptr);
+    Srv_SetEvent(&self->service, AMS_EV_TX_SERVICE);
+}
+
+/*! \brief          Schedules a MOST Application Message for transmission
+ *  \details        The caller is responsible to trigger the Tx service.
+ *  \param  self    The instance
+ *  \param  msg_ptr Reference to the related message object
+ */
+static void Ams_TxEnqueueMsg(CAms *self, Ucs_AmsTx_Msg_t *msg_ptr)
+{
     if (msg_ptr->data_size > SEGM_MAX_SIZE_TEL)                         /* set follower id to be used for all segments */
     {
         Amsg_TxSetFollowerId(msg_ptr, Ams_TxGetNextFollowerId(self));
     }
 
     Amsg_TxEnqueue(msg_ptr, &self->tx.queue);                           /* schedule transmission */
-    Srv_SetEvent(&self->service, AMS_EV_TX_SERVICE);
 }
 
 /*! \brief  Callback function which is invoked as soon as MCM transmission
@@ -547,6 +675,14 @@ static void Ams_RxOnTelComplete(CAms *self, Msg_MostTel_t *tel_ptr)
             Telq_Enqueue(&self->rx.waiting_queue, tel_ptr);
             tel_ptr = NULL;                                 /* do not free Rx telegram */
         }
+        else if (result == SEGM_RES_KEPT)
+        {
+            tel_ptr = NULL;                                 /* Rx telegram is owned by the Rx message */
+        }
+        else
+        {
+            /* Rx telegram was processed and shall be freed */
+        }
     }
 
     if (msg_ptr != NULL)
@@ -574,10 +710,14 @@ static void Ams_RxProcessWaitingQ(CAms *self)
         Segm_Result_t result;
         msg_ptr = Segm_RxExecuteSegmentation(&self->segmentation, tel_ptr, &result);
 
-        if (result == SEGM_RES_OK)                                              /* segmentation process succeeded */
+        if (result != SEGM_RES_RETRY)                                           /* segmentation process succeeded */
         {
             (void)Telq_Dequeue(&self->rx.waiting_queue);                        /* remove telegram from waitingQ */
-            Ams_RxReleaseTel(self, tel_ptr);                                    /* free telegram */
+
+            if (result == SEGM_RES_OK)                                          /* free telegram unless it is owned */
+            {                                                                   /* by the Rx message */
+                Ams_RxReleaseTel(self, tel_ptr);
+            }
             tel_ptr = NULL;                                                     /* parasoft-suppress  MISRA2004-13_6 "variable is not used as a counter" */
 
             if (msg_ptr != NULL)
@@ -620,6 +760,7 @@ static void Ams_RxOnSegError(void *self, Msg_MostTel_t *tel_ptr, Segm_Error_t er
         error_tel_ptr->tel.tel_data_ptr[1]  = (uint8_t)error;
         error_tel_ptr->opts.llrbc           = 0U;
 
+        Trcv_TxSetPriority(error_tel_ptr, MSG_TX_PRIO_HIGH);    /* do not wait behind application messages */
         Trcv_TxSendMsg(self_->trcv_mcm_ptr, error_tel_ptr);      /* just fire the message */
     }
 }
@@ -649,7 +790,7 @@ void Ams_RxFreeMsg(CAms *self, Ucs_AmsRx_Msg_t *msg_ptr)
 
     if (msg_ptr != NULL)
     {
-        Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);            /* free external payload */
+        Segm_RxFreePayload(&self->segmentation, msg_ptr);       /* free external payload and segments */
         Amsp_FreeRxObj(self->pool_ptr, msg_ptr);                /* return message to Rx pool */
     }
 }
@@ -55,6 +55,9 @@
 /*------------------------------------------------------------------------------------------------*/
 static Ucs_AmsRx_ReceiveType_t Amsg_RxGetReceiveType(uint16_t destination_address);
 static void Amsg_TxRestoreDestinationAddr(Ucs_AmsTx_Msg_t *self);
+static void Amsg_TxReleaseSharedPayload(Ucs_AmsTx_Msg_t *self);
+static void Amsg_TxCopySharedPayload(Ucs_Mem_Buffer_t *buffer_ptr, uint16_t buffer_idx, uint16_t index, 
+                                     uint8_t *dest_ptr, uint16_t size);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Tx Message                                                                                      */
@@ -124,6 +127,152 @@ void Amsg_TxReuse(Ucs_AmsTx_Msg_t *self)
 
     SELF_TX->next_segment_cnt  = 0xFFFFU;               /* start with TelId "4" */
     SELF_TX->temp_result       = UCS_MSG_STAT_OK;
+    SELF_TX->shared_ptr        = NULL;                  /* shared payload was released before */
+}
+
+/*! \brief   Assigns an application owned payload to the message object
+ *  \details The message refers to the payload chain until it is completed or freed.
+ *           Therefore, the reference counter of the payload is incremented. A payload
+ *           which was assigned before is released.
+ *  \param   self           The instance
+ *  \param   payload_ptr    Reference to the application owned payload
+ *  \param   user_ptr       User reference which is passed to the release callback
+ *  \return  Returns \c true if the payload is assigned, or \c false if the size of the
+ *           payload chain exceeds 65535 bytes.
+ */
+bool Amsg_TxSetSharedPayload(Ucs_AmsTx_Msg_t *self, Ucs_AmsTx_SharedPayload_t *payload_ptr, void *user_ptr)
+{
+    bool ret = false;
+    uint32_t total_sz = 0U;
+    Ucs_Mem_Buffer_t *buffer_ptr;
+
+    for (buffer_ptr = payload_ptr->buffer_ptr; buffer_ptr != NULL; buffer_ptr = buffer_ptr->next_buffer_ptr)
+    {
+        total_sz += buffer_ptr->data_size;
+    }
+
+    if (total_sz <= 0xFFFFU)
+    {
+        Amsg_TxReleaseSharedPayload(self);
+        payload_ptr->ref_cnt++;
+
+        SELF_TX->shared_ptr      = payload_ptr;
+        SELF_TX->shared_user_ptr = user_ptr;
+        SELF_TX->shared_curr_ptr = payload_ptr->buffer_ptr;
+        SELF_TX->shared_curr_idx = 0U;
+
+        self->data_ptr  = NULL;                             /* public payload refers to the first buffer */
+        self->data_size = (uint16_t)total_sz;
+        if (payload_ptr->buffer_ptr != NULL)
+        {
+            self->data_ptr = payload_ptr->buffer_ptr->data_ptr;
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*! \brief   Retrieves a contiguous part of the payload which is required to build a telegram
+ *  \details If the message refers to an application owned payload, the part is taken from
+ *           the respective memory buffer. A part that is located in multiple memory buffers 
+ *           is copied to \c copy_ptr. Parts of the application owned payload must be 
+ *           retrieved in ascending order.
+ *  \param   self       The instance
+ *  \param   index      Payload index of the first byte
+ *  \param   size       Size of the part in bytes
+ *  \param   copy_ptr   Memory which is able to store \c size bytes
+ *  \return  Reference to the part of the payload. This is \c copy_ptr if the part was copied.
+ */
+uint8_t* Amsg_TxGetPayload(Ucs_AmsTx_Msg_t *self, uint16_t index, uint8_t size, uint8_t *copy_ptr)
+{
+    uint8_t *ret_ptr = self->data_ptr;
+
+    if (SELF_TX->shared_ptr != NULL)
+    {                                                       /* skip buffers in front of the part */
+        while ((SELF_TX->shared_curr_ptr != NULL) && 
+               (index >= (uint16_t)(SELF_TX->shared_curr_idx + SELF_TX->shared_curr_ptr->data_size)))
+        {
+            SELF_TX->shared_curr_idx += SELF_TX->shared_curr_ptr->data_size;
+            SELF_TX->shared_curr_ptr = SELF_TX->shared_curr_ptr->next_buffer_ptr;
+        }
+
+        if ((SELF_TX->shared_curr_ptr != NULL) && 
+            (((uint32_t)index + (uint32_t)size) <= ((uint32_t)SELF_TX->shared_curr_idx + (uint32_t)SELF_TX->shared_curr_ptr->data_size)))
+        {
+            ret_ptr = &SELF_TX->shared_curr_ptr->data_ptr[index - SELF_TX->shared_curr_idx];
+        }
+        else                                                /* part is located in multiple buffers */
+        {
+            Amsg_TxCopySharedPayload(SELF_TX->shared_curr_ptr, SELF_TX->shared_curr_idx, index, copy_ptr, (uint16_t)size);
+            ret_ptr = copy_ptr;
+        }
+    }
+    else if (index > 0U)
+    {
+        ret_ptr = &self->data_ptr[index];
+    }
+
+    return ret_ptr;
+}
+
+/*! \brief  Copies a part of an application owned payload
+ *  \param  buffer_ptr  Memory buffer which contains the first byte of the part
+ *  \param  buffer_idx  Payload index of the first byte of \c buffer_ptr
+ *  \param  index       Payload index of the first byte of the part
+ *  \param  dest_ptr    Destination of the copy operation
+ *  \param  size        Size of the part in bytes
+ */
+static void Amsg_TxCopySharedPayload(Ucs_Mem_Buffer_t *buffer_ptr, uint16_t buffer_idx, uint16_t index, 
+                                     uint8_t *dest_ptr, uint16_t size)
+{
+    uint16_t done = 0U;
+
+    while ((buffer_ptr != NULL) && (done < size))
+    {
+        uint16_t offset = (uint16_t)((index + done) - buffer_idx);
+
+        if (offset < buffer_ptr->data_size)
+        {
+            uint16_t chunk_sz = (uint16_t)(buffer_ptr->data_size - offset);
+
+            if (chunk_sz > (uint16_t)(size - done))
+            {
+                chunk_sz = (uint16_t)(size - done);
+            }
+
+            Misc_MemCpy(&dest_ptr[done], &buffer_ptr->data_ptr[offset], (uint32_t)chunk_sz);
+            done += chunk_sz;
+        }
+
+        buffer_idx += buffer_ptr->data_size;
+        buffer_ptr = buffer_ptr->next_buffer_ptr;
+    }
+}
+
+/*! \brief  Decrements the reference counter of the application owned payload and 
+ *          invokes the release callback if the payload is no longer referred.
+ *  \param  self    The instance
+ */
+static void Amsg_TxReleaseSharedPayload(Ucs_AmsTx_Msg_t *self)
+{
+    Ucs_AmsTx_SharedPayload_t *payload_ptr = SELF_TX->shared_ptr;
+
+    if (payload_ptr != NULL)
+    {
+        SELF_TX->shared_ptr = NULL;
+        TR_ASSERT(NULL, "[AMSG_TX]", (payload_ptr->ref_cnt > 0U));
+
+        if (payload_ptr->ref_cnt > 0U)
+        {
+            payload_ptr->ref_cnt--;
+        }
+
+        if ((payload_ptr->ref_cnt == 0U) && (payload_ptr->released_fptr != NULL))
+        {
+            payload_ptr->released_fptr(payload_ptr, SELF_TX->shared_user_ptr);
+        }
+    }
 }
 
 /*! \brief   Assigns a Tx complete callback function
@@ -161,6 +310,8 @@ void Amsg_TxNotifyComplete(Ucs_AmsTx_Msg_t *self, Ucs_AmsTx_Result_t result, Ucs
         SELF_TX->complete_fptr(self, result, info, SELF_TX->complete_inst_ptr);
     }
 
+    Amsg_TxReleaseSharedPayload(self);
+
     TR_ASSERT(NULL, "[AMSG_TX]", (SELF_TX->free_fptr != NULL));
     if (SELF_TX->free_fptr != NULL)
     {
@@ -173,6 +324,8 @@ void Amsg_TxNotifyComplete(Ucs_AmsTx_Msg_t *self, Ucs_AmsTx_Result_t result, Ucs
  */
 void Amsg_TxFreeUnused(Ucs_AmsTx_Msg_t *self)
 {
+    Amsg_TxReleaseSharedPayload(self);
+
     TR_ASSERT(NULL, "[AMSG_TX]", (SELF_TX->free_fptr != NULL));
     if (SELF_TX->free_fptr != NULL)
     {
@@ -260,6 +413,15 @@ void Amsg_TxEnqueue(Ucs_AmsTx_Msg_t* self, CDlList* list_ptr)
     Dl_InsertTail(list_ptr, &SELF_TX->node);
 }
 
+/*! \brief  Checks if a Tx message is part of a queue
+ *  \param  self     The instance
+ *  \return Returns \c true if the message is queued, otherwise \c false.
+ */
+bool Amsg_TxIsQueued(Ucs_AmsTx_Msg_t* self)
+{
+    return Dln_IsNodePartOfAList(&SELF_TX->node);
+}
+
 /*! \brief  Retrieves the next segment count
  *  \param  self     The instance
  *  \return The next segment count as uint16_t
@@ -376,6 +538,9 @@ void Amsg_RxCtor(Ucs_AmsRx_Msg_t *self, void *info_ptr)
     SELF_RX->memory_sz         = 0U;
     SELF_RX->memory_ptr        = NULL;
     SELF_RX->memory_info_ptr   = NULL;
+    SELF_RX->segm_tail_ptr     = NULL;
+    SELF_RX->segm_size         = 0U;
+    SELF_RX->exp_size          = 0U;
 }
 
 /*! \brief      Copies all attributes and payload from a Tx message to the Rx message
@@ -394,7 +559,14 @@ void Amsg_RxBuildFromTx(Ucs_AmsRx_Msg_t *self, Ucs_AmsTx_Msg_t *tx_ptr, uint16_t
     self->msg_id            = tx_ptr->msg_id;
     self->data_size         = tx_ptr->data_size;
 
-    Misc_MemCpy(self->data_ptr, tx_ptr->data_ptr, (size_t)self->data_size);
+    if (((Amsg_IntMsgTx_t*)(void*)tx_ptr)->shared_ptr != NULL)
+    {
+        Amsg_TxCopySharedPayload(((Amsg_IntMsgTx_t*)(void*)tx_ptr)->shared_ptr->buffer_ptr, 0U, 0U, self->data_ptr, self->data_size);
+    }
+    else
+    {
+        Misc_MemCpy(self->data_ptr, tx_ptr->data_ptr, (size_t)self->data_size);
+    }
 }
 
 /*! \brief      Sets all attributes of an internal Rx message to valid values
@@ -407,6 +579,9 @@ void Amsg_RxHandleSetup(Ucs_AmsRx_Msg_t *self)
     SELF_RX->pb_msg.data_ptr   = SELF_RX->memory_ptr;                   /* set data to valid memory */
     SELF_RX->gc_marker         = false;                                 /* reset garbage collector flag */
     SELF_RX->exp_tel_cnt       = 0U;                                    /* reset TelCnt */
+    SELF_RX->segm_tail_ptr     = NULL;                                  /* segments must be removed before */
+    SELF_RX->segm_size         = 0U;
+    SELF_RX->exp_size          = 0U;                                    /* reset announced message size */
 }
 
 /*! \brief  Evaluates if an Application Message has the same functional address
@@ -487,16 +662,17 @@ bool Amsg_RxAppendPayload(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* src_ptr)
 {
     uint8_t cnt;
     bool ret = false;
-    const uint16_t curr_size = SELF_RX->pb_msg.data_size;                /* get current message size */
+    const uint16_t curr_size = SELF_RX->pb_msg.data_size - SELF_RX->segm_size; /* get current size of copied payload */
 
-    if ((SELF_RX->memory_sz - src_ptr->tel.tel_len) >= SELF_RX->pb_msg.data_size) /* is size sufficient */
+    if ((SELF_RX->memory_sz - src_ptr->tel.tel_len) >= curr_size)       /* is size sufficient */
     {
         for (cnt = 0U; cnt < src_ptr->tel.tel_len; cnt++)
         {
-             SELF_RX->pb_msg.data_ptr[curr_size + (uint16_t)cnt] = src_ptr->tel.tel_data_ptr[cnt];
+             SELF_RX->memory_ptr[curr_size + (uint16_t)cnt] = src_ptr->tel.tel_data_ptr[cnt];
         }
 
-         SELF_RX->pb_msg.data_size = curr_size + src_ptr->tel.tel_len;    /* update message size */
+         SELF_RX->pb_msg.data_size += src_ptr->tel.tel_len;               /* update message size */
+         SELF_RX->copy_segment.data_size = curr_size + src_ptr->tel.tel_len;
          SELF_RX->exp_tel_cnt++;
         ret = true;
     }
@@ -504,6 +680,86 @@ bool Amsg_RxAppendPayload(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* src_ptr)
     return ret;
 }
 
+/*! \brief   Checks if further payload fits into the message
+ *  \details The message size must neither exceed the size announced by TelId "4" nor 
+ *           65535 bytes.
+ *  \param   self       The instance
+ *  \param   size       The size of the further payload in bytes
+ *  \return  Returns \c true if the payload fits into the message, otherwise \c false.
+ */
+bool Amsg_RxCheckSize(Ucs_AmsRx_Msg_t *self, uint8_t size)
+{
+    uint16_t max_size = 0xFFFFU;
+
+    if (SELF_RX->exp_size > 0U)
+    {
+        max_size = SELF_RX->exp_size;
+    }
+
+    return (SELF_RX->pb_msg.data_size <= (max_size - (uint16_t)size));
+}
+
+/*! \brief   Appends a received telegram as payload segment without copying its data
+ *  \details The telegram is owned by the message until it is removed by Amsg_RxRemoveSegment().
+ *           The caller has to check the size by means of Amsg_RxCheckSize() before. Telegrams
+ *           cannot be appended as soon as payload was copied to the message.
+ *  \param   self       The instance
+ *  \param   src_ptr    Reference to the received telegram
+ */
+void Amsg_RxAppendSegment(Ucs_AmsRx_Msg_t *self, Msg_MostTel_t* src_ptr)
+{
+    Ucs_Mem_Buffer_t *buffer_ptr = Msg_GetRxSegment((CMessage*)(void*)src_ptr);
+
+    TR_ASSERT(NULL, "[AMSG]", (SELF_RX->memory_sz == 0U));
+
+    if (SELF_RX->segm_tail_ptr == NULL)
+    {
+        SELF_RX->pb_msg.segments_ptr = buffer_ptr;
+        SELF_RX->pb_msg.data_ptr = NULL;
+    }
+    else
+    {
+        SELF_RX->segm_tail_ptr->next_buffer_ptr = buffer_ptr;
+    }
+
+    SELF_RX->segm_tail_ptr = buffer_ptr;
+    SELF_RX->segm_size += src_ptr->tel.tel_len;
+    SELF_RX->pb_msg.data_size += src_ptr->tel.tel_len;
+    SELF_RX->exp_tel_cnt++;
+}
+
+/*! \brief   Removes the first payload segment from the message
+ *  \details The segment which refers to copied payload is removed together with the last
+ *           kept telegram. The copied payload must be freed separately.
+ *  \param   self       The instance
+ *  \return  The telegram of the removed segment or \c NULL if the message has no further 
+ *           kept telegrams
+ */
+Msg_MostTel_t* Amsg_RxRemoveSegment(Ucs_AmsRx_Msg_t *self)
+{
+    Msg_MostTel_t *tel_ptr = NULL;
+
+    if ((SELF_RX->pb_msg.segments_ptr != NULL) && (SELF_RX->pb_msg.segments_ptr != &SELF_RX->copy_segment))
+    {
+        tel_ptr = Msg_GetMostTel(Msg_GetRxSegmentOwner(SELF_RX->pb_msg.segments_ptr));
+        SELF_RX->pb_msg.segments_ptr = SELF_RX->pb_msg.segments_ptr->next_buffer_ptr;
+    }
+    else if (SELF_RX->segm_size > 0U)                                   /* all telegrams are removed */
+    {
+        SELF_RX->pb_msg.segments_ptr = NULL;
+        SELF_RX->pb_msg.data_size -= SELF_RX->segm_size;                /* keep size of copied payload */
+        SELF_RX->pb_msg.data_ptr = SELF_RX->memory_ptr;
+        SELF_RX->segm_tail_ptr = NULL;
+        SELF_RX->segm_size = 0U;
+    }
+    else
+    {
+        /* message has no segments */
+    }
+
+    return tel_ptr;
+}
+
 /*! \brief   Copies data to allocated payload buffer 
  *  \param   self       The instance
  *  \param   data       Reference to external payload data
@@ -536,8 +792,20 @@ void Amsg_RxHandleSetMemory(Ucs_AmsRx_Msg_t *self, uint8_t *mem_ptr, uint16_t me
     SELF_RX->memory_info_ptr   = info_ptr;
     SELF_RX->memory_sz         = mem_size;
 
-    SELF_RX->pb_msg.data_ptr   = mem_ptr;
-    SELF_RX->pb_msg.data_size  = 0U;
+    if (SELF_RX->segm_size > 0U)                                        /* memory continues the kept telegrams */
+    {
+        SELF_RX->copy_segment.data_ptr = mem_ptr;
+        SELF_RX->copy_segment.data_size = 0U;
+        SELF_RX->copy_segment.total_size = mem_size;
+        SELF_RX->copy_segment.next_buffer_ptr = NULL;
+        SELF_RX->segm_tail_ptr->next_buffer_ptr = &SELF_RX->copy_segment;
+        SELF_RX->segm_tail_ptr = &SELF_RX->copy_segment;
+    }
+    else
+    {
+        SELF_RX->pb_msg.data_ptr   = mem_ptr;
+        SELF_RX->pb_msg.data_size  = 0U;
+    }
 }
 
 /*! \brief  Queues an Rx message at the tail of a list
@@ -576,6 +844,24 @@ uint8_t Amsg_RxGetExpTelCnt(Ucs_AmsRx_Msg_t* self)
     return SELF_RX->exp_tel_cnt;
 }
 
+/*! \brief  Sets the message size which is announced by TelId "4"
+ *  \param  self    The instance
+ *  \param  size    The announced message size
+ */
+void Amsg_RxSetExpSize(Ucs_AmsRx_Msg_t* self, uint16_t size)
+{
+    SELF_RX->exp_size = size;
+}
+
+/*! \brief  Retrieves the message size which is announced by TelId "4"
+ *  \param  self    The instance
+ *  \return The announced message size or 0 if the size is unknown
+ */
+uint16_t Amsg_RxGetExpSize(Ucs_AmsRx_Msg_t* self)
+{
+    return SELF_RX->exp_size;
+}
+
 /*! \brief  Peeks an Rx message from the head of a list
  *  \param  list_ptr Reference to the list
  *  \return Reference to the Rx message
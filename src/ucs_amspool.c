@@ -55,6 +55,14 @@
 /* Internal prototypes                                                                            */
 /*------------------------------------------------------------------------------------------------*/
 static void Amsp_FreeTxObj(void *self, Ucs_AmsTx_Msg_t* msg_ptr);
+static void* Amsp_AllocMem(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, void** custom_info_pptr);
+static bool Amsp_AllocMemBulk(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, 
+                              void* mem_ptrs[], void* custom_info_ptrs[]);
+static void Amsp_CountAlloc(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, bool success);
+static void Amsp_FreeMem(CAmsMsgPool *self, void *mem_ptr, uint16_t mem_size, Ams_MemUsage_t type, void* custom_info_ptr);
+static void Amsp_StopBlocking(CAmsMsgPool *self, Ams_MemUsage_t type);
+static bool Amsp_IsRxRsvd(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr, uint8_t *index_ptr);
+static void Amsp_ReleaseRxRsvd(CAmsMsgPool *self, uint8_t index);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Initialization                                                                                 */
@@ -62,44 +70,125 @@ static void Amsp_FreeTxObj(void *self, Ucs_AmsTx_Msg_t* msg_ptr);
 /*! \brief  Constructor of application message pool class 
  *  \param  self                The instance
  *  \param  mem_allocator_ptr   Reference to memory allocator
+ *  \param  tm_ptr              Reference to the timer management which is used to measure blocking times
  *  \param ucs_user_ptr User reference that needs to be passed in every callback function
  */
-void Amsp_Ctor(CAmsMsgPool *self, Ams_MemAllocator_t *mem_allocator_ptr, void *ucs_user_ptr)
+void Amsp_Ctor(CAmsMsgPool *self, Ams_MemAllocator_t *mem_allocator_ptr, CTimerManagement *tm_ptr, 
+               void *ucs_user_ptr)
 {
+    uint8_t i;
+
     self->ucs_user_ptr = ucs_user_ptr;
     self->allocator_ptr = mem_allocator_ptr;
-    self->rx_rsvd_msg_ptr = Amsp_AllocRxObj(self, 45U);
-    self->rx_rsvd_msg_ref = self->rx_rsvd_msg_ptr;
+    self->tm_ptr = tm_ptr;
     self->terminated = false;
     self->tx_notify_freed = false;
     self->rx_notify_freed = false;
     Sub_Ctor(&self->tx_freed_subject, self->ucs_user_ptr);
     Sub_Ctor(&self->rx_freed_subject, self->ucs_user_ptr);
+    MISC_MEM_SET(&self->mem_stats[0], 0, sizeof(self->mem_stats));
+
+    MISC_MEM_SET(&self->rx_rsvd_msgs[0], 0, sizeof(self->rx_rsvd_msgs));
+    self->rx_rsvd_avail_cnt = 0U;
+    self->rx_rsvd_prio_fptr = NULL;
+    self->rx_rsvd_prio_num = 0U;
 
-    TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (self->rx_rsvd_msg_ptr != NULL));
+    for (i = 0U; i < AMSP_NUM_RSVD_RX_MSGS; i++)
+    {
+        Ucs_AmsRx_Msg_t *msg_ptr = Amsp_AllocRxObj(self, 45U);
+        TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (msg_ptr != NULL));
+
+        if (msg_ptr != NULL)
+        {
+            self->rx_rsvd_msgs[i] = msg_ptr;
+            self->rx_rsvd_avail[self->rx_rsvd_avail_cnt] = msg_ptr;
+            self->rx_rsvd_avail_cnt++;
+        }
+    }
 }
 
 /*! \brief  Frees pre-allocated message memory
+ *  \details Pre-allocated messages which are currently in use are freed as soon as 
+ *           they are returned by Amsp_FreeRxObj().
  *  \param  self    The instance
  */
 void Amsp_Cleanup(CAmsMsgPool *self)
 {
-    Amsg_IntMsgRx_t *msg_ptr = INT_RX(self->rx_rsvd_msg_ptr);
-    TR_INFO((self->ucs_user_ptr, "[AMSP]", "Amsp_Cleanup: rx_rsvd_msg_ptr=0x%p", 1U, self->rx_rsvd_msg_ptr));
+    TR_INFO((self->ucs_user_ptr, "[AMSP]", "Amsp_Cleanup: rx_rsvd_avail_cnt=%u", 1U, self->rx_rsvd_avail_cnt));
 
     self->terminated = true;
     self->tx_notify_freed = false;
     self->rx_notify_freed = false;
 
-    if (msg_ptr != NULL)
+    while (self->rx_rsvd_avail_cnt > 0U)
+    {
+        uint8_t index = 0U;
+        self->rx_rsvd_avail_cnt--;
+
+        if (Amsp_IsRxRsvd(self, self->rx_rsvd_avail[self->rx_rsvd_avail_cnt], &index) != false)
+        {
+            Amsp_ReleaseRxRsvd(self, index);
+        }
+    }
+}
+
+/*! \brief  Sets the policy which pre-allocated Rx messages are provided to
+ *  \param  self            The instance
+ *  \param  is_prio_fptr    Callback function which identifies high priority messages or \c NULL
+ *  \param  prio_num        Number of pre-allocated Rx messages which are only provided to high
+ *                          priority messages. The value is ignored if \c is_prio_fptr is \c NULL.
+ */
+void Amsp_SetRxRsvdPolicy(CAmsMsgPool *self, Ucs_AmsRx_IsPrioMsgCb_t is_prio_fptr, uint8_t prio_num)
+{
+    self->rx_rsvd_prio_fptr = is_prio_fptr;
+    self->rx_rsvd_prio_num = 0U;
+
+    if (is_prio_fptr != NULL)
     {
-        self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, msg_ptr->memory_ptr, AMS_MU_RX_PAYLOAD, msg_ptr->memory_info_ptr);
-        self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, msg_ptr, AMS_MU_RX_OBJECT, msg_ptr->info_ptr);
-        self->rx_rsvd_msg_ref = NULL;
-        self->rx_rsvd_msg_ptr = NULL;
+        self->rx_rsvd_prio_num = prio_num;
     }
 }
 
+/*! \brief  Checks if a message is one of the pre-allocated Rx messages
+ *  \param  self        The instance
+ *  \param  msg_ptr     Reference to the internal Rx message object
+ *  \param  index_ptr   Returns the index of the pre-allocated message. Can be \c NULL.
+ *  \return Returns \c true if the message is pre-allocated, otherwise \c false.
+ */
+static bool Amsp_IsRxRsvd(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr, uint8_t *index_ptr)
+{
+    bool ret = false;
+    uint8_t i;
+
+    for (i = 0U; i < AMSP_NUM_RSVD_RX_MSGS; i++)
+    {
+        if ((msg_ptr != NULL) && (self->rx_rsvd_msgs[i] == msg_ptr))
+        {
+            if (index_ptr != NULL)
+            {
+                *index_ptr = i;
+            }
+            ret = true;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/*! \brief  Frees the memory of a pre-allocated Rx message
+ *  \param  self    The instance
+ *  \param  index   Index of the pre-allocated message
+ */
+static void Amsp_ReleaseRxRsvd(CAmsMsgPool *self, uint8_t index)
+{
+    Amsg_IntMsgRx_t *msg_ptr = INT_RX(self->rx_rsvd_msgs[index]);
+
+    Amsp_FreeMem(self, msg_ptr->memory_ptr, msg_ptr->memory_sz, AMS_MU_RX_PAYLOAD, msg_ptr->memory_info_ptr);
+    Amsp_FreeMem(self, msg_ptr, (uint16_t)AMSG_RX_OBJECT_SZ, AMS_MU_RX_OBJECT, msg_ptr->info_ptr);
+    self->rx_rsvd_msgs[index] = NULL;
+}
+
 /*! \brief  Assigns an observer which is invoked as soon as memory dedicated to a Tx message is 
  *          freed.The data_ptr of the update callback function is not used (always \c NULL). 
  *          See \ref Obs_UpdateCb_t. 
@@ -135,20 +224,20 @@ Ucs_AmsTx_Msg_t* Amsp_AllocTxObj(CAmsMsgPool *self, uint16_t payload_sz)
     void *payload_info_ptr = NULL;
     void *payload_ptr = NULL;
     void *obj_info_ptr = NULL;
-    Ucs_AmsTx_Msg_t *msg_ptr = (Ucs_AmsTx_Msg_t*)self->allocator_ptr->alloc_fptr(self->allocator_ptr->inst_ptr, AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, &obj_info_ptr);
+    Ucs_AmsTx_Msg_t *msg_ptr = (Ucs_AmsTx_Msg_t*)Amsp_AllocMem(self, (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, &obj_info_ptr);
     TR_INFO((self->ucs_user_ptr, "[AMSP]", "Allocating TxObject: msg_ptr=0x%p, size=%d, info_ptr=0x%p", 3U, msg_ptr, AMSG_TX_OBJECT_SZ, obj_info_ptr));
 
     if (msg_ptr != NULL)
     {
         if (payload_sz > 0U)
         {
-            payload_ptr = self->allocator_ptr->alloc_fptr(self->allocator_ptr->inst_ptr, payload_sz, AMS_MU_TX_PAYLOAD, &payload_info_ptr);
+            payload_ptr = Amsp_AllocMem(self, payload_sz, AMS_MU_TX_PAYLOAD, &payload_info_ptr);
             TR_INFO((self->ucs_user_ptr, "[AMSP]", "Allocating TxPayload: msg_ptr=0x%p, mem_ptr=0x%p, size=%d, info_ptr=0x%p", 4U, msg_ptr, payload_ptr, payload_sz, payload_info_ptr));
 
             if (payload_ptr == NULL)
             {
                 TR_INFO((self->ucs_user_ptr, "[AMSP]", "Freeing TxObject: msg_ptr=0x%p, info_ptr=0x%p", 2U, msg_ptr, obj_info_ptr));
-                self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, msg_ptr, AMS_MU_TX_OBJECT, obj_info_ptr);
+                Amsp_FreeMem(self, msg_ptr, (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, obj_info_ptr);
                 msg_ptr = NULL;
             }
         }
@@ -171,6 +260,79 @@ Ucs_AmsTx_Msg_t* Amsp_AllocTxObj(CAmsMsgPool *self, uint16_t payload_sz)
     return msg_ptr;
 }
 
+/*! \brief  Allocates several internal Tx message objects in one operation
+ *  \details The function allocates either all or no message objects. The message objects 
+ *           are retrieved by one bulk allocation if supported by the memory allocator.
+ *  \param  self            The instance
+ *  \param  count           Number of message objects. Valid values: 1..UCS_AMSTX_MAX_BATCH_SIZE.
+ *  \param  payload_sizes   Array of \c count required payload sizes in bytes
+ *  \param  msgs            Array of \c count elements which receives the message objects
+ *  \return Returns \c true if all message objects are allocated, otherwise \c false.
+ */
+bool Amsp_AllocTxObjBatch(CAmsMsgPool *self, uint8_t count, const uint16_t payload_sizes[], Ucs_AmsTx_Msg_t *msgs[])
+{
+    void *obj_ptrs[UCS_AMSTX_MAX_BATCH_SIZE];
+    void *obj_info_ptrs[UCS_AMSTX_MAX_BATCH_SIZE];
+    bool success = false;
+    uint8_t i;
+
+    TR_ASSERT(self->ucs_user_ptr, "[AMSP]", ((count > 0U) && (count <= UCS_AMSTX_MAX_BATCH_SIZE)));
+
+    if ((count > 0U) && (count <= UCS_AMSTX_MAX_BATCH_SIZE))
+    {
+        success = Amsp_AllocMemBulk(self, (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, count, obj_ptrs, obj_info_ptrs);
+    }
+
+    if (success != false)
+    {
+        for (i = 0U; i < count; i++)                        /* construct objects and allocate payload */
+        {
+            msgs[i] = (Ucs_AmsTx_Msg_t*)obj_ptrs[i];
+            Amsg_TxCtor(msgs[i], obj_info_ptrs[i], &Amsp_FreeTxObj, self);
+
+            if ((success != false) && (payload_sizes[i] > 0U))
+            {
+                void *payload_info_ptr = NULL;
+                void *payload_ptr = Amsp_AllocMem(self, payload_sizes[i], AMS_MU_TX_PAYLOAD, &payload_info_ptr);
+
+                if (payload_ptr != NULL)
+                {
+                    Amsg_TxSetInternalPayload(msgs[i], (uint8_t*)payload_ptr, payload_sizes[i], payload_info_ptr);
+                }
+                else
+                {
+                    success = false;
+                }
+            }
+        }
+
+        if (success == false)                               /* roll back the whole batch */
+        {
+            for (i = 0U; i < count; i++)
+            {
+                Amsg_IntMsgTx_t *obj_ptr = INT_TX(msgs[i]);
+
+                if (obj_ptr->memory_ptr != NULL)
+                {
+                    Amsp_FreeMem(self, obj_ptr->memory_ptr, obj_ptr->memory_sz, AMS_MU_TX_PAYLOAD, obj_ptr->memory_info_ptr);
+                }
+
+                Amsp_FreeMem(self, msgs[i], (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, obj_ptr->info_ptr);
+                msgs[i] = NULL;
+            }
+        }
+    }
+
+    TR_INFO((self->ucs_user_ptr, "[AMSP]", "Allocating TxObject batch: count=%d, success=%d", 2U, count, success));
+
+    if (success == false)
+    {
+        self->tx_notify_freed = true;
+    }
+
+    return success;
+}
+
 /*! \brief      Frees an internal Tx message object including its payload
  *  \param      self        The instance
  *  \param      msg_ptr     Reference to the internal Tx message object
@@ -183,12 +345,14 @@ static void Amsp_FreeTxObj(void *self, Ucs_AmsTx_Msg_t* msg_ptr)
     if (obj_ptr->memory_ptr != NULL)
     {
         TR_INFO((self_->ucs_user_ptr, "[AMSP]", "Freeing TxPayload: msg_ptr=0x%p, mem_ptr=0x%p, info_ptr=0x%p", 3U, msg_ptr, obj_ptr->memory_ptr, obj_ptr->memory_info_ptr));
-        self_->allocator_ptr->free_fptr(self_->allocator_ptr->inst_ptr, obj_ptr->memory_ptr, AMS_MU_TX_PAYLOAD, obj_ptr->memory_info_ptr);
+        Amsp_FreeMem(self_, obj_ptr->memory_ptr, obj_ptr->memory_sz, AMS_MU_TX_PAYLOAD, obj_ptr->memory_info_ptr);
         Amsg_TxSetInternalPayload(msg_ptr, NULL, 0U, NULL);
     }
 
     TR_INFO((self_->ucs_user_ptr, "[AMSP]", "Freeing TxObject: msg_ptr=0x%p, info_ptr=0x%p", 2U, msg_ptr, obj_ptr->info_ptr));
-    self_->allocator_ptr->free_fptr(self_->allocator_ptr->inst_ptr, msg_ptr, AMS_MU_TX_OBJECT, obj_ptr->info_ptr);
+    Amsp_FreeMem(self_, msg_ptr, (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_OBJECT, obj_ptr->info_ptr);
+    Amsp_StopBlocking(self_, AMS_MU_TX_OBJECT);
+    Amsp_StopBlocking(self_, AMS_MU_TX_PAYLOAD);
 
     if (self_->tx_notify_freed)
     {
@@ -209,7 +373,7 @@ static void Amsp_FreeTxObj(void *self, Ucs_AmsTx_Msg_t* msg_ptr)
 Ucs_AmsRx_Msg_t* Amsp_AllocRxObj(CAmsMsgPool *self, uint16_t payload_sz)
 {
     void *info_ptr = NULL;
-    Ucs_AmsRx_Msg_t *msg_ptr = (Ucs_AmsRx_Msg_t*)self->allocator_ptr->alloc_fptr(self->allocator_ptr->inst_ptr, AMSG_RX_OBJECT_SZ, AMS_MU_RX_OBJECT, &info_ptr);
+    Ucs_AmsRx_Msg_t *msg_ptr = (Ucs_AmsRx_Msg_t*)Amsp_AllocMem(self, (uint16_t)AMSG_RX_OBJECT_SZ, AMS_MU_RX_OBJECT, &info_ptr);
 
     TR_INFO((self->ucs_user_ptr, "[AMSP]", "Allocating RxObject: msg_ptr=0x%p, size=%d, info_ptr=0x%p", 3U, msg_ptr, AMSG_RX_OBJECT_SZ, info_ptr));
 
@@ -232,17 +396,27 @@ Ucs_AmsRx_Msg_t* Amsp_AllocRxObj(CAmsMsgPool *self, uint16_t payload_sz)
 }
 
 /*! \brief  Allocates a reserved Rx message object with payload up to 45 bytes payload
- *  \param  self        The instance
+ *  \details The last pre-allocated messages are only provided to high priority messages,
+ *           see Amsp_SetRxRsvdPolicy().
+ *  \param  self            The instance
+ *  \param  source_address  Source address of the received message
+ *  \param  msg_id          16bit message descriptor of the received message
  *  \return Reference to the Rx message object if the allocation succeeds. Otherwise \c NULL.
  */
-Ucs_AmsRx_Msg_t* Amsp_AllocRxRsvd(CAmsMsgPool *self)
+Ucs_AmsRx_Msg_t* Amsp_AllocRxRsvd(CAmsMsgPool *self, uint16_t source_address, uint16_t msg_id)
 {
     Ucs_AmsRx_Msg_t *msg_ptr = NULL;
+    bool is_allowed = (self->rx_rsvd_avail_cnt > self->rx_rsvd_prio_num);
+
+    if ((is_allowed == false) && (self->rx_rsvd_avail_cnt > 0U) && (self->rx_rsvd_prio_fptr != NULL))
+    {
+        is_allowed = self->rx_rsvd_prio_fptr(source_address, msg_id, self->ucs_user_ptr);
+    }
 
-    if (self->rx_rsvd_msg_ptr != NULL)
+    if (is_allowed != false)
     {
-        msg_ptr = self->rx_rsvd_msg_ptr;
-        self->rx_rsvd_msg_ptr = NULL;
+        self->rx_rsvd_avail_cnt--;
+        msg_ptr = self->rx_rsvd_avail[self->rx_rsvd_avail_cnt];
         Amsg_RxHandleSetup(msg_ptr);
         TR_INFO((self->ucs_user_ptr, "[AMSP]", "Retrieving reserved RxObject: msg_ptr=0x%p", 1U, msg_ptr));
     }
@@ -264,11 +438,11 @@ bool Amsp_AllocRxPayload(CAmsMsgPool *self, uint16_t payload_sz, Ucs_AmsRx_Msg_t
 {
     bool success = false;
     void *info_ptr = NULL;
-    void *mem_ptr = self->allocator_ptr->alloc_fptr(self->allocator_ptr->inst_ptr, payload_sz, AMS_MU_RX_PAYLOAD, &info_ptr);
+    void *mem_ptr = Amsp_AllocMem(self, payload_sz, AMS_MU_RX_PAYLOAD, &info_ptr);
 
     TR_INFO((self->ucs_user_ptr, "[AMSP]", "Allocating RxPayload: msg_ptr=0x%p, mem_ptr=0x%p, size=%d, info_ptr=0x%p", 4U, msg_ptr, mem_ptr, payload_sz, info_ptr));
     TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (msg_ptr != NULL));                  /* message reference is required */
-    TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (msg_ptr != self->rx_rsvd_msg_ref)); /* forbidden overwrite of pre-allocated message payload */
+    TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (Amsp_IsRxRsvd(self, msg_ptr, NULL) == false)); /* forbidden overwrite of pre-allocated message payload */
 
     if (mem_ptr != NULL)
     {
@@ -287,24 +461,33 @@ bool Amsp_AllocRxPayload(CAmsMsgPool *self, uint16_t payload_sz, Ucs_AmsRx_Msg_t
  */
 void Amsp_FreeRxObj(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr)
 {
-    if (msg_ptr == self->rx_rsvd_msg_ref)
+    uint8_t index = 0U;
+
+    if (Amsp_IsRxRsvd(self, msg_ptr, &index) != false)
     {
-        TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (self->rx_rsvd_msg_ptr == NULL));    /* before freeing, message shall be reserved */
+        TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (self->rx_rsvd_avail_cnt < AMSP_NUM_RSVD_RX_MSGS));  /* before freeing, message shall be reserved */
         TR_INFO((self->ucs_user_ptr, "[AMSP]", "Restoring reserved RxObject: msg_ptr=0x%p", 1U, msg_ptr));
-        self->rx_rsvd_msg_ptr = self->rx_rsvd_msg_ref;                              /* restore reserved message */
 
         if (self->terminated != false)
         {                                                                           /* also free reserved message if it is freed */
-            Amsp_Cleanup(self);                                                     /* from any queue after Amsp_Cleanup() */
+            Amsp_ReleaseRxRsvd(self, index);                                        /* from any queue after Amsp_Cleanup() */
+        }
+        else if (self->rx_rsvd_avail_cnt < AMSP_NUM_RSVD_RX_MSGS)
+        {
+            self->rx_rsvd_avail[self->rx_rsvd_avail_cnt] = msg_ptr;                 /* restore reserved message */
+            self->rx_rsvd_avail_cnt++;
         }
     }
     else 
     { 
         Amsg_IntMsgRx_t *obj_ptr = INT_RX(msg_ptr);
         TR_INFO((self->ucs_user_ptr, "[AMSP]", "Freeing RxObject: msg_ptr=0x%p, info_ptr=0x%p", 2U, msg_ptr, obj_ptr->info_ptr));
-        self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, msg_ptr, AMS_MU_RX_OBJECT, obj_ptr->info_ptr);
+        Amsp_FreeMem(self, msg_ptr, (uint16_t)AMSG_RX_OBJECT_SZ, AMS_MU_RX_OBJECT, obj_ptr->info_ptr);
     }
 
+    Amsp_StopBlocking(self, AMS_MU_RX_OBJECT);
+    Amsp_StopBlocking(self, AMS_MU_RX_PAYLOAD);
+
     if (self->rx_notify_freed)
     {
         Sub_Notify(&self->rx_freed_subject, NULL);
@@ -320,16 +503,171 @@ void Amsp_FreeRxPayload(CAmsMsgPool *self, Ucs_AmsRx_Msg_t* msg_ptr)
 {
     Amsg_IntMsgRx_t *obj_ptr = INT_RX(msg_ptr);
 
-    if (msg_ptr == self->rx_rsvd_msg_ref)
+    if (Amsp_IsRxRsvd(self, msg_ptr, NULL) != false)
     {
-        TR_ASSERT(self->ucs_user_ptr, "[AMSP]", (self->rx_rsvd_msg_ptr == NULL));    /* release payload before object */
         TR_INFO((self->ucs_user_ptr, "[AMSP]", "Restoring reserved RxPayload: msg_ptr=0x%p", 1U, msg_ptr));
     }
     else if (obj_ptr->memory_ptr != NULL)
     {
         TR_INFO((self->ucs_user_ptr, "[AMSP]", "Freeing RxPayload: msg_ptr=0x%p, mem_ptr=0x%p, info_ptr=0x%p", 3U, msg_ptr, obj_ptr->memory_ptr, obj_ptr->memory_info_ptr));
-        self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, obj_ptr->memory_ptr, AMS_MU_RX_PAYLOAD, obj_ptr->memory_info_ptr);
+        Amsp_FreeMem(self, obj_ptr->memory_ptr, obj_ptr->memory_sz, AMS_MU_RX_PAYLOAD, obj_ptr->memory_info_ptr);
         Amsg_RxHandleSetMemory(msg_ptr, NULL, 0U, NULL);
+        Amsp_StopBlocking(self, AMS_MU_RX_OBJECT);
+        Amsp_StopBlocking(self, AMS_MU_RX_PAYLOAD);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Memory statistics                                                                              */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Retrieves the memory statistics of a memory usage type
+ *  \param  self        The instance
+ *  \param  type        The memory usage type
+ *  \param  stats_ptr   Reference to the structure which is filled with the statistics
+ */
+void Amsp_GetMemStats(CAmsMsgPool *self, Ams_MemUsage_t type, Amsp_MemStats_t *stats_ptr)
+{
+    *stats_ptr = self->mem_stats[type];
+
+    if (stats_ptr->blocked != false)                            /* add the time of the current blocking */
+    {
+        stats_ptr->blocked_time += (Tm_Tick_t)(Tm_GetTickCount(self->tm_ptr) - stats_ptr->blocked_start);
+    }
+}
+
+/*! \brief  Allocates memory by means of the memory allocator and updates the memory statistics
+ *  \param  self                The instance
+ *  \param  mem_size            The required memory size in bytes
+ *  \param  type                Declares how the memory is used
+ *  \param  custom_info_pptr    Reference to memory related information which is set by the allocator
+ *  \return Pointer to the allocated memory or \c NULL if the allocation has failed
+ */
+static void* Amsp_AllocMem(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, void** custom_info_pptr)
+{
+    void *mem_ptr = self->allocator_ptr->alloc_fptr(self->allocator_ptr->inst_ptr, mem_size, type, custom_info_pptr);
+
+    Amsp_CountAlloc(self, mem_size, type, 1U, (mem_ptr != NULL));
+
+    return mem_ptr;
+}
+
+/*! \brief  Allocates several memory chunks of the same size and type in one operation
+ *  \details The bulk allocation function of the memory allocator is used if available. 
+ *           Otherwise the chunks are allocated one by one. The function allocates either 
+ *           all or no memory chunks.
+ *  \param  self                The instance
+ *  \param  mem_size            The required memory size of every chunk in bytes
+ *  \param  type                Declares how the memory is used
+ *  \param  count               Number of memory chunks
+ *  \param  mem_ptrs            Receives the references to the memory chunks
+ *  \param  custom_info_ptrs    Receives the memory related information which is set by the allocator
+ *  \return Returns \c true if all memory chunks are allocated, otherwise \c false.
+ */
+static bool Amsp_AllocMemBulk(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, 
+                              void* mem_ptrs[], void* custom_info_ptrs[])
+{
+    bool success = true;
+    uint8_t i;
+
+    if (self->allocator_ptr->alloc_bulk_fptr != NULL)
+    {
+        success = self->allocator_ptr->alloc_bulk_fptr(self->allocator_ptr->inst_ptr, mem_size, type, count, 
+                                                       mem_ptrs, custom_info_ptrs);
+        Amsp_CountAlloc(self, mem_size, type, count, success);
+    }
+    else
+    {
+        for (i = 0U; (i < count) && (success != false); i++)
+        {
+            custom_info_ptrs[i] = NULL;
+            mem_ptrs[i] = Amsp_AllocMem(self, mem_size, type, &custom_info_ptrs[i]);
+
+            if (mem_ptrs[i] == NULL)
+            {
+                success = false;
+
+                while (i > 0U)                              /* free chunks which are already allocated */
+                {
+                    i--;
+                    Amsp_FreeMem(self, mem_ptrs[i], mem_size, type, custom_info_ptrs[i]);
+                }
+                break;
+            }
+        }
+    }
+
+    return success;
+}
+
+/*! \brief  Updates the memory statistics after an allocation attempt
+ *  \param  self        The instance
+ *  \param  mem_size    The size of every memory chunk in bytes
+ *  \param  type        Declares how the memory is used
+ *  \param  count       Number of memory chunks
+ *  \param  success     Is \c true if the allocation has succeeded
+ */
+static void Amsp_CountAlloc(CAmsMsgPool *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, bool success)
+{
+    Amsp_MemStats_t *stats_ptr = &self->mem_stats[type];
+
+    if (success != false)
+    {
+        stats_ptr->allocs += count;
+        stats_ptr->bytes_in_use += (uint32_t)mem_size * (uint32_t)count;
+
+        if (stats_ptr->bytes_in_use > stats_ptr->peak_bytes)
+        {
+            stats_ptr->peak_bytes = stats_ptr->bytes_in_use;
+        }
+    }
+    else
+    {
+        stats_ptr->failures++;
+
+        if (stats_ptr->blocked == false)
+        {
+            stats_ptr->blocked = true;
+            stats_ptr->blocked_start = Tm_GetTickCount(self->tm_ptr);
+        }
+    }
+}
+
+/*! \brief  Frees memory by means of the memory allocator and updates the memory statistics
+ *  \param  self                The instance
+ *  \param  mem_ptr             Reference to the memory
+ *  \param  mem_size            The size of the memory in bytes
+ *  \param  type                Declares how the memory is used
+ *  \param  custom_info_ptr     Reference to memory related information which was set by the allocator
+ */
+static void Amsp_FreeMem(CAmsMsgPool *self, void *mem_ptr, uint16_t mem_size, Ams_MemUsage_t type, void* custom_info_ptr)
+{
+    Amsp_MemStats_t *stats_ptr = &self->mem_stats[type];
+
+    self->allocator_ptr->free_fptr(self->allocator_ptr->inst_ptr, mem_ptr, type, custom_info_ptr);
+    stats_ptr->frees++;
+
+    if (stats_ptr->bytes_in_use >= mem_size)
+    {
+        stats_ptr->bytes_in_use -= mem_size;
+    }
+    else
+    {
+        stats_ptr->bytes_in_use = 0U;
+    }
+}
+
+/*! \brief  Finishes the blocking time measurement of a memory usage type since memory was released
+ *  \param  self    The instance
+ *  \param  type    The memory usage type
+ */
+static void Amsp_StopBlocking(CAmsMsgPool *self, Ams_MemUsage_t type)
+{
+    Amsp_MemStats_t *stats_ptr = &self->mem_stats[type];
+
+    if (stats_ptr->blocked != false)
+    {
+        stats_ptr->blocked_time += (Tm_Tick_t)(Tm_GetTickCount(self->tm_ptr) - stats_ptr->blocked_start);
+        stats_ptr->blocked = false;
     }
 }
 
@@ -160,6 +160,7 @@ void Ats_Ctor(CAttachService *self, Ats_InitData_t *init_ptr)
     Fsm_Ctor(&self->fsm, self, &(ats_trans_tab[0][0]), ATS_NUM_EVENTS, ATS_S_START);
     /* Initialize ATS service */
     Srv_Ctor(&self->ats_srv, ATS_SRV_PRIO, self, &Ats_Service);
+    SRV_SET_NAME(&self->ats_srv, "ATS");
     /* Add ATS service to scheduler */
     (void)Scd_AddService(&self->init_data.base_ptr->scd, &self->ats_srv);
 }
@@ -281,6 +281,7 @@ void Bcd_Ctor(CBackChannelDiag *self, CInic *inic, CBase *base, CExc *exc)
 
     /* Initialize Node Discovery service */
     Srv_Ctor(&self->service, BCD_SRV_PRIO, self, &Bcd_Service);
+    SRV_SET_NAME(&self->service, "BCD");
     /* Add Node Discovery service to scheduler */
     (void)Scd_AddService(&self->base->scd, &self->service);
 
@@ -65,6 +65,23 @@
 # define UCS_API_INSTANCES ((uint8_t)UCS_NUM_INSTANCES)
 #endif
 
+/*! \brief Instance ID of all instances created by Ucs_CreateInstanceEx() */
+#define UCS_DYNAMIC_INST_ID 0U
+
+/*! \brief Number of FIFOs which share the memory of Ucs_InitData_t::lld_tx_window (ICM, MCM, RCM) */
+#define UCS_NUM_TX_WINDOWS  3U
+
+#ifdef UCS_PROF_GET_TIME
+/*! \brief Service statistics list which is filled by Ucs_Diag_CopyServiceStats() */
+typedef struct Ucs_Diag_ServiceStatsList_
+{
+    Ucs_Diag_ServiceStats_t *stats_list;    /*!< \brief Reference to the application's list */
+    uint8_t list_size;                      /*!< \brief Number of list entries */
+    uint8_t count;                          /*!< \brief Number of filled list entries */
+
+} Ucs_Diag_ServiceStatsList_t;
+#endif
+
 /*! \cond UCS_INTERNAL_DOC
  *  \addtogroup G_UCS_CLASS
  *  @{
@@ -75,7 +92,8 @@
 /*------------------------------------------------------------------------------------------------*/
 static bool Ucs_CheckInitData(const Ucs_InitData_t *init_ptr);
 static void Ucs_Ctor(CUcs* self, uint8_t ucs_inst_id, void *api_user_ptr);
-static void Ucs_InitComponents(CUcs* self);
+static Ucs_Return_t Ucs_InitComponents(CUcs* self);
+static void Ucs_RunService(CUcs *self, uint16_t max_services);
 static void Ucs_InitFactoryComponent(CUcs *self);
 static void Ucs_InitBaseComponent(CUcs *self);
 static void Ucs_InitPmsComponentConfig(CUcs *self);
@@ -106,9 +124,15 @@ static void Ucs_NetworkShutdownResult(void *self, void *result_ptr);
 static void Ucs_NetworkForceNAResult(void *self, void *result_ptr);
 static void Ucs_NetworkFrameCounterResult(void *self, void *result_ptr);
 static void Ucs_NetworkStatus(void *self, void *result_ptr);
+static void Ucs_Diag_CopyAmsMemStats(CUcs *self, Ams_MemUsage_t type, Ucs_Diag_AmsMemTypeStats_t *stats_ptr);
+static void Ucs_Diag_CopyFifoStats(CPmFifo *fifo_ptr, Ucs_Diag_FifoChannelStats_t *stats_ptr);
+#ifdef UCS_PROF_GET_TIME
+static bool Ucs_Diag_CopyServiceStats(void *self, const Srv_Stats_t *stats_ptr);
+#endif
 static void Ucs_InitPmsComponent(CUcs *self);
 static void Ucs_InitPmsComponentApp(CUcs *self);
-static void Ucs_InitAmsComponent(CUcs *self);
+static void Ucs_InitFifoTxWindow(CUcs *self, Fifo_InitData_t *init_ptr, uint8_t index);
+static Ucs_Return_t Ucs_InitAmsComponent(CUcs *self);
 static void Ucs_AmsRx_Callback(void *self);
 static void Ucs_AmsTx_FreedCallback(void *self, void *data_ptr);
 static bool Ucs_McmRx_FilterCallback(void *self, Msg_MostTel_t *tel_ptr);
@@ -140,6 +164,57 @@ extern Ucs_Inst_t* Ucs_CreateInstance(void)
     return inst_ptr;
 }
 
+extern Ucs_Inst_t* Ucs_CreateInstanceEx(const Ucs_Allocator_t *allocator_ptr)
+{
+    Ucs_Inst_t *inst_ptr = NULL;
+
+    if ((allocator_ptr != NULL) && (allocator_ptr->alloc_fptr != NULL) && (allocator_ptr->free_fptr != NULL))
+    {
+        CUcs *ucs_ptr = (CUcs*)allocator_ptr->alloc_fptr((uint32_t)sizeof(CUcs), allocator_ptr->arena_ptr);
+
+        if (ucs_ptr != NULL)
+        {
+            MISC_MEM_SET(ucs_ptr, 0, sizeof(*ucs_ptr));
+            ucs_ptr->ucs_inst_id = UCS_DYNAMIC_INST_ID;
+            ucs_ptr->allocator = *allocator_ptr;
+            TR_INFO((ucs_ptr->ucs_user_ptr, "[API]", "Ucs_CreateInstanceEx(): returns 0x%p", 1U, ucs_ptr));
+            inst_ptr = (Ucs_Inst_t*)(void*)ucs_ptr;                     /* convert API pointer to abstract data type */
+        }
+    }
+
+    if (inst_ptr == NULL)
+    {
+        TR_INFO((0U, "[API]", "Ucs_CreateInstanceEx(): failed!", 0U));
+    }
+
+    return inst_ptr;
+}
+
+extern Ucs_Return_t Ucs_DestroyInstance(Ucs_Inst_t *self)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_PARAM;
+
+    if ((self_ != NULL) && (self_->allocator.free_fptr != NULL))
+    {
+        if ((self_->init_complete == false) && (self_->init_pending == false) &&
+            (self_->uninit_result_fptr == NULL) && (Pmch_IsLldActive(&self_->pmch) == false))
+        {
+            Ucs_Allocator_t allocator = self_->allocator;
+            TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_DestroyInstance(): 0x%p", 1U, self_));
+            MISC_MEM_SET(self_, 0, sizeof(*self_));
+            allocator.free_fptr(self_, allocator.arena_ptr);
+            ret_val = UCS_RET_SUCCESS;
+        }
+        else
+        {
+            ret_val = UCS_RET_ERR_API_LOCKED;
+        }
+    }
+
+    return ret_val;
+}
+
 
 /*------------------------------------------------------------------------------------------------*/
 /* Initialization structure                                                                       */
@@ -188,6 +263,29 @@ static bool Ucs_CheckInitData(const Ucs_InitData_t *init_ptr)
         TR_ERROR((0U, "[API]", "Initialization failed. To run UCS in event driven service mode, both callback functions must be assigned.", 0U));
         ret_val = false;
     }
+    else if ((init_ptr->lld_rx_pool.mem_ptr != NULL) && (init_ptr->lld_rx_pool.size < PMCH_POOL_SIZE_RX_MIN))
+    {
+        TR_ERROR((0U, "[API]", "Initialization failed. The Rx pool must comprise at least 10 messages.", 0U));
+        ret_val = false;
+    }
+#ifdef UCS_LLD_RX_POOL_EXTERNAL
+    else if (init_ptr->lld_rx_pool.mem_ptr == NULL)
+    {
+        TR_ERROR((0U, "[API]", "Initialization failed. UCS_LLD_RX_POOL_EXTERNAL requires the memory of the Rx pool.", 0U));
+        ret_val = false;
+    }
+#endif
+    else if ((init_ptr->lld_tx_window.mem_ptr != NULL) && 
+             ((init_ptr->lld_tx_window.size < LLDP_NUM_HANDLES) || (init_ptr->lld_tx_window.size > LLDP_NUM_HANDLES_MAX)))
+    {
+        TR_ERROR((0U, "[API]", "Initialization failed. The Tx window must comprise 5..63 handles.", 0U));
+        ret_val = false;
+    }
+    else if (init_ptr->ams.rx.num_prio_rsvd_msgs > (uint8_t)UCS_AMS_NUM_RSVD_RX_MSGS)
+    {
+        TR_ERROR((0U, "[API]", "Initialization failed. The number of prioritized Rx messages exceeds UCS_AMS_NUM_RSVD_RX_MSGS.", 0U));
+        ret_val = false;
+    }
     else if ((init_ptr->mgr.enabled != false) && ((init_ptr->nd.eval_fptr != NULL) || (init_ptr->nd.report_fptr != NULL)))
     {
         TR_INFO((0U, "[API]", "Ambiguous initialization structure. NodeDiscovery callback functions are not effective if 'mgr.enabled' is 'true'.", 0U));
@@ -206,8 +304,10 @@ static bool Ucs_CheckInitData(const Ucs_InitData_t *init_ptr)
  */
 static void Ucs_Ctor(CUcs* self, uint8_t ucs_inst_id, void *api_user_ptr)
 {
-    MISC_MEM_SET(self, 0, sizeof(*self));                       /* reset memory and backup/restore instance id */
+    Ucs_Allocator_t allocator = self->allocator;
+    MISC_MEM_SET(self, 0, sizeof(*self));                       /* reset memory and backup/restore instance id and allocator */
     self->ucs_inst_id = ucs_inst_id;
+    self->allocator = allocator;
     self->ucs_user_ptr = api_user_ptr;
 }
 
@@ -225,11 +325,13 @@ extern Ucs_Return_t Ucs_Init(Ucs_Inst_t* self, const Ucs_InitData_t *init_ptr, U
         self_->init_result_fptr = init_result_fptr;             /* backup result callback function */
 
         self_->init_data = *init_ptr;                           /* backup init data */
-        Ucs_InitComponents(self_);                              /* call constructors and link all components */
-                                                                /* create init-complete observer */
-        Sobs_Ctor(&self_->init_result_obs, self, &Ucs_InitResultCb);
-        Ats_Start(&self_->inic.attach, &self_->init_result_obs);/* Start attach process */
-        ret = UCS_RET_SUCCESS;
+        ret = Ucs_InitComponents(self_);                        /* call constructors and link all components */
+        if (ret == UCS_RET_SUCCESS)
+        {                                                       /* create init-complete observer */
+            Sobs_Ctor(&self_->init_result_obs, self, &Ucs_InitResultCb);
+            self_->init_pending = true;
+            Ats_Start(&self_->inic.attach, &self_->init_result_obs);/* Start attach process */
+        }
     }
                                                                 /* register observer related to Ucs_Stop() */
     Mobs_Ctor(&self_->uninit_result_obs, self, (EH_E_UNSYNC_COMPLETE | EH_E_UNSYNC_FAILED), &Ucs_UninitResultCb);
@@ -239,21 +341,205 @@ extern Ucs_Return_t Ucs_Init(Ucs_Inst_t* self, const Ucs_InitData_t *init_ptr, U
 extern void Ucs_Service(Ucs_Inst_t* self)
 {
     CUcs *self_ = (CUcs*)(void*)self;
+    TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_Service(): called", 0U));
+    Ucs_RunService(self_, SCD_UNLIMITED_BUDGET);
+}
+
+extern void Ucs_ServiceBudget(Ucs_Inst_t* self, uint16_t max_services)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_ServiceBudget(): called", 0U));
+    Ucs_RunService(self_, max_services);
+}
+
+#ifdef UCS_PROF_GET_TIME
+extern Ucs_Return_t Ucs_Diag_GetServiceStats(Ucs_Inst_t *self, Ucs_Diag_ServiceStats_t stats_list[], 
+                                             uint8_t list_size, uint8_t *count_ptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if ((stats_list == NULL) || (count_ptr == NULL))
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if (self_->init_complete != false)
+    {
+        Ucs_Diag_ServiceStatsList_t list;
+
+        list.stats_list = stats_list;
+        list.list_size = list_size;
+        list.count = 0U;
+        if (list_size > 0U)
+        {
+            Scd_GetServiceStats(&self_->general.base.scd, &Ucs_Diag_CopyServiceStats, &list);
+        }
+        *count_ptr = list.count;
+        ret_val = UCS_RET_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*! \brief  Copies the statistics of a service to the list of Ucs_Diag_GetServiceStats()
+ *  \param  self        Reference to the list of type Ucs_Diag_ServiceStatsList_t
+ *  \param  stats_ptr   Reference to the statistics of the service
+ *  \return Returns \c true if the list is full, otherwise \c false.
+ */
+static bool Ucs_Diag_CopyServiceStats(void *self, const Srv_Stats_t *stats_ptr)
+{
+    Ucs_Diag_ServiceStatsList_t *list_ptr = (Ucs_Diag_ServiceStatsList_t *)self;
+    Ucs_Diag_ServiceStats_t *entry_ptr = &list_ptr->stats_list[list_ptr->count];
+
+    entry_ptr->name_str = stats_ptr->name_str;
+    entry_ptr->priority = stats_ptr->priority;
+    entry_ptr->invocations = stats_ptr->invocations;
+    entry_ptr->total_time = stats_ptr->total_time;
+    entry_ptr->max_time = stats_ptr->max_time;
+    entry_ptr->total_dwell_time = stats_ptr->total_dwell_time;
+    entry_ptr->max_dwell_time = stats_ptr->max_dwell_time;
+    list_ptr->count++;
+
+    return (list_ptr->count >= list_ptr->list_size);
+}
+#endif
+
+extern uint32_t Ucs_Lld_GetRxPoolMemSize(uint16_t size)
+{
+    return Pmch_GetRxPoolMemSize(size);
+}
+
+extern uint32_t Ucs_Lld_GetTxWindowMemSize(uint8_t size)
+{
+    return UCS_NUM_TX_WINDOWS * Lldp_GetMemSize(size);
+}
+
+extern Ucs_Return_t Ucs_Diag_GetRxPoolStats(Ucs_Inst_t *self, Ucs_Diag_RxPoolStats_t *stats_ptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if (stats_ptr == NULL)
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if (self_->init_complete != false)
+    {
+        Pmch_RxPoolStats_t stats;
+
+        Pmch_GetRxPoolStats(&self_->pmch, &stats);
+        stats_ptr->size = stats.size;
+        stats_ptr->available = stats.available;
+        stats_ptr->low_water_mark = stats.low_water_mark;
+        stats_ptr->alloc_failures = stats.alloc_failures;
+        stats_ptr->stall_count = stats.stall_count;
+        stats_ptr->total_stall_time = stats.total_stall_time;
+        stats_ptr->max_stall_time = stats.max_stall_time;
+        ret_val = UCS_RET_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*! \brief Copies the internal memory statistics of an AMS memory usage type to the public structure
+ *  \param self           The instance
+ *  \param type           The memory usage type
+ *  \param stats_ptr      Reference to the public statistics
+ */
+static void Ucs_Diag_CopyAmsMemStats(CUcs *self, Ams_MemUsage_t type, Ucs_Diag_AmsMemTypeStats_t *stats_ptr)
+{
+    Amsp_MemStats_t stats;
+
+    Amsp_GetMemStats(&self->msg.ams_pool, type, &stats);
+    stats_ptr->allocs = stats.allocs;
+    stats_ptr->frees = stats.frees;
+    stats_ptr->failures = stats.failures;
+    stats_ptr->bytes_in_use = stats.bytes_in_use;
+    stats_ptr->peak_bytes = stats.peak_bytes;
+    stats_ptr->blocked_time = stats.blocked_time;
+}
+
+extern Ucs_Return_t Ucs_Diag_GetAmsMemStats(Ucs_Inst_t *self, Ucs_Diag_AmsMemStats_t *stats_ptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if (stats_ptr == NULL)
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if ((self_->init_complete != false) && (self_->init_data.ams.enabled == true))
+    {
+        Ucs_Diag_CopyAmsMemStats(self_, AMS_MU_RX_OBJECT, &stats_ptr->rx_object);
+        Ucs_Diag_CopyAmsMemStats(self_, AMS_MU_RX_PAYLOAD, &stats_ptr->rx_payload);
+        Ucs_Diag_CopyAmsMemStats(self_, AMS_MU_TX_OBJECT, &stats_ptr->tx_object);
+        Ucs_Diag_CopyAmsMemStats(self_, AMS_MU_TX_PAYLOAD, &stats_ptr->tx_payload);
+        ret_val = UCS_RET_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*! \brief Copies the internal statistics of a FIFO to the public structure
+ *  \param fifo_ptr       Reference to the FIFO
+ *  \param stats_ptr      Reference to the public statistics
+ */
+static void Ucs_Diag_CopyFifoStats(CPmFifo *fifo_ptr, Ucs_Diag_FifoChannelStats_t *stats_ptr)
+{
+    Fifo_RxAckStats_t stats;
+    Fifo_TxWindowStats_t window;
+
+    Fifo_GetRxAckStats(fifo_ptr, &stats);
+    stats_ptr->data_msgs = stats.data_msgs;
+    stats_ptr->status_msgs = stats.status_msgs;
+    stats_ptr->ack_threshold = stats.ack_threshold;
+    stats_ptr->ack_delay = stats.ack_delay;
+
+    Fifo_GetTxWindowStats(fifo_ptr, &window);
+    stats_ptr->tx_window_size = window.size;
+    stats_ptr->tx_window_stalls = window.stalls;
+}
+
+extern Ucs_Return_t Ucs_Diag_GetFifoStats(Ucs_Inst_t *self, Ucs_Diag_FifoStats_t *stats_ptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if (stats_ptr == NULL)
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if (self_->init_complete != false)
+    {
+        Ucs_Diag_CopyFifoStats(&self_->icm_fifo, &stats_ptr->icm);
+        Ucs_Diag_CopyFifoStats(&self_->msg.mcm_fifo, &stats_ptr->mcm);
+        Ucs_Diag_CopyFifoStats(&self_->rcm_fifo, &stats_ptr->rcm);
+        ret_val = UCS_RET_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*! \brief Runs the scheduler and requests further service calls if events are still pending.
+ *  \param self           The instance
+ *  \param max_services   Maximum number of internal services to execute or \ref SCD_UNLIMITED_BUDGET
+ */
+static void Ucs_RunService(CUcs *self, uint16_t max_services)
+{
     bool pending_events = false;
 
-    TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_Service(): called", 0U));
-    Scd_Service(&self_->general.base.scd);                              /* Run the scheduler */
-    pending_events = Scd_AreEventsPending(&self_->general.base.scd);    /* Check if events are still pending? */
+    Scd_ServiceBudget(&self->general.base.scd, max_services);          /* Run the scheduler */
+    pending_events = Scd_AreEventsPending(&self->general.base.scd);    /* Check if events are still pending? */
 
     if (pending_events != false)                                        /* At least one event is pending? */
     {
-        if (self_->general.request_service_fptr != NULL)
+        if (self->general.request_service_fptr != NULL)
         {
-            self_->general.request_service_fptr(self_->ucs_user_ptr);   /* Trigger UCS service call immediately */
+            self->general.request_service_fptr(self->ucs_user_ptr);     /* Trigger UCS service call immediately */
         }
     }
 
-    Tm_CheckForNextService(&self_->general.base.tm);                    /* If UCS timers are running: What is the next time that  
+    Tm_CheckForNextService(&self->general.base.tm);                     /* If UCS timers are running: What is the next time that  
                                                                          * the timer management must be serviced again? */   
 }
 
@@ -264,6 +550,12 @@ extern void Ucs_ReportTimeout(Ucs_Inst_t* self)
     Tm_TriggerService(&self_->general.base.tm);                         /* Trigger TM service call */
 }
 
+extern uint32_t Ucs_GetSavedWakeups(Ucs_Inst_t* self)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    return Tm_GetSavedWakeups(&self_->general.base.tm);
+}
+
 extern Ucs_Return_t Ucs_Stop(Ucs_Inst_t* self, Ucs_StdResultCb_t stopped_fptr)
 {
     CUcs *self_ = (CUcs*)(void*)self;
@@ -271,7 +563,8 @@ extern Ucs_Return_t Ucs_Stop(Ucs_Inst_t* self, Ucs_StdResultCb_t stopped_fptr)
 
     TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_Stop() called", 0U));
 
-    if ((self_->uninit_result_fptr == NULL) && (self_->init_complete != false))
+    if ((self_->uninit_result_fptr == NULL) && (self_->init_pending == false) &&
+        ((self_->init_complete != false) || (Pmch_IsLldActive(&self_->pmch) != false)))
     {
         if (stopped_fptr !=  NULL)
         {
@@ -285,7 +578,7 @@ extern Ucs_Return_t Ucs_Stop(Ucs_Inst_t* self, Ucs_StdResultCb_t stopped_fptr)
     }
     else
     {
-        ret_val = UCS_RET_ERR_API_LOCKED;         /* termination is already running */
+        ret_val = UCS_RET_ERR_API_LOCKED;         /* initialization or termination is running, or LLD is stopped */
     }
 
     return ret_val;
@@ -652,17 +945,21 @@ Ucs_Return_t Ucs_I2c_ReadPort(Ucs_Inst_t *self, uint16_t destination_address, ui
 /*------------------------------------------------------------------------------------------------*/
 /* Components                                                                                     */
 /*------------------------------------------------------------------------------------------------*/
-/*! \brief Initializes all UCS core components
- *  \param self     The instance
+/*! \brief  Initializes all UCS core components
+ *  \param  self     The instance
+ *  \return Returns \c UCS_RET_SUCCESS if all components are initialized, otherwise 
+ *          \c UCS_RET_ERR_PARAM.
  */
-static void Ucs_InitComponents(CUcs* self)
+static Ucs_Return_t Ucs_InitComponents(CUcs* self)
 {
+    Ucs_Return_t ret;
+
     Ucs_InitBaseComponent(self);
     Ucs_InitFactoryComponent(self);
     Ucs_InitLocalInicComponent(self);
     Ucs_InitNetComponent(self);
     Ucs_InitPmsComponent(self);
-    Ucs_InitAmsComponent(self);
+    ret = Ucs_InitAmsComponent(self);
     Ucs_InitRoutingComponent(self);
     Ucs_InitAtsClass(self);
 
@@ -672,6 +969,8 @@ static void Ucs_InitComponents(CUcs* self)
     Ucs_InitBackChannelDiagnosis(self);
     Ucs_InitProgramming(self);
     Ucs_InitManager(self);      /* shall be called as last one due to re-configuration work */
+
+    return ret;
 }
 
 /*! \brief Initializes the factory component
@@ -758,6 +1057,9 @@ static void Ucs_InitPmsComponentConfig(CUcs *self)
     pmch_init_data.ucs_user_ptr = self->ucs_user_ptr;
     pmch_init_data.tx_release_fptr = &Fifo_TxOnRelease;
     pmch_init_data.lld_iface = self->init_data.lld;
+    pmch_init_data.base_ptr = &self->general.base;
+    pmch_init_data.rx_pool_mem_ptr = self->init_data.lld_rx_pool.mem_ptr;
+    pmch_init_data.rx_pool_size = self->init_data.lld_rx_pool.size;
     Pmch_Ctor(&self->pmch, &pmch_init_data);
 
     /* Initialize the ICM channel */
@@ -765,6 +1067,7 @@ static void Ucs_InitPmsComponentConfig(CUcs *self)
     icm_init.channel_ptr = &self->pmch;
     icm_init.rx_cb_fptr = &Trcv_RxOnMsgComplete;
     icm_init.rx_cb_inst = &self->icm_transceiver;
+    Ucs_InitFifoTxWindow(self, &icm_init, 0U);
     icm_init.tx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
     icm_init.rx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
     icm_config.fifo_id = PMP_FIFO_ID_ICM;
@@ -774,6 +1077,10 @@ static void Ucs_InitPmsComponentConfig(CUcs *self)
     icm_config.rx_busy_allowed = 0xFU;
     icm_config.rx_credits = PMCH_FIFO_CREDITS;
     icm_config.rx_threshold = PMCH_FIFO_THRESHOLD;
+    icm_config.rx_threshold_min = PMCH_FIFO_THRESHOLD;  /* static threshold */
+    icm_config.rx_threshold_max = PMCH_FIFO_THRESHOLD;
+    icm_config.rx_ack_delay_min = 0U;
+    icm_config.rx_ack_delay_max = 0U;
     if (self->init_data.general.inic_watchdog_enabled == false)
     {
         icm_config.rx_ack_timeout = 0U;
@@ -785,6 +1092,7 @@ static void Ucs_InitPmsComponentConfig(CUcs *self)
     rcm_init.channel_ptr = &self->pmch;
     rcm_init.rx_cb_fptr = &Trcv_RxOnMsgComplete;
     rcm_init.rx_cb_inst = &self->rcm_transceiver;
+    Ucs_InitFifoTxWindow(self, &rcm_init, 2U);
     rcm_init.tx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
     rcm_init.rx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
     rcm_config.fifo_id = PMP_FIFO_ID_RCM;
@@ -794,6 +1102,10 @@ static void Ucs_InitPmsComponentConfig(CUcs *self)
     rcm_config.rx_busy_allowed = 0xFU;
     rcm_config.rx_credits = PMCH_FIFO_CREDITS;
     rcm_config.rx_threshold = PMCH_FIFO_THRESHOLD;
+    rcm_config.rx_threshold_min = PMCH_FIFO_THRESHOLD;  /* static threshold */
+    rcm_config.rx_threshold_max = PMCH_FIFO_THRESHOLD;
+    rcm_config.rx_ack_delay_min = 0U;
+    rcm_config.rx_ack_delay_max = 0U;
     if (self->init_data.general.inic_watchdog_enabled == false)
     {
         /* Disable INIC watchdog */
@@ -968,6 +1280,7 @@ static void Ucs_InitResultCb(void *self, void *result_ptr)
     Ucs_InitResult_t *result_ptr_ = (Ucs_InitResult_t *)result_ptr;
 
     TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_InitResultCb(): Ucs_Init() completed, internal event code: %u", 1U, *result_ptr_));
+    self_->init_pending = false;
     if (*result_ptr_ != UCS_INIT_RES_SUCCESS)
     {
         Ucs_StopAppNotification(self_);
@@ -1140,25 +1453,25 @@ static bool Ucs_OnRxMsgFilter(void *self, Msg_MostTel_t *tel_ptr)
 /*! \brief Callback function which is invoked to request the current tick count value
  *  \param self                     The instance
  *  \param tick_count_value_ptr     Reference to the requested tick count value. The pointer must 
- *                                  be casted into data type uint16_t.
+ *                                  be casted into data type Tm_Tick_t.
  */
 static void Ucs_OnGetTickCount(void *self, void *tick_count_value_ptr)
 {
     CUcs *self_ = (CUcs*)self;
-    *((uint16_t *)tick_count_value_ptr) = self_->general.get_tick_count_fptr(self_->ucs_user_ptr);
+    *((Tm_Tick_t *)tick_count_value_ptr) = self_->general.get_tick_count_fptr(self_->ucs_user_ptr);
 }
 
 /*! \brief  Callback function which is invoked to start the application timer when the UNICENS service
  *          is implemented event driven         
  *  \param  self                The instance
  *  \param  new_time_value_ptr  Reference to the new timer value. The pointer must be casted into 
- *                              data type uint16_t.
+ *                              data type Tm_Tick_t.
  */
 static void Ucs_OnSetApplicationTimer(void *self, void *new_time_value_ptr)
 {
     CUcs *self_ = (CUcs*)self;
-    TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_OnSetApplicationTimer(%d)", 1U, *((uint16_t *)new_time_value_ptr)));
-    self_->general.set_application_timer_fptr(*((uint16_t *)new_time_value_ptr), self_->ucs_user_ptr);
+    TR_INFO((self_->ucs_user_ptr, "[API]", "Ucs_OnSetApplicationTimer(%d)", 1U, *((Tm_Tick_t *)new_time_value_ptr)));
+    self_->general.set_application_timer_fptr(*((Tm_Tick_t *)new_time_value_ptr), self_->ucs_user_ptr);
 }
 
 /*! \brief Callback function which is invoked to announce a request for service
@@ -1532,6 +1845,26 @@ Ucs_Return_t Ucs_Prog_Start(Ucs_Inst_t *self,
     return ret_val;
 }
 
+/*! \brief Assigns the Tx handles of a FIFO from the memory of Ucs_InitData_t::lld_tx_window
+ *  \param self     The instance
+ *  \param init_ptr Reference to the initialization data of the FIFO
+ *  \param index    Index of the FIFO within the Tx window memory. Valid values: 0..UCS_NUM_TX_WINDOWS-1.
+ */
+static void Ucs_InitFifoTxWindow(CUcs *self, Fifo_InitData_t *init_ptr, uint8_t index)
+{
+    init_ptr->tx_handles_ptr = NULL;                    /* use built-in handles */
+    init_ptr->tx_handles_size = 0U;
+
+    if (self->init_data.lld_tx_window.mem_ptr != NULL)
+    {
+        uint8_t *mem_ptr = (uint8_t*)self->init_data.lld_tx_window.mem_ptr;
+        /* parasoft suppress item MISRA2004-17_4 reason "necessary offset usage" */
+        init_ptr->tx_handles_ptr = &mem_ptr[(uint32_t)index * Lldp_GetMemSize(self->init_data.lld_tx_window.size)];
+        /* parasoft unsuppress item MISRA2004-17_4 reason "necessary offset usage" */
+        init_ptr->tx_handles_size = self->init_data.lld_tx_window.size;
+    }
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* Message Handling                                                                               */
 /*------------------------------------------------------------------------------------------------*/
@@ -1548,6 +1881,7 @@ static void Ucs_InitPmsComponentApp(CUcs *self)
     mcm_init.channel_ptr = &self->pmch;
     mcm_init.rx_cb_fptr = &Trcv_RxOnMsgComplete;
     mcm_init.rx_cb_inst = &self->msg.mcm_transceiver;
+    Ucs_InitFifoTxWindow(self, &mcm_init, 1U);
     mcm_init.tx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
     mcm_init.rx_encoder_ptr = Enc_GetEncoder(ENC_CONTENT_00);
 
@@ -1559,6 +1893,10 @@ static void Ucs_InitPmsComponentApp(CUcs *self)
     mcm_config.rx_busy_allowed = 0xFU;
     mcm_config.rx_credits = PMCH_MCM_CREDITS;
     mcm_config.rx_threshold = PMCH_MCM_THRESHOLD;
+    mcm_config.rx_threshold_min = PMCH_MCM_THRESHOLD_MIN;   /* adaptive threshold */
+    mcm_config.rx_threshold_max = PMCH_MCM_THRESHOLD_MAX;
+    mcm_config.rx_ack_delay_min = PMCH_MCM_ACK_DELAY_MIN;
+    mcm_config.rx_ack_delay_max = PMCH_MCM_ACK_DELAY_MAX;
     if (self->init_data.general.inic_watchdog_enabled == false)
     {
         /* Disable INIC watchdog */
@@ -1577,18 +1915,35 @@ static void Ucs_InitPmsComponentApp(CUcs *self)
     Trcv_RxAssignFilter(&self->msg.mcm_transceiver, &Ucs_McmRx_FilterCallback, self);
 }
 
-static void Ucs_InitAmsComponent(CUcs *self)
+/*! \brief  Initializes the AMS component
+ *  \param  self     The instance
+ *  \return Returns \c UCS_RET_SUCCESS if the memory management plug-in is loaded, otherwise
+ *          \c UCS_RET_ERR_PARAM.
+ */
+static Ucs_Return_t Ucs_InitAmsComponent(CUcs *self)
 {
-    Smm_Ctor(&self->msg.smm, self->ucs_user_ptr);
-    (void)Smm_LoadPlugin(&self->msg.smm, &self->msg.ams_allocator, SMM_SIZE_RX_MSG);
+    Ucs_Return_t ret;
+
+    if (self->init_data.ams.arena_ptr != NULL)
+    {
+        Slab_Ctor(&self->msg.slab, self->init_data.ams.arena_ptr, self->init_data.ams.arena_size, self->ucs_user_ptr);
+        ret = Slab_LoadPlugin(&self->msg.slab, &self->msg.ams_allocator, SMM_SIZE_RX_MSG);
+    }
+    else
+    {
+        Smm_Ctor(&self->msg.smm, self->ucs_user_ptr);
+        ret = Smm_LoadPlugin(&self->msg.smm, &self->msg.ams_allocator, SMM_SIZE_RX_MSG);
+    }
 
     TR_ASSERT(self->ucs_user_ptr, "[API]", (self->msg.ams_allocator.alloc_fptr != NULL));
     TR_ASSERT(self->ucs_user_ptr, "[API]", (self->msg.ams_allocator.free_fptr != NULL));
 
-    Amsp_Ctor(&self->msg.ams_pool, &self->msg.ams_allocator, self->ucs_user_ptr);
+    Amsp_Ctor(&self->msg.ams_pool, &self->msg.ams_allocator, &self->general.base.tm, self->ucs_user_ptr);
     Ams_Ctor(&self->msg.ams, &self->general.base, &self->msg.mcm_transceiver, NULL, &self->msg.ams_pool,
              SMM_SIZE_RX_MSG);
     Ams_TxSetDefaultRetries(&self->msg.ams, self->init_data.ams.tx.default_llrbc);
+    Ams_RxSetZeroCopy(&self->msg.ams, self->init_data.ams.rx.zero_copy_segments);
+    Amsp_SetRxRsvdPolicy(&self->msg.ams_pool, self->init_data.ams.rx.is_prio_msg_fptr, self->init_data.ams.rx.num_prio_rsvd_msgs);
 
     Amd_Ctor(&self->msg.amd, &self->general.base, &self->msg.ams);
     Amd_AssignReceiver(&self->msg.amd, &Ucs_AmsRx_Callback, self);
@@ -1602,6 +1957,8 @@ static void Ucs_InitAmsComponent(CUcs *self)
     }
 
     Cmd_Ctor(&self->msg.cmd, &self->general.base);
+
+    return ret;
 }
 
 extern Ucs_AmsTx_Msg_t* Ucs_AmsTx_AllocMsg(Ucs_Inst_t *self, uint16_t data_size)
@@ -1618,6 +1975,31 @@ extern Ucs_AmsTx_Msg_t* Ucs_AmsTx_AllocMsg(Ucs_Inst_t *self, uint16_t data_size)
     return ret_ptr;
 }
 
+extern Ucs_Return_t Ucs_AmsTx_AllocMsgBatch(Ucs_Inst_t *self, uint8_t count, const uint16_t sizes[], Ucs_AmsTx_Msg_t *msgs[])
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if ((sizes == NULL) || (msgs == NULL) || (count == 0U) || (count > UCS_AMSTX_MAX_BATCH_SIZE))
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if ((self_->init_complete != false) && (self_->init_data.ams.enabled == true))
+    {
+        if (Ams_TxGetMsgBatch(&self_->msg.ams, count, sizes, msgs) != false)
+        {
+            ret_val = UCS_RET_SUCCESS;
+        }
+        else
+        {
+            ret_val = UCS_RET_ERR_BUFFER_OVERFLOW;
+            self_->msg.ams_tx_alloc_failed = true;
+        }
+    }
+
+    return ret_val;
+}
+
 extern Ucs_Return_t Ucs_AmsTx_SendMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_CompleteCb_t tx_complete_fptr)
 {
     CUcs *self_ = (CUcs*)(void*)self;
@@ -1631,6 +2013,23 @@ extern Ucs_Return_t Ucs_AmsTx_SendMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr
     return ret_val;
 }
 
+extern Ucs_Return_t Ucs_AmsTx_SendMsgBatch(Ucs_Inst_t *self, uint8_t count, Ucs_AmsTx_Msg_t *msgs[], Ucs_AmsTx_CompleteCb_t tx_complete_fptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if ((msgs == NULL) || (count == 0U) || (count > UCS_AMSTX_MAX_BATCH_SIZE))
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if ((self_->init_complete != false) && (self_->init_data.ams.enabled == true))
+    {
+        ret_val = Ams_TxSendMsgBatch(&self_->msg.ams, count, msgs, NULL, tx_complete_fptr, self_->ucs_user_ptr);
+    }
+
+    return ret_val;
+}
+
 extern void Ucs_AmsTx_FreeUnusedMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr)
 {
     CUcs *self_ = (CUcs*)(void*)self;
@@ -1641,6 +2040,23 @@ extern void Ucs_AmsTx_FreeUnusedMsg(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr)
     }
 }
 
+extern Ucs_Return_t Ucs_AmsTx_SetSharedPayload(Ucs_Inst_t *self, Ucs_AmsTx_Msg_t *msg_ptr, Ucs_AmsTx_SharedPayload_t *payload_ptr)
+{
+    CUcs *self_ = (CUcs*)(void*)self;
+    Ucs_Return_t ret_val = UCS_RET_ERR_NOT_INITIALIZED;
+
+    if ((msg_ptr == NULL) || (payload_ptr == NULL))
+    {
+        ret_val = UCS_RET_ERR_PARAM;
+    }
+    else if ((self_->init_complete != false) && (self_->init_data.ams.enabled == true))
+    {
+        ret_val = Ams_TxSetSharedPayload(&self_->msg.ams, msg_ptr, payload_ptr);
+    }
+
+    return ret_val;
+}
+
 extern Ucs_AmsRx_Msg_t* Ucs_AmsRx_PeekMsg(Ucs_Inst_t *self)
 {
     CUcs *self_ = (CUcs*)(void*)self;
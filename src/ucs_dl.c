@@ -43,6 +43,13 @@
 #include "ucs_dl.h"
 #include "ucs_trace.h"
 
+/*------------------------------------------------------------------------------------------------*/
+/* Internal prototypes                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+#ifdef UCS_DL_CHECK_MEMBERSHIP
+static bool Dl_SearchNode(CDlList *self, const CDlNode *node);
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CDlList                                                                */
 /*------------------------------------------------------------------------------------------------*/
@@ -77,7 +84,7 @@ void Dl_InsertAfter(CDlList *self, CDlNode *node, CDlNode *new_node)
         node->next->prev = new_node;            /* Adjust follower node */
     }
     node->next = new_node;                      /* Adjust parent node */
-    new_node->in_use = true;                    /* Signals that node is part of a list */
+    new_node->list_ptr = self;                  /* Signals that node is part of this list */
     self->size++;                               /* Increment number of nodes */
 }
 
@@ -100,7 +107,7 @@ void Dl_InsertBefore(CDlList *self, CDlNode *node, CDlNode *new_node)
         node->prev->next = new_node;            /* Adjust parent node */
     }
     node->prev = new_node;                      /* Adjust follower node */
-    new_node->in_use = true;                    /* Signals that node is part of a list */
+    new_node->list_ptr = self;                  /* Signals that node is part of this list */
     self->size++;                               /* Increment number of nodes */
 }
 
@@ -117,7 +124,7 @@ void Dl_InsertHead(CDlList *self, CDlNode *new_node)
         self->tail = new_node;
         new_node->prev = NULL;
         new_node->next = NULL;
-        new_node->in_use = true;                /* Signals that node is part of a list */
+        new_node->list_ptr = self;              /* Signals that node is part of this list */
         self->size++;                           /* Increment number of nodes */
     }
     else
@@ -173,7 +180,7 @@ Dl_Ret_t Dl_Remove(CDlList *self, CDlNode *node)
         }
         node->prev = NULL;
         node->next = NULL;
-        node->in_use = false;                   /* Signals that node is not part of a list */
+        node->list_ptr = NULL;                  /* Signals that node is not part of a list */
         ret_val = DL_OK;
         self->size--;                           /* Decrement number of nodes */
     }
@@ -205,7 +212,7 @@ CDlNode * Dl_PopHead(CDlList *self)
         }
         node->prev = NULL;
         node->next = NULL;
-        node->in_use = false;                   /* Signals that node is not part of a list */
+        node->list_ptr = NULL;                  /* Signals that node is not part of a list */
         self->size--;                           /* Decrement number of nodes */
     }
 
@@ -236,7 +243,7 @@ CDlNode * Dl_PopTail(CDlList *self)
         self->tail = node->prev;                /* Replace tail node with previous node in list */
         node->prev = NULL;
         node->next = NULL;
-        node->in_use = false;                   /* Signals that node is not part of a list */
+        node->list_ptr = NULL;                  /* Signals that node is not part of a list */
         self->size--;                           /* Decrement number of nodes */
     }
 
@@ -285,13 +292,34 @@ CDlNode * Dl_Foreach(CDlList *self, Dl_ForeachFunc_t func_ptr, void *user_data_p
     return ret_val;
 }
 
-/*! \brief  Checks if a node is part of the given doubly linked list.
+/*! \brief  Checks if a node is part of the given doubly linked list. The check uses the list
+ *          reference stored in the node and does not search the list.
  *  \param  self   Instance pointer
  *  \param  node   Reference of the searched node
  *  \return \c true: Node is part of the given list
  *  \return \c false: Node is not part of the given list
  */
 bool Dl_IsNodeInList(CDlList *self, const CDlNode *node)
+{
+    bool ret_val = (node->list_ptr == self);
+#ifdef UCS_DL_CHECK_MEMBERSHIP
+    if(ret_val != Dl_SearchNode(self, node))
+    {
+        TR_FAILED_ASSERT(self->ucs_user_ptr, "[DL]");
+    }
+#endif
+    return ret_val;
+}
+
+#ifdef UCS_DL_CHECK_MEMBERSHIP
+/*! \brief  Searches the given node in the doubly linked list. Used to cross-check the list 
+ *          reference stored in the node.
+ *  \param  self   Instance pointer
+ *  \param  node   Reference of the searched node
+ *  \return \c true: Node is part of the given list
+ *  \return \c false: Node is not part of the given list
+ */
+static bool Dl_SearchNode(CDlList *self, const CDlNode *node)
 {
     bool ret_val = false;
     CDlNode *current_node = self->head;
@@ -307,8 +335,16 @@ bool Dl_IsNodeInList(CDlList *self, const CDlNode *node)
     }
     return ret_val;
 }
-
-/*! \brief Appends one doubly linked list to another doubly linked list.
+#endif
+
+/*! \brief Appends one doubly linked list to another doubly linked list. The list reference 
+ *         of all appended nodes is updated.
+ *  \details The lists are spliced in constant time. Only the owner references of the appended 
+ *           nodes are updated by a walk, which keeps Dl_IsNodeInList() and Dl_Remove() constant 
+ *           in time. All callers handle every appended node one by one anyway, i.e. the timer 
+ *           management fires the expired timers, subjects have inserted the delayed observers 
+ *           and the FIFO has re-queued the surviving messages. Thus, the walk does not add to 
+ *           their complexity.
  *  \param self       Instance pointer
  *  \param list_ptr   Reference to the doubly linked list
  */
@@ -317,6 +353,12 @@ void Dl_AppendList(CDlList *self, CDlList *list_ptr)
     TR_ASSERT(self->ucs_user_ptr, "[DL]", (list_ptr != NULL));
     if(list_ptr->head != NULL)
     {
+        CDlNode *node = list_ptr->head;
+        while(node != NULL)                     /* Nodes become part of this list */
+        {
+            node->list_ptr = self;
+            node = node->next;
+        }
         if(self->tail == NULL)             /* Is list empty? */
         {
             self->head = list_ptr->head;
@@ -357,7 +399,7 @@ void Dln_Ctor(CDlNode *self, void *data_ptr)
 {
     self->next = NULL;
     self->prev = NULL;
-    self->in_use = false;
+    self->list_ptr = NULL;
     self->data_ptr = data_ptr;
 }
 
@@ -385,7 +427,7 @@ void * Dln_GetData(CDlNode *self)
  */
 bool Dln_IsNodePartOfAList(CDlNode *self)
 {
-    return self->in_use;
+    return (self->list_ptr != NULL);
 }
 
 /*!
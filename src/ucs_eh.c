@@ -61,7 +61,7 @@ void Eh_Ctor(CEventHandler *self, void * ucs_user_ptr)
     /* Save UNICENS instance ID */
     self->ucs_user_ptr = ucs_user_ptr;
     /* Initialize subject for internal events */
-    Sub_Ctor(&self->internal_event_subject, self->ucs_user_ptr);
+    Msub_Ctor(&self->internal_event_subject, self->ucs_user_ptr);
     /* Initialize subject for public error reporting */
     Ssub_Ctor(&self->public_error_subject, self->ucs_user_ptr);
 }
@@ -139,7 +139,7 @@ static bool Eh_EncodeEvent(uint32_t event_code, Ucs_Error_t *public_error_code_p
  */
 void Eh_AddObsrvInternalEvent(CEventHandler *self, CMaskedObserver *obs_ptr)
 {
-    (void)Sub_AddObserver(&self->internal_event_subject, &obs_ptr->parent);
+    (void)Msub_AddObserver(&self->internal_event_subject, obs_ptr);
 }
 
 /*! \brief Unregisters the given observer from the given event code.
@@ -148,7 +148,7 @@ void Eh_AddObsrvInternalEvent(CEventHandler *self, CMaskedObserver *obs_ptr)
  */
 void Eh_DelObsrvInternalEvent(CEventHandler *self, CMaskedObserver *obs_ptr)
 {
-    (void)Sub_RemoveObserver(&self->internal_event_subject, &obs_ptr->parent);
+    (void)Msub_RemoveObserver(&self->internal_event_subject, obs_ptr);
 }
 
 /*!
@@ -68,6 +68,7 @@ void Jbs_Ctor(CJobService *self, CBase *base_ptr)
     self->base_ptr = base_ptr;
     Dl_Ctor(&self->list, base_ptr->ucs_user_ptr);
     Srv_Ctor(&self->service, JBS_SRV_PRIO, self, &Jbs_Service);
+    SRV_SET_NAME(&self->service, "JBS");
     (void)Scd_AddService(&self->base_ptr->scd, &self->service);
 }
 
@@ -352,6 +353,7 @@ void Mgr_Ctor(CManager *self, CBase *base_ptr, CInic *inic_ptr, CNetworkManageme
     self->packet_bw = packet_bw;
 
     Srv_Ctor(&self->service, MGR_SRV_PRIO, self, &Mgr_Service);             /* register service */
+    SRV_SET_NAME(&self->service, "MGR");
     (void)Scd_AddService(&self->base_ptr->scd, &self->service);
 
     Mobs_Ctor(&self->event_observer, self, EH_E_INIT_SUCCEEDED, &Mgr_OnInitComplete);
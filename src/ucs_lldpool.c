@@ -47,19 +47,35 @@
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation                                                                                 */
 /*------------------------------------------------------------------------------------------------*/
-/*! \brief  Returns an unused LLD Tx message object back to the pool
+/*! \brief  Constructor of the LLD Tx message pool
  *  \param  self        The instance
  *  \param  owner_ptr   Assigns messages to the respective FIFO
+ *  \param  mem_ptr     Optional memory of the pool or \c NULL to use the built-in messages.
+ *                      The required size is calculated by Lldp_GetMemSize().
+ *  \param  size        Number of messages fitting in \c mem_ptr. Valid values: LLDP_NUM_HANDLES..LLDP_NUM_HANDLES_MAX.
  *  \param  ucs_user_ptr User reference that needs to be passed in every callback function
  */
-void Lldp_Ctor(CLldPool *self, void *owner_ptr, void* ucs_user_ptr)
+void Lldp_Ctor(CLldPool *self, void *owner_ptr, void *mem_ptr, uint8_t size, void* ucs_user_ptr)
 {
     uint8_t cnt;
     MISC_MEM_SET(self, 0, sizeof(*self));
 
     Dl_Ctor(&self->list, ucs_user_ptr);
 
-    for (cnt = 0U; cnt < LLDP_NUM_HANDLES; cnt++)         /* setup LLD Tx handles */
+    if (mem_ptr != NULL)                                  /* use memory of the application */
+    {
+        TR_ASSERT(ucs_user_ptr, "[FIFO]", ((size >= LLDP_NUM_HANDLES) && (size <= LLDP_NUM_HANDLES_MAX)));
+        self->messages = (Lld_IntTxMsg_t*)mem_ptr;
+        self->size = size;
+        MISC_MEM_SET(self->messages, 0, Lldp_GetMemSize(size));
+    }
+    else
+    {
+        self->messages = self->messages_default;
+        self->size = LLDP_NUM_HANDLES;
+    }
+
+    for (cnt = 0U; cnt < self->size; cnt++)               /* setup LLD Tx handles */
     {
         TR_ASSERT(ucs_user_ptr, "[FIFO]", (self->messages[cnt].msg_ptr == NULL) );
         Dln_Ctor(&self->messages[cnt].node, &self->messages[cnt]);
@@ -75,6 +91,7 @@ void Lldp_Ctor(CLldPool *self, void *owner_ptr, void* ucs_user_ptr)
 void Lldp_ReturnTxToPool(CLldPool *self, Lld_IntTxMsg_t *msg_ptr)
 {
     Dl_InsertTail(&self->list, &msg_ptr->node);
+    self->stalled = false;
 }
 
 /*! \brief  Allocates an unused LLD Tx message object from the pool
@@ -93,10 +110,46 @@ Lld_IntTxMsg_t* Lldp_GetTxFromPool(CLldPool *self)
     {
         handle_ptr = (Lld_IntTxMsg_t*)Dln_GetData(node_ptr);
     }
+    else if (self->stalled == false)                      /* count every exhaustion only once */
+    {
+        self->stalled = true;
+        self->stall_count++;
+    }
+    else
+    {
+        /* pool is still exhausted */
+    }
 
     return handle_ptr;
 }
 
+/*! \brief  Calculates the memory which is required for a pool
+ *  \param  size    Number of LLD Tx messages
+ *  \return The required memory in bytes
+ */
+uint32_t Lldp_GetMemSize(uint8_t size)
+{
+    return (uint32_t)size * (uint32_t)sizeof(Lld_IntTxMsg_t);
+}
+
+/*! \brief  Retrieves the number of LLD Tx messages of the pool
+ *  \param  self    The instance
+ *  \return The number of LLD Tx messages
+ */
+uint8_t Lldp_GetSize(CLldPool *self)
+{
+    return self->size;
+}
+
+/*! \brief  Retrieves the number of times the pool was exhausted
+ *  \param  self    The instance
+ *  \return The number of times no LLD Tx message was available for a waiting message
+ */
+uint32_t Lldp_GetStallCount(CLldPool *self)
+{
+    return self->stall_count;
+}
+
 /*!
  * @}
  * \endcond
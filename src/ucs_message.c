@@ -73,6 +73,7 @@ void Msg_Ctor(CMessage *self)
     self->pb_msg.tel.tel_len       = 0U; */
 
     self->pb_msg.opts.llrbc     = MSG_LLRBC_DEFAULT;
+    self->tx_prio               = MSG_TX_PRIO_NORMAL;
 
 /*  self->header_rsvd_sz           = 0U;
     self->header_curr_idx          = 0U;
@@ -116,6 +117,34 @@ void Msg_SetExtPayload(CMessage *self, uint8_t *payload_ptr, uint8_t payload_sz,
     self->ext_memory.public_buffer.next_buffer_ptr = NULL;
 }
 
+/*! \brief      Provides the telegram data of a received message as memory buffer
+ *  \details    The external memory buffer is not used by Rx messages. Thus, it is initialized
+ *              to refer to the telegram data and may be chained with memory buffers of further 
+ *              Rx messages. The owning message is retrieved by Msg_GetRxSegmentOwner().
+ *  \param      self    The instance
+ *  \return     Reference to the memory buffer
+ */
+Ucs_Mem_Buffer_t* Msg_GetRxSegment(CMessage *self)
+{
+    self->ext_memory.allocator_ptr = NULL;
+    self->ext_memory.mem_info_ptr  = self;
+    self->ext_memory.public_buffer.data_ptr = self->pb_msg.tel.tel_data_ptr;
+    self->ext_memory.public_buffer.data_size  = self->pb_msg.tel.tel_len;
+    self->ext_memory.public_buffer.total_size = self->pb_msg.tel.tel_len;
+    self->ext_memory.public_buffer.next_buffer_ptr = NULL;
+
+    return &self->ext_memory.public_buffer;
+}
+
+/*! \brief      Retrieves the Rx message which owns a memory buffer
+ *  \param      buffer_ptr  Memory buffer which was provided by Msg_GetRxSegment()
+ *  \return     Reference to the owning message
+ */
+CMessage* Msg_GetRxSegmentOwner(Ucs_Mem_Buffer_t *buffer_ptr)
+{
+    return (CMessage*)((Mem_IntBuffer_t*)(void*)buffer_ptr)->mem_info_ptr;
+}
+
 /*! \brief      Initially defines a header space in front of the data body
  *  \details    Ensure that \c start_ptr is assigned correctly before calling 
  *              this functions.
@@ -239,22 +268,22 @@ bool Msg_IsTxActive(CMessage *self)
     return self->tx_active;
 }
 
-/*! \brief  Marks the message as bypass message
+/*! \brief  Sets the priority class the message is queued with
  *  \param  self       The instance
- *  \param  bypass     Set to \c true if the message is supposed to be a bypass message, otherwise \c false.
+ *  \param  prio       The transmission priority class
  */
-void Msg_SetTxBypass(CMessage *self, bool bypass)
+void Msg_SetTxPrio(CMessage *self, Msg_TxPrio_t prio)
 {
-    self->tx_bypass = bypass;
+    self->tx_prio = prio;
 }
 
-/*! \brief  Checks if the message is marked as bypass message
+/*! \brief  Retrieves the priority class the message is queued with
  *  \param  self       The instance
- *  \return Returns \c true if the message is marked as bypass message, otherwise \c false.
+ *  \return Returns the transmission priority class. The default is MSG_TX_PRIO_NORMAL.
  */
-bool Msg_IsTxBypass(CMessage *self)
+Msg_TxPrio_t Msg_GetTxPrio(CMessage *self)
 {
-    return self->tx_bypass;
+    return self->tx_prio;
 }
 
 /*! \brief  Fires a status notification for the message object
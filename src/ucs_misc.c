@@ -42,10 +42,41 @@
 /*------------------------------------------------------------------------------------------------*/
 #include "ucs_misc.h"
 
+/*------------------------------------------------------------------------------------------------*/
+/* Internal constants                                                                             */
+/*------------------------------------------------------------------------------------------------*/
+#ifdef UCS_MEM_WORD_ACCESS
+/*! \brief Size of a word in bytes */
+static const uint32_t MISC_MEM_WORD_SIZE = 4U;
+/*! \brief Mask to check the word alignment of an address */
+static const uintptr_t MISC_MEM_WORD_MASK = 3U;
+/*! \brief Minimum size in bytes to use word accesses. Smaller sizes are processed bytewise. */
+static const uint32_t MISC_MEM_WORD_THRESHOLD = 16U;
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/* Internal types                                                                                 */
+/*------------------------------------------------------------------------------------------------*/
+#ifdef UCS_MEM_WORD_ACCESS
+#if defined(__GNUC__) || defined(__clang__)
+/*! \brief Word type which may alias objects of any type. Thus, the word accesses do not violate 
+ *         the strict aliasing rules of the compiler's optimizer.
+ */
+typedef uint32_t __attribute__((__may_alias__)) Misc_MemWord_t;
+#else
+/*! \brief Word type used for memory accesses. The compiler must not apply type-based alias 
+ *         analysis to the UNICENS sources if UCS_MEM_WORD_ACCESS is defined (see ucs_cfg.h).
+ */
+typedef uint32_t Misc_MemWord_t;
+#endif
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation                                                                                 */
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief UNICENS internal memset-function.
+ *  \details If the macro UCS_MEM_WORD_ACCESS is defined, the function fills the word aligned
+ *           part of the memory block by 32 bit accesses.
  *  \param dst_ptr Pointer to the block of memory to fill
  *  \param value   Value to be set
  *  \param size    Number of bytes to be set to the value
@@ -53,15 +84,43 @@
 void Misc_MemSet(void *dst_ptr, int32_t value, uint32_t size)
 {
     uint8_t *dst_ptr_ = (uint8_t *)dst_ptr;
-    uint32_t i;
+    uint32_t i = 0U;
+
+#ifdef UCS_MEM_WORD_ACCESS
+    if (size >= MISC_MEM_WORD_THRESHOLD)
+    {
+        uint32_t pattern = (uint32_t)((uint8_t)value) * 0x01010101U;
+        Misc_MemWord_t *word_ptr;
+        uint32_t word_cnt;
+        uint32_t j;
+
+        while (((uintptr_t)&dst_ptr_[i] & MISC_MEM_WORD_MASK) != 0U)    /* fill unaligned head */
+        {
+            dst_ptr_[i] = (uint8_t)value;
+            i++;
+        }
 
-    for(i=0U; i<size; i++)
+        word_ptr = (Misc_MemWord_t *)(void *)&dst_ptr_[i];
+        word_cnt = (size - i) / MISC_MEM_WORD_SIZE;
+
+        for (j = 0U; j < word_cnt; j++)
+        {
+            word_ptr[j] = pattern;
+        }
+
+        i += word_cnt * MISC_MEM_WORD_SIZE;
+    }
+#endif
+
+    for(; i<size; i++)
     {
         dst_ptr_[i] = (uint8_t)value;   /* parasoft-suppress  MISRA2004-17_4 "void pointer required for memset-function signature (stdlib)" */
     }
 }
 
 /*! \brief UNICENS internal memcpy-function.
+ *  \details If the macro UCS_MEM_WORD_ACCESS is defined and source and destination have the 
+ *           same word alignment, the function copies the aligned part by 32 bit accesses.
  *  \param dst_ptr Pointer to the destination array where the content is to be copied
  *  \param src_ptr Pointer to the source of data to be copied
  *  \param size    Number of bytes to copy
@@ -70,9 +129,37 @@ void Misc_MemCpy(void *dst_ptr, void *src_ptr, uint32_t size)
 {
     uint8_t *dst_ptr_ = (uint8_t *)dst_ptr;
     uint8_t *src_ptr_ = (uint8_t *)src_ptr;
-    uint32_t i;
+    uint32_t i = 0U;
+
+#ifdef UCS_MEM_WORD_ACCESS
+    if ((size >= MISC_MEM_WORD_THRESHOLD) &&
+        ((((uintptr_t)dst_ptr_ ^ (uintptr_t)src_ptr_) & MISC_MEM_WORD_MASK) == 0U))
+    {
+        Misc_MemWord_t *dst_word_ptr;
+        const Misc_MemWord_t *src_word_ptr;
+        uint32_t word_cnt;
+        uint32_t j;
+
+        while (((uintptr_t)&dst_ptr_[i] & MISC_MEM_WORD_MASK) != 0U)    /* copy unaligned head */
+        {
+            dst_ptr_[i] = src_ptr_[i];
+            i++;
+        }
+
+        dst_word_ptr = (Misc_MemWord_t *)(void *)&dst_ptr_[i];
+        src_word_ptr = (const Misc_MemWord_t *)(const void *)&src_ptr_[i];
+        word_cnt = (size - i) / MISC_MEM_WORD_SIZE;
+
+        for (j = 0U; j < word_cnt; j++)
+        {
+            dst_word_ptr[j] = src_word_ptr[j];
+        }
+
+        i += word_cnt * MISC_MEM_WORD_SIZE;
+    }
+#endif
 
-    for(i=0U; i<size; i++)
+    for(; i<size; i++)
     {
         dst_ptr_[i] = src_ptr_[i];  /* parasoft-suppress  MISRA2004-17_4 "void pointers required for memcpy-function signature (stdlib)" */
     }
@@ -77,15 +77,16 @@ void Net_Ctor(CNetworkManagement *self, Net_InitData_t *init_ptr)
     Inic_AddObsrvNwStatus(self->inic_ptr, &self->network_status.observer);
     self->network_status.param.change_mask = 0xFFFFU;               /* Used for initial notification! */
     Sub_Ctor(&self->network_status.pre_subject, self->base_ptr->ucs_user_ptr);
-    Sub_Ctor(&self->network_status.subject, self->base_ptr->ucs_user_ptr);
+    Msub_Ctor(&self->network_status.subject, self->base_ptr->ucs_user_ptr);
 
     Obs_Ctor(&self->network_configuration.observer, self, &Net_UpdateNetworkConfiguration);
     Inic_AddObsvrNwConfig(self->inic_ptr, &self->network_configuration.observer);
     self->network_configuration.param.change_mask = 0xFFFFU;        /* Used for initial notification! */
     Sub_Ctor(&self->network_configuration.pre_subject, self->base_ptr->ucs_user_ptr);
-    Sub_Ctor(&self->network_configuration.subject, self->base_ptr->ucs_user_ptr);
+    Msub_Ctor(&self->network_configuration.subject, self->base_ptr->ucs_user_ptr);
 
     Srv_Ctor(&self->net_srv, NET_SRV_PRIO, self, &Net_Service);     /* Initialize Network Management service */
+    SRV_SET_NAME(&self->net_srv, "NET");
     (void)Scd_AddService(&self->base_ptr->scd, &self->net_srv);     /* Add NET service to scheduler */
 }
 
@@ -104,8 +105,8 @@ static void Net_Service(void *self)
         self_->network_status.param.change_mask = 0xFFFFU;
         Sub_Notify(&self_->network_status.pre_subject, &self_->network_status.param);
         self_->network_status.param.change_mask = 0U;
-        (void)Sub_SwitchObservers(&self_->network_status.subject,
-                                  &self_->network_status.pre_subject);
+        (void)Msub_SwitchObservers(&self_->network_status.subject,
+                                   &self_->network_status.pre_subject);
     }
     /* Notification of MOST Network Configuration triggered? */
     if((event_mask & NET_EVENT_NOTIFY_NW_CONFIG) == NET_EVENT_NOTIFY_NW_CONFIG)
@@ -114,8 +115,8 @@ static void Net_Service(void *self)
         self_->network_configuration.param.change_mask = 0xFFFFU;
         Sub_Notify(&self_->network_configuration.pre_subject, &self_->network_configuration.param);
         self_->network_configuration.param.change_mask = 0U;
-        (void)Sub_SwitchObservers(&self_->network_configuration.subject,
-                                  &self_->network_configuration.pre_subject);
+        (void)Msub_SwitchObservers(&self_->network_configuration.subject,
+                                   &self_->network_configuration.pre_subject);
     }
 }
 
@@ -125,7 +126,7 @@ static void Net_Service(void *self)
  */
 void Net_AddObserverNetworkStatus(CNetworkManagement *self, CMaskedObserver *obs_ptr)
 {
-    (void)Msub_AddObserver(&self->network_status.pre_subject, obs_ptr);
+    (void)Sub_AddObserver(&self->network_status.pre_subject, &obs_ptr->parent);
     Srv_SetEvent(&self->net_srv, NET_EVENT_NOTIFY_NW_STATUS);
 }
 
@@ -136,7 +137,7 @@ void Net_AddObserverNetworkStatus(CNetworkManagement *self, CMaskedObserver *obs
  */
 void Net_DelObserverNetworkStatus(CNetworkManagement *self, CMaskedObserver *obs_ptr)
 {
-    (void)Msub_RemoveObserver(&self->network_status.pre_subject, obs_ptr);
+    (void)Sub_RemoveObserver(&self->network_status.pre_subject, &obs_ptr->parent);
     (void)Msub_RemoveObserver(&self->network_status.subject, obs_ptr);
 }
 
@@ -146,7 +147,7 @@ void Net_DelObserverNetworkStatus(CNetworkManagement *self, CMaskedObserver *obs
  */
 void Net_AddObserverNetworkConfig(CNetworkManagement *self, CMaskedObserver *obs_ptr)
 {
-    (void)Msub_AddObserver(&self->network_configuration.pre_subject, obs_ptr);
+    (void)Sub_AddObserver(&self->network_configuration.pre_subject, &obs_ptr->parent);
     Srv_SetEvent(&self->net_srv, NET_EVENT_NOTIFY_NW_CONFIG);
 }
 
@@ -156,7 +157,7 @@ void Net_AddObserverNetworkConfig(CNetworkManagement *self, CMaskedObserver *obs
  */
 void Net_DelObserverNetworkConfig(CNetworkManagement *self, CMaskedObserver *obs_ptr)
 {
-    (void)Msub_RemoveObserver(&self->network_configuration.pre_subject, obs_ptr);
+    (void)Sub_RemoveObserver(&self->network_configuration.pre_subject, &obs_ptr->parent);
     (void)Msub_RemoveObserver(&self->network_configuration.subject, obs_ptr);
 }
 
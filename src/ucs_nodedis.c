@@ -54,6 +54,7 @@
 #define ND_NUM_EVENTS            14U    /*!< \brief Number of state machine events */
 
 #define ND_TIMEOUT_PERIODIC     5000U   /*!< \brief 5s timeout */
+#define ND_SLACK_PERIODIC        500U   /*!< \brief Tolerated delay of the periodic timer */
 #define ND_TIMEOUT_WELCOME       100U   /*!< \brief Supervises EXC.Welcome.StartResult command */
 #define ND_TIMEOUT_SIGNATURE     300U   /*!< \brief Supervises EXC.Signature.Get command, takes 
                                                     LLRs into account. */
@@ -282,6 +283,7 @@ void Nd_Ctor(CNodeDiscovery *self, CInic *inic, CBase *base, CExc *exc, Nd_InitD
 
     /* Initialize Node Discovery service */
     Srv_Ctor(&self->service, ND_SRV_PRIO, self, &Nd_Service);
+    SRV_SET_NAME(&self->service, "ND");
     /* Add Node Discovery service to scheduler */
     (void)Scd_AddService(&self->base->scd, &self->service);
 
@@ -1056,12 +1058,13 @@ static void Nd_Start_Periodic_Timer(void *self)
 {
     CNodeDiscovery *self_ = (CNodeDiscovery *)self;
 
-    Tm_SetTimer(&self_->base->tm,
-                &self_->timer,
-                &Nd_TimerCb,
-                self,
-                ND_TIMEOUT_PERIODIC,
-                0U);
+    Tm_SetTimerEx(&self_->base->tm,
+                  &self_->timer,
+                  &Nd_TimerCb,
+                  self,
+                  ND_TIMEOUT_PERIODIC,
+                  0U,
+                  ND_SLACK_PERIODIC);
 }
 
 /*! \brief  Starts the debounce timer
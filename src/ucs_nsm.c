@@ -105,6 +105,7 @@ void Nsm_Ctor(CNodeScriptManagement *self, Nsm_InitData_t *init_ptr)
 
     /* Initialize NSM service */
     Srv_Ctor(&self->nsm_srv, NSM_SRV_PRIO, self, &Nsm_Service);
+    SRV_SET_NAME(&self->nsm_srv, "NSM");
 
     /* Initialize API locking mechanism */
     Sobs_Ctor(&self->lock.observer, self, &Nsm_HandleApiTimeout);
@@ -50,6 +50,9 @@
 /*------------------------------------------------------------------------------------------------*/
 static void Sub_UpdateList(CSubject *self);
 static bool Sub_CheckObserver(void *current_obs_ptr, void *subject_ptr);
+static void Msub_InsertObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr);
+static bool Msub_IsObserverInGroup(CMaskedSubject *self, CMaskedObserver *obs_ptr);
+static void Msub_UpdateGroups(CMaskedSubject *self);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CSubject                                                               */
@@ -372,6 +375,8 @@ void Mobs_Ctor(CMaskedObserver *self,
 }
 
 /*! \brief Sets the notification mask of a masked-observer.
+ *  \note  The observer must not be added to a masked-subject. Otherwise, the observer group 
+ *         does not reflect the new notification mask.
  *  \param self     Instance pointer
  *  \param mask     Bitmask to set
  */
@@ -390,60 +395,265 @@ uint32_t Mobs_GetNotificationMask(CMaskedObserver *self)
 }
 
 /*------------------------------------------------------------------------------------------------*/
-/* Additional methods of class CSubject used in combination with CMaskedObserver                  */
+/* Implementation of class CMaskedSubject                                                         */
 /*------------------------------------------------------------------------------------------------*/
-/*! \brief  Adds an masked-observer to a masked-subjects list.
+/*! \brief Constructor of the masked-subject class. Initializes a subject which distributes its 
+ *         data to the interested masked-observers.
+ *  \param self        Instance pointer
+ *  \param ucs_user_ptr User reference that needs to be passed in every callback function
+ */
+void Msub_Ctor(CMaskedSubject *self, void *ucs_user_ptr)
+{
+    uint8_t i;
+
+    MISC_MEM_SET(self, 0, sizeof(*self));
+    Sub_Ctor(&self->parent, ucs_user_ptr);
+    for(i = 0U; i < MSUB_NUM_GROUPS; i++)
+    {
+        Dl_Ctor(&self->groups[i].list, ucs_user_ptr);
+    }
+}
+
+/*! \brief  Adds an masked-observer to a masked-subject.
  *  \param  self       Instance pointer
  *  \param  obs_ptr    Pointer to observer instance
  *  \return \c SUB_OK: No error
+ *  \return \c SUB_DELAYED: Operation is queued since notification is still active
  *  \return \c SUB_ALREADY_ADDED: Observer is already added
  *  \return \c SUB_UNKNOWN_OBSERVER: Given observer is not valid
  */
-Sub_Ret_t Msub_AddObserver(CSubject *self, CMaskedObserver *obs_ptr)
+Sub_Ret_t Msub_AddObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr)
 {
-    return Sub_AddObserver(self, &obs_ptr->parent);
+    Sub_Ret_t ret_val;
+    if(obs_ptr == NULL)
+    {
+        ret_val = SUB_UNKNOWN_OBSERVER;
+    }
+    else if(obs_ptr->parent.valid != false)
+    {
+        ret_val = SUB_ALREADY_ADDED;
+    }
+    else if(Dln_IsNodePartOfAList(&obs_ptr->parent.node) != false)
+    {
+        ret_val = SUB_UNKNOWN_OBSERVER;
+    }
+    else if(self->parent.notify != false)
+    {
+        TR_ASSERT(self->parent.ucs_user_ptr, "[OBS]", (self->parent.num_observers < 0xFFU));
+        Dl_InsertTail(&self->parent.add_list, &obs_ptr->parent.node);
+        obs_ptr->parent.valid = true;
+        self->parent.changed = true;
+        ret_val = SUB_DELAYED;
+    }
+    else
+    {
+        TR_ASSERT(self->parent.ucs_user_ptr, "[OBS]", (self->parent.num_observers < 0xFFU));
+        Msub_InsertObserver(self, obs_ptr);
+        obs_ptr->parent.valid = true;
+        ret_val = SUB_OK;
+    }
+    return ret_val;
 }
 
-/*! \brief  Removes an masked-observer from a subjects list.
+/*! \brief  Removes an masked-observer from a masked-subject.
  *  \param  self       Instance pointer
  *  \param  obs_ptr    Pointer to observer instance
  *  \return \c SUB_OK: No error
+ *  \return \c SUB_DELAYED: Operation is queued since notification is still active
  *  \return \c SUB_UNKNOWN_OBSERVER: Unknown observer is given
  *  \return \c SUB_UNKNOWN_OBSERVER: Given observer is not valid
  */
-Sub_Ret_t Msub_RemoveObserver(CSubject *self, CMaskedObserver *obs_ptr)
+Sub_Ret_t Msub_RemoveObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr)
 {
-    return Sub_RemoveObserver(self, &obs_ptr->parent);
+    Sub_Ret_t ret_val;
+    if((obs_ptr == NULL) || (obs_ptr->parent.valid == false) || 
+       (Msub_IsObserverInGroup(self, obs_ptr) == false))
+    {
+        ret_val = SUB_UNKNOWN_OBSERVER;
+    }
+    else if(self->parent.notify != false)
+    {
+        TR_ASSERT(self->parent.ucs_user_ptr, "[OBS]", (self->parent.num_observers > 0U));
+        obs_ptr->parent.valid = false;
+        self->parent.changed = true;
+        self->parent.num_observers--;
+        ret_val = SUB_DELAYED;
+    }
+    else
+    {
+        TR_ASSERT(self->parent.ucs_user_ptr, "[OBS]", (self->parent.num_observers > 0U));
+        (void)Dl_Remove(obs_ptr->parent.node.list_ptr, &obs_ptr->parent.node);
+        self->parent.num_observers--;
+        ret_val = SUB_OK;
+    }
+    return ret_val;
 }
 
-/*! \brief Notifies all registered masked-observers of a masked-subject.
+/*! \brief Notifies the interested masked-observers of a masked-subject. Only the observer groups 
+ *         whose mask matches the given notification mask are visited.
  *  \param self                 Instance pointer
  *  \param data_ptr             Reference to value to distribute (optional)
  *  \param notification_mask    Bitmask indicates notified observers
  */
-void Msub_Notify(CSubject *self, void *data_ptr, uint32_t notification_mask)
+void Msub_Notify(CMaskedSubject *self, void *data_ptr, uint32_t notification_mask)
 {
     if(self != NULL)
     {
-        CDlNode *n_tmp = self->list.head;
-        self->notify = true;
-        self->changed = false;
+        uint8_t i;
+        self->parent.notify = true;
+        self->parent.changed = false;
+        for(i = 0U; i < MSUB_NUM_GROUPS; i++)
+        {
+            if((self->groups[i].mask & notification_mask) != 0U)
+            {
+                CDlNode *n_tmp = self->groups[i].list.head;
+                while(n_tmp != NULL)
+                {
+                    CMaskedObserver *o_tmp = (CMaskedObserver *)n_tmp->data_ptr;
+                    if( (o_tmp->parent.update_fptr != NULL)  &&
+                        (o_tmp->parent.valid != false)      &&
+                        ((o_tmp->notification_mask & notification_mask) != 0U) )
+                    {
+                        (o_tmp->parent.update_fptr)(o_tmp->parent.inst_ptr, data_ptr);
+                    }
+                    n_tmp = n_tmp->next;
+                }
+            }
+        }
+        if(self->parent.changed != false)
+        {
+            Msub_UpdateGroups(self);
+        }
+        self->parent.notify = false;
+    }
+}
+
+/*! \brief  Returns the number of registered masked-observers of a masked-subject.
+ *  \param  self   Instance pointer
+ *  \return The number of registered masked-observers
+ */
+uint8_t Msub_GetNumObservers(CMaskedSubject *self)
+{
+    return self->parent.num_observers;
+}
+
+/*! \brief  Switches all masked-observers of the source-subject to the target masked-subject.
+ *  \details The source-subject must only contain masked-observers.
+ *  \param  sub_target  Target masked-subject
+ *  \param  sub_source  Source subject
+ *  \return \c SUB_OK: No error
+ *  \return \c SUB_INVALID_OPERATION: The notification of the target is in progress
+ */
+Sub_Ret_t Msub_SwitchObservers(CMaskedSubject *sub_target, CSubject *sub_source)
+{
+    Sub_Ret_t ret_val = SUB_INVALID_OPERATION;
+
+    if(sub_target->parent.notify == false)
+    {
+        CDlNode *n_tmp = Dl_PopHead(&sub_source->list);
         while(n_tmp != NULL)
         {
-            CMaskedObserver *o_tmp = (CMaskedObserver *)n_tmp->data_ptr;
-            if( (o_tmp->parent.update_fptr != NULL)  &&
-                (o_tmp->parent.valid != false)      &&
-                ((o_tmp->notification_mask & notification_mask) != 0U) )
+            Msub_InsertObserver(sub_target, (CMaskedObserver *)n_tmp->data_ptr);
+            n_tmp = Dl_PopHead(&sub_source->list);
+        }
+        sub_source->num_observers = 0U;
+        ret_val = SUB_OK;
+    }
+    return ret_val;
+}
+
+/*! \brief  Inserts a masked-observer into the group of its notification mask. A free group is 
+ *          assigned to a new mask. If no group is free the last group takes the observer.
+ *  \param  self       Instance pointer
+ *  \param  obs_ptr    Pointer to observer instance
+ */
+static void Msub_InsertObserver(CMaskedSubject *self, CMaskedObserver *obs_ptr)
+{
+    uint8_t index = MSUB_NUM_GROUPS;
+    uint8_t i;
+
+    for(i = 0U; i < MSUB_NUM_GROUPS; i++)
+    {
+        if(Dl_GetSize(&self->groups[i].list) == 0U)
+        {
+            if(index == MSUB_NUM_GROUPS)
             {
-                (o_tmp->parent.update_fptr)(o_tmp->parent.inst_ptr, data_ptr);
+                index = i;                                      /* remember first free group */
             }
-            n_tmp = n_tmp->next;
         }
-        if(self->changed != false)
+        else if(self->groups[i].mask == obs_ptr->notification_mask)
         {
-            Sub_UpdateList(self);
+            index = i;                                          /* group of the same mask */
+            break;
         }
-        self->notify = false;
+        else
+        {
+            /* group of another mask */
+        }
+    }
+
+    if(index == MSUB_NUM_GROUPS)
+    {
+        index = MSUB_NUM_GROUPS - 1U;                           /* all groups are occupied */
+        self->groups[index].mask |= obs_ptr->notification_mask;
+    }
+    else if(Dl_GetSize(&self->groups[index].list) == 0U)
+    {
+        self->groups[index].mask = obs_ptr->notification_mask;
+    }
+    else
+    {
+        /* mask of the group is already correct */
+    }
+
+    Dl_InsertTail(&self->groups[index].list, &obs_ptr->parent.node);
+    self->parent.num_observers++;
+}
+
+/*! \brief  Checks if a masked-observer is part of a group of the masked-subject.
+ *  \param  self       Instance pointer
+ *  \param  obs_ptr    Pointer to observer instance
+ *  \return Returns \c true if the observer is part of a group, otherwise \c false.
+ */
+static bool Msub_IsObserverInGroup(CMaskedSubject *self, CMaskedObserver *obs_ptr)
+{
+    bool ret_val = false;
+    uint8_t i;
+
+    for(i = 0U; (i < MSUB_NUM_GROUPS) && (ret_val == false); i++)
+    {
+        ret_val = Dl_IsNodeInList(&self->groups[i].list, &obs_ptr->parent.node);
+    }
+    return ret_val;
+}
+
+/*! \brief Updates the observer groups. Delayed remove- and add-operations are processed.
+ *  \param self   Instance pointer
+ */
+static void Msub_UpdateGroups(CMaskedSubject *self)
+{
+    CDlNode *n_tmp;
+    uint8_t i;
+
+    for(i = 0U; i < MSUB_NUM_GROUPS; i++)
+    {
+        n_tmp = self->groups[i].list.head;
+        while(n_tmp != NULL)
+        {
+            CDlNode *n_next = n_tmp->next;
+            if(((CObserver *)n_tmp->data_ptr)->valid == false)
+            {
+                (void)Dl_Remove(&self->groups[i].list, n_tmp);
+            }
+            n_tmp = n_next;
+        }
+    }
+
+    n_tmp = Dl_PopHead(&self->parent.add_list);
+    while(n_tmp != NULL)
+    {
+        Msub_InsertObserver(self, (CMaskedObserver *)n_tmp->data_ptr);
+        n_tmp = Dl_PopHead(&self->parent.add_list);
     }
 }
 
@@ -48,6 +48,16 @@
 /*------------------------------------------------------------------------------------------------*/
 /* Internal Constants                                                                             */
 /*------------------------------------------------------------------------------------------------*/
+/*! \brief Divisor of the Rx pool size which yields the maximum number of detached Rx messages */
+static const uint16_t    PMCH_RX_DETACH_DIVISOR = 2U;
+#ifdef UCS_ATOMIC_EVENTS
+/*! \brief Priority of the PMCH service */
+static const uint8_t     PMCH_SRV_PRIO          = 253U; /* parasoft-suppress  MISRA2004-8_7 "configuration property" */
+/*! \brief Event for handling received messages */
+static const Srv_Event_t PMCH_EVENT_RX          = 0x01U;
+/*! \brief Event for handling released Tx messages */
+static const Srv_Event_t PMCH_EVENT_TX_RELEASE  = 0x02U;
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Internal typedefs                                                                              */
@@ -61,6 +71,14 @@ static Ucs_Lld_RxMsg_t* Pmch_RxAllocate(void *self, uint16_t buffer_size);
 static void Pmch_RxUnused(void *self, Ucs_Lld_RxMsg_t *msg_ptr);
 static void Pmch_RxReceive(void *self, Ucs_Lld_RxMsg_t *msg_ptr);
 static void Pmch_TxRelease(void *self, Ucs_Lld_TxMsg_t *msg_ptr);
+static uint8_t Pmch_RxAllocateBatch(void *self, uint16_t buffer_size, Ucs_Lld_RxMsg_t *msgs[], uint8_t count);
+static void Pmch_RxReceiveBatch(void *self, Ucs_Lld_RxMsg_t *msgs[], uint8_t count);
+#ifdef UCS_ATOMIC_EVENTS
+static void Pmch_RxReceiveAsync(void *self, Ucs_Lld_RxMsg_t *msg_ptr);
+static void Pmch_RxReceiveBatchAsync(void *self, Ucs_Lld_RxMsg_t *msgs[], uint8_t count);
+static void Pmch_TxReleaseAsync(void *self, Ucs_Lld_TxMsg_t *msg_ptr);
+static void Pmch_Service(void *self);
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation                                                                                 */
@@ -82,10 +100,54 @@ void Pmch_Ctor(CPmChannel *self, const Pmch_InitData_t *init_ptr)
     self->ucs_iface.rx_receive_fptr        = &Pmch_RxReceive;
     self->ucs_iface.rx_free_unused_fptr    = &Pmch_RxUnused;
     self->ucs_iface.tx_release_fptr        = &Pmch_TxRelease;
-
+    self->ucs_iface.rx_allocate_batch_fptr = &Pmch_RxAllocateBatch;
+    self->ucs_iface.rx_receive_batch_fptr  = &Pmch_RxReceiveBatch;
+#ifdef UCS_ATOMIC_EVENTS
+    self->ucs_iface.rx_receive_fptr        = &Pmch_RxReceiveAsync;
+    self->ucs_iface.rx_receive_batch_fptr  = &Pmch_RxReceiveBatchAsync;
+    self->ucs_iface.tx_release_fptr        = &Pmch_TxReleaseAsync;
+    atomic_init(&self->rx_async_head, NULL);
+    atomic_init(&self->tx_async_head, NULL);
+    Srv_Ctor(&self->service, PMCH_SRV_PRIO, self, &Pmch_Service);
+    SRV_SET_NAME(&self->service, "PMCH");
+    (void)Scd_AddService(&self->init_data.base_ptr->scd, &self->service);
+#endif
+
+#ifdef UCS_LLD_RX_POOL_EXTERNAL
+    TR_ASSERT(self->init_data.ucs_user_ptr, "[PMCH]", (self->init_data.rx_pool_mem_ptr != NULL));
+    self->rx_pool_size = self->init_data.rx_pool_size;              /* use memory of the application */
+    self->rx_msgs      = (CMessage*)self->init_data.rx_pool_mem_ptr;
+    self->lld_rx_msgs  = (Lld_IntRxMsg_t*)(void*)&self->rx_msgs[self->rx_pool_size];
+#else
+    if (self->init_data.rx_pool_mem_ptr != NULL)                    /* use memory of the application */
+    {
+        self->rx_pool_size = self->init_data.rx_pool_size;
+        self->rx_msgs      = (CMessage*)self->init_data.rx_pool_mem_ptr;
+        self->lld_rx_msgs  = (Lld_IntRxMsg_t*)(void*)&self->rx_msgs[self->rx_pool_size];
+    }
+    else
+    {
+        self->rx_pool_size = PMCH_POOL_SIZE_RX;
+        self->rx_msgs      = self->rx_msgs_default;
+        self->lld_rx_msgs  = self->lld_rx_msgs_default;
+    }
+#endif
+
+    self->rx_detached_max = self->rx_pool_size / PMCH_RX_DETACH_DIVISOR;
+
+#ifdef UCS_ATOMIC_EVENTS
+    atomic_init(&self->rx_trigger_available, false);
+    atomic_init(&self->rx_low_water_mark, self->rx_pool_size);
+    atomic_init(&self->rx_alloc_failures, 0U);
+    atomic_init(&self->rx_stall_count, 0U);
+    Lfp_Ctor(&self->rx_msgs_pool, self->rx_msgs,                    /* initialize Rx message pool */
+             self->rx_pool_size, self->init_data.ucs_user_ptr);
+#else
+    self->rx_low_water_mark = self->rx_pool_size;
     Pool_Ctor(&self->rx_msgs_pool, self->rx_msgs,                   /* initialize Rx message pool */
-              PMCH_POOL_SIZE_RX, self->init_data.ucs_user_ptr);
-    for (cnt = 0U; cnt < PMCH_POOL_SIZE_RX; cnt++)                  /* and assign LLD Rx handles  */
+              self->rx_pool_size, self->init_data.ucs_user_ptr);
+#endif
+    for (cnt = 0U; cnt < self->rx_pool_size; cnt++)                 /* and assign LLD Rx handles  */
     {
         Msg_SetLldHandle(&self->rx_msgs[cnt], &self->lld_rx_msgs[cnt]);
         self->lld_rx_msgs[cnt].msg_ptr = &self->rx_msgs[cnt];
@@ -153,10 +215,54 @@ void Pmch_Transmit(CPmChannel *self, Ucs_Lld_TxMsg_t *msg_ptr)
     }
 }
 
+/*! \brief      Wrapper for LLD transmit of a message chain
+ *  \details    The messages are linked by \c custom_next_msg_ptr and forwarded to the LLD 
+ *              in one call. Shall only be used if Pmch_IsTxBatchEnabled() returns \c true.
+ *  \param      self    The instance
+ *  \param      msg_ptr Reference to the first public LLD message of the chain
+ */
+void Pmch_TransmitChain(CPmChannel *self, Ucs_Lld_TxMsg_t *msg_ptr)
+{
+    if (self->lld_active != false)
+    {
+        self->init_data.lld_iface.tx_transmit_fptr(msg_ptr, self->init_data.lld_iface.lld_user_ptr);
+    }
+    else
+    {
+        while (msg_ptr != NULL)                                 /* release every message separately */
+        {
+            Ucs_Lld_TxMsg_t *next_ptr = msg_ptr->custom_next_msg_ptr;
+            msg_ptr->custom_next_msg_ptr = NULL;
+            Pmch_TxRelease(self, msg_ptr);
+            msg_ptr = next_ptr;
+        }
+    }
+}
+
+/*! \brief      Checks if the LLD is started
+ *  \param      self    The instance
+ *  \return     Returns \c true between Pmch_Initialize() and Pmch_Uninitialize(), otherwise \c false.
+ */
+bool Pmch_IsLldActive(CPmChannel *self)
+{
+    return self->lld_active;
+}
+
+/*! \brief      Checks if the LLD accepts chained Tx messages
+ *  \param      self    The instance
+ *  \return     Returns \c true if Pmch_TransmitChain() can be used, otherwise \c false.
+ */
+bool Pmch_IsTxBatchEnabled(CPmChannel *self)
+{
+    return self->init_data.lld_iface.tx_batch_enabled;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* The exposed low-level driver interface                                                         */
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief  Allocates an Rx message object 
+ *  \details If the macro UCS_ATOMIC_EVENTS is defined the function may be called from the 
+ *           thread of the LLD, but not from multiple threads concurrently.
  *  \param  self        The instance
  *  \param  buffer_size Size of the memory chunk in bytes which is needed to
  *                      copy the Rx message.
@@ -170,10 +276,39 @@ static Ucs_Lld_RxMsg_t* Pmch_RxAllocate(void *self, uint16_t buffer_size)
 
     if (buffer_size <= MSG_SIZE_RSVD_BUFFER)
     {
+#ifdef UCS_ATOMIC_EVENTS
+        msg_ptr = Lfp_GetMsg(&self_->rx_msgs_pool);
+        if (msg_ptr == NULL)
+        {
+            /* Request the trigger before retrying. Thus, a message returned in the meantime is
+             * either retrieved by the retry or announced by Pmch_ReturnRxToPool(). */
+            atomic_store(&self_->rx_trigger_available, true);
+            msg_ptr = Lfp_GetMsg(&self_->rx_msgs_pool);
+            if (msg_ptr != NULL)
+            {
+                /* The retry succeeded -> withdraw the trigger to avoid a needless notification */
+                atomic_store(&self_->rx_trigger_available, false);
+            }
+        }
+#else
         msg_ptr = Pool_GetMsg(&self_->rx_msgs_pool);
+#endif
 
         if (msg_ptr != NULL)
         {
+#ifdef UCS_ATOMIC_EVENTS
+            uint16_t available = Lfp_GetCurrentSize(&self_->rx_msgs_pool);
+            if (available < atomic_load(&self_->rx_low_water_mark))
+            {
+                atomic_store(&self_->rx_low_water_mark, available);
+            }
+#else
+            uint16_t available = Pool_GetCurrentSize(&self_->rx_msgs_pool);
+            if (available < self_->rx_low_water_mark)
+            {
+                self_->rx_low_water_mark = available;
+            }
+#endif
             Msg_Cleanup(msg_ptr);
             handle = &((Lld_IntRxMsg_t*)Msg_GetLldHandle(msg_ptr))->lld_msg;
 
@@ -184,13 +319,30 @@ static Ucs_Lld_RxMsg_t* Pmch_RxAllocate(void *self, uint16_t buffer_size)
         }
         else
         {
+#ifdef UCS_ATOMIC_EVENTS
+            (void)atomic_fetch_add(&self_->rx_alloc_failures, 1U);
+#else
+            if (self_->rx_trigger_available == false)
+            {
+                self_->rx_stall_start = Tm_GetTickCount(&self_->init_data.base_ptr->tm);
+            }
             self_->rx_trigger_available = true;
+            self_->rx_alloc_failures++;
+#endif
             TR_INFO((self_->init_data.ucs_user_ptr, "[PMCH]", "Pmch_RxAllocate(): Allocation failed, size=%u", 1U, buffer_size));
         }
     }
     else
     {
-        self_->rx_trigger_available = true;         
+#ifdef UCS_ATOMIC_EVENTS
+        atomic_store(&self_->rx_trigger_available, true);
+#else
+        if (self_->rx_trigger_available == false)
+        {
+            self_->rx_stall_start = Tm_GetTickCount(&self_->init_data.base_ptr->tm);
+        }
+        self_->rx_trigger_available = true;
+#endif
         TR_FAILED_ASSERT(self_->init_data.ucs_user_ptr, "[PMCH]");
     }
 
@@ -254,6 +406,54 @@ static void Pmch_RxReceive(void *self, Ucs_Lld_RxMsg_t *msg_ptr)
     }
 }
 
+/*! \brief  Allocates several Rx message objects of the same size
+ *  \param  self        The instance
+ *  \param  buffer_size Size of every memory chunk in bytes
+ *  \param  msgs        Receives the allocated Rx message objects
+ *  \param  count       Number of requested Rx message objects
+ *  \return The number of allocated Rx message objects
+ */
+static uint8_t Pmch_RxAllocateBatch(void *self, uint16_t buffer_size, Ucs_Lld_RxMsg_t *msgs[], uint8_t count)
+{
+    uint8_t num = 0U;
+
+    while (num < count)
+    {
+        msgs[num] = Pmch_RxAllocate(self, buffer_size);
+
+        if (msgs[num] == NULL)
+        {
+            break;                                                          /* pool is exhausted */
+        }
+
+        num++;
+    }
+
+    return num;
+}
+
+/*! \brief  Pass several Rx messages to UNICENS
+ *  \details The messages are forwarded to the respective FIFOs in one pass. The service 
+ *           request is notified at most once for the whole batch.
+ *  \param  self        The instance
+ *  \param  msgs        Array of Rx message objects containing the received messages
+ *  \param  count       Number of Rx message objects
+ */
+static void Pmch_RxReceiveBatch(void *self, Ucs_Lld_RxMsg_t *msgs[], uint8_t count)
+{
+    CPmChannel *self_ = (CPmChannel*)self;
+    uint8_t i;
+
+    Scd_DeferRequest(&self_->init_data.base_ptr->scd);
+
+    for (i = 0U; i < count; i++)
+    {
+        Pmch_RxReceive(self_, msgs[i]);
+    }
+
+    Scd_ReleaseRequest(&self_->init_data.base_ptr->scd);
+}
+
 /*! \brief  Notifies that the LLD no longer needs to access the Tx message object
  *  \param  self        The instance
  *  \param  msg_ptr     Reference to the Tx message object which is no longer accessed
@@ -281,6 +481,138 @@ static void Pmch_TxRelease(void *self, Ucs_Lld_TxMsg_t *msg_ptr)
 
 }
 
+#ifdef UCS_ATOMIC_EVENTS
+/*! \brief  Pass an Rx message to UNICENS from any thread
+ *  \details The message is pushed onto a lock-free queue and dispatched by Pmch_Service() 
+ *           in the context of the UNICENS thread.
+ *  \param  self        The instance
+ *  \param  msg_ptr     Reference to the Rx message object containing the received
+ *                      message.
+ */
+static void Pmch_RxReceiveAsync(void *self, Ucs_Lld_RxMsg_t *msg_ptr)
+{
+    CPmChannel *self_ = (CPmChannel*)self;
+    Lld_IntRxMsg_t *rx_ptr = (Lld_IntRxMsg_t*)(void*)msg_ptr;
+
+    rx_ptr->async_next_ptr = atomic_load(&self_->rx_async_head);
+    while (atomic_compare_exchange_weak(&self_->rx_async_head, &rx_ptr->async_next_ptr, rx_ptr) == false)
+    {
+        /* retry with updated head */
+    }
+    Srv_SetEventAsync(&self_->service, PMCH_EVENT_RX);
+}
+
+/*! \brief  Pass several Rx messages to UNICENS from any thread
+ *  \details The messages are pushed onto the lock-free queue by a single operation. Thus, 
+ *           Pmch_Service() is requested only once for the whole batch.
+ *  \param  self        The instance
+ *  \param  msgs        Array of Rx message objects containing the received messages
+ *  \param  count       Number of Rx message objects
+ */
+static void Pmch_RxReceiveBatchAsync(void *self, Ucs_Lld_RxMsg_t *msgs[], uint8_t count)
+{
+    CPmChannel *self_ = (CPmChannel*)self;
+
+    if (count > 0U)
+    {
+        Lld_IntRxMsg_t *first_ptr = (Lld_IntRxMsg_t*)(void*)msgs[0];
+        Lld_IntRxMsg_t *top_ptr = first_ptr;
+        uint8_t i;
+
+        for (i = 1U; i < count; i++)                    /* the queue is a stack, the latest message is on top */
+        {
+            Lld_IntRxMsg_t *rx_ptr = (Lld_IntRxMsg_t*)(void*)msgs[i];
+            rx_ptr->async_next_ptr = top_ptr;
+            top_ptr = rx_ptr;
+        }
+
+        first_ptr->async_next_ptr = atomic_load(&self_->rx_async_head);
+        while (atomic_compare_exchange_weak(&self_->rx_async_head, &first_ptr->async_next_ptr, top_ptr) == false)
+        {
+            /* retry with updated head */
+        }
+        Srv_SetEventAsync(&self_->service, PMCH_EVENT_RX);
+    }
+}
+
+/*! \brief  Notifies from any thread that the LLD no longer needs to access the Tx message object
+ *  \details The message is pushed onto a lock-free queue and released by Pmch_Service() 
+ *           in the context of the UNICENS thread.
+ *  \param  self        The instance
+ *  \param  msg_ptr     Reference to the Tx message object which is no longer accessed
+ *                      by the low-level driver
+ */
+static void Pmch_TxReleaseAsync(void *self, Ucs_Lld_TxMsg_t *msg_ptr)
+{
+    CPmChannel *self_ = (CPmChannel*)self;
+    Lld_IntTxMsg_t *tx_ptr = (Lld_IntTxMsg_t*)(void*)msg_ptr;
+
+    tx_ptr->async_next_ptr = atomic_load(&self_->tx_async_head);
+    while (atomic_compare_exchange_weak(&self_->tx_async_head, &tx_ptr->async_next_ptr, tx_ptr) == false)
+    {
+        /* retry with updated head */
+    }
+    Srv_SetEventAsync(&self_->service, PMCH_EVENT_TX_RELEASE);
+}
+
+/*! \brief  Service function which dispatches all messages handed over by the LLD. The queues 
+ *          are taken as a whole and reversed, so that messages are processed in the order 
+ *          the LLD has passed them.
+ *  \param  self    The instance
+ */
+static void Pmch_Service(void *self)
+{
+    CPmChannel *self_ = (CPmChannel*)self;
+    Srv_Event_t event_mask;
+
+    Srv_GetEvent(&self_->service, &event_mask);
+
+    if ((event_mask & PMCH_EVENT_TX_RELEASE) == PMCH_EVENT_TX_RELEASE)
+    {
+        Lld_IntTxMsg_t *tx_ptr = atomic_exchange(&self_->tx_async_head, NULL);
+        Lld_IntTxMsg_t *ordered_ptr = NULL;
+
+        Srv_ClearEvent(&self_->service, PMCH_EVENT_TX_RELEASE);
+        while (tx_ptr != NULL)
+        {
+            Lld_IntTxMsg_t *next_ptr = tx_ptr->async_next_ptr;
+            tx_ptr->async_next_ptr = ordered_ptr;
+            ordered_ptr = tx_ptr;
+            tx_ptr = next_ptr;
+        }
+        while (ordered_ptr != NULL)
+        {
+            tx_ptr = ordered_ptr;
+            ordered_ptr = ordered_ptr->async_next_ptr;
+            tx_ptr->async_next_ptr = NULL;
+            Pmch_TxRelease(self_, &tx_ptr->lld_msg);
+        }
+    }
+
+    if ((event_mask & PMCH_EVENT_RX) == PMCH_EVENT_RX)
+    {
+        Lld_IntRxMsg_t *rx_ptr = atomic_exchange(&self_->rx_async_head, NULL);
+        Lld_IntRxMsg_t *ordered_ptr = NULL;
+
+        Srv_ClearEvent(&self_->service, PMCH_EVENT_RX);
+        while (rx_ptr != NULL)
+        {
+            Lld_IntRxMsg_t *next_ptr = rx_ptr->async_next_ptr;
+            rx_ptr->async_next_ptr = ordered_ptr;
+            ordered_ptr = rx_ptr;
+            rx_ptr = next_ptr;
+        }
+        while (ordered_ptr != NULL)
+        {
+            rx_ptr = ordered_ptr;
+            ordered_ptr = ordered_ptr->async_next_ptr;
+            rx_ptr->async_next_ptr = NULL;
+            Pmch_RxReceive(self_, &rx_ptr->lld_msg);
+        }
+    }
+}
+
+#endif
 /*------------------------------------------------------------------------------------------------*/
 /* FIFO Related Callback Functions                                                                */
 /*------------------------------------------------------------------------------------------------*/
@@ -292,11 +624,27 @@ void Pmch_ReturnRxToPool(void *self, CMessage *msg_ptr)
 {
     CPmChannel *self_ = (CPmChannel*)self;
 
+#ifdef UCS_ATOMIC_EVENTS
+    Lfp_ReturnMsg(&self_->rx_msgs_pool, msg_ptr);
+
+    if (atomic_exchange(&self_->rx_trigger_available, false) != false)
+    {
+        (void)atomic_fetch_add(&self_->rx_stall_count, 1U);
+#else
     Pool_ReturnMsg(msg_ptr);
 
     if (self_->rx_trigger_available == true)
     {
+        uint32_t stall_time = (Tm_Tick_t)(Tm_GetTickCount(&self_->init_data.base_ptr->tm) - self_->rx_stall_start);
+
         self_->rx_trigger_available = false;
+        self_->rx_stall_count++;
+        self_->rx_total_stall_time += stall_time;
+        if (stall_time > self_->rx_max_stall_time)
+        {
+            self_->rx_max_stall_time = stall_time;
+        }
+#endif
 
         if (self_->init_data.lld_iface.rx_available_fptr != NULL)
         {
@@ -305,6 +653,75 @@ void Pmch_ReturnRxToPool(void *self, CMessage *msg_ptr)
     }
 }
 
+/*! \brief  Registers an Rx message which is retained by a receiver after its credit was released
+ *  \details The number of detached Rx messages is limited to a share of the Rx pool. Thus, the
+ *           remaining Rx messages stay available for the control traffic.
+ *  \param  self    The instance
+ *  \return Returns \c true if the Rx message may be detached, otherwise \c false if the limit 
+ *          is reached. In this case the receiver must release the Rx message as usual.
+ */
+bool Pmch_DetachRx(CPmChannel *self)
+{
+    bool ret = false;
+
+    if (self->rx_detached_cnt < self->rx_detached_max)
+    {
+        self->rx_detached_cnt++;
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*! \brief  Returns an Rx message object which was detached by Pmch_DetachRx() back to the pool
+ *  \param  self    The instance
+ *  \param  msg_ptr The detached Rx message object
+ */
+void Pmch_ReturnDetachedRxToPool(CPmChannel *self, CMessage *msg_ptr)
+{
+    TR_ASSERT(self->init_data.ucs_user_ptr, "[PMCH]", (self->rx_detached_cnt > 0U));
+    self->rx_detached_cnt--;
+    Pmch_ReturnRxToPool(self, msg_ptr);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Rx Pool Statistics                                                                             */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Calculates the memory which is required for an Rx pool
+ *  \param  size    Number of Rx messages
+ *  \return The required memory in bytes
+ */
+uint32_t Pmch_GetRxPoolMemSize(uint16_t size)
+{
+    return (uint32_t)size * (uint32_t)(sizeof(CMessage) + sizeof(Lld_IntRxMsg_t));
+}
+
+/*! \brief  Retrieves the statistics of the Rx pool
+ *  \details If the macro UCS_ATOMIC_EVENTS is defined the stall times are not measured since the
+ *           LLD may allocate messages outside the UNICENS context.
+ *  \param  self        The instance
+ *  \param  stats_ptr   Reference to the structure which is filled with the statistics
+ */
+void Pmch_GetRxPoolStats(CPmChannel *self, Pmch_RxPoolStats_t *stats_ptr)
+{
+    stats_ptr->size = self->rx_pool_size;
+#ifdef UCS_ATOMIC_EVENTS
+    stats_ptr->available = Lfp_GetCurrentSize(&self->rx_msgs_pool);
+    stats_ptr->low_water_mark = (uint16_t)atomic_load(&self->rx_low_water_mark);
+    stats_ptr->alloc_failures = (uint32_t)atomic_load(&self->rx_alloc_failures);
+    stats_ptr->stall_count = (uint32_t)atomic_load(&self->rx_stall_count);
+    stats_ptr->total_stall_time = 0U;
+    stats_ptr->max_stall_time = 0U;
+#else
+    stats_ptr->available = Pool_GetCurrentSize(&self->rx_msgs_pool);
+    stats_ptr->low_water_mark = self->rx_low_water_mark;
+    stats_ptr->alloc_failures = self->rx_alloc_failures;
+    stats_ptr->stall_count = self->rx_stall_count;
+    stats_ptr->total_stall_time = self->rx_total_stall_time;
+    stats_ptr->max_stall_time = self->rx_max_stall_time;
+#endif
+}
+
 /*!
  * @}
  * \endcond
@@ -56,6 +56,10 @@ static const Srv_Event_t FIFO_SE_RX_SERVICE         = 1U;   /*!< \brief Event wh
 static const Srv_Event_t FIFO_SE_TX_SERVICE         = 2U;   /*!< \brief Event which triggers the Rx service */
 static const Srv_Event_t FIFO_SE_TX_APPLY_STATUS    = 4U;   /*!< \brief Event which triggers to apply the current INIC status */
 static const Srv_Event_t FIFO_SE_ALL                = 7U;   /* parasoft-suppress  MISRA2004-8_7 "configuration property" */
+/*! \brief Number of messages a priority class may transmit in a row while messages of a lower
+ *         priority class are waiting. The value \c 0 selects strict priority for the class.
+ */
+static const uint8_t     FIFO_TX_PRIO_WEIGHT[MSG_NUM_TX_PRIO] = { 0U, 8U, 4U, 0U };
 
 /*------------------------------------------------------------------------------------------------*/
 /* Internal prototypes                                                                            */
@@ -65,6 +69,9 @@ static void Fifo_Service(void *self);
 
 static void Fifo_RxService(CPmFifo *self);
 static void Fifo_RxCheckStatusTrigger(CPmFifo *self);
+static void Fifo_RxTriggerStatus(CPmFifo *self);
+static void Fifo_RxOnAckTimer(void *self);
+static void Fifo_RxAdaptAck(CPmFifo *self, uint8_t acked);
 static void Fifo_RxGetCredit(CPmFifo *self);
 static void Fifo_RxReleaseCredit(CPmFifo *self);
 static bool Fifo_RxProcessData(CPmFifo *self, CMessage *msg_ptr);
@@ -79,8 +86,9 @@ static void Fifo_TxProcessData(CPmFifo *self);
 static void Fifo_TxProcessStatus(CPmFifo *self);
 static void Fifo_TxProcessCommand(CPmFifo *self);
 
-static void Fifo_TxEnqueueBypassMsg(CPmFifo *self, CDlList *q_ptr, CMessage *msg_ptr);
-static bool Fifo_FindFirstRegularMsg(void *d_ptr, void *ud_ptr);
+static CDlNode *Fifo_TxPopNextMsg(CPmFifo *self);
+static bool Fifo_TxIsLowerPrioWaiting(CPmFifo *self, uint8_t prio);
+static void Fifo_TxCountServed(CPmFifo *self, Msg_TxPrio_t prio);
 
 static void Fifo_TxExecuteCancel(CPmFifo *self, uint8_t failure_sid, uint8_t failure_code);
 static void Fifo_TxExecuteCancelAll(CPmFifo *self, uint8_t failure_sid, uint8_t failure_code);
@@ -110,6 +118,8 @@ static bool Fifo_TxIsIncomingSidValid(CPmFifo *self, uint8_t sid);
  */
 void Fifo_Ctor(CPmFifo *self, const Fifo_InitData_t *init_ptr, const Fifo_Config_t *config_ptr)
 {
+    uint8_t index;
+
     MISC_MEM_SET(self, 0, sizeof(*self));
 
     self->init          = *init_ptr;
@@ -121,6 +131,7 @@ void Fifo_Ctor(CPmFifo *self, const Fifo_InitData_t *init_ptr, const Fifo_Config
     TR_INFO((self->init.base_ptr->ucs_user_ptr, "[FIFO]", "Fifo_Ctor(): state: %u", 1U, self->sync_state));
 
     Srv_Ctor(&self->service, FIFO_SRV_PRIO, self, &Fifo_Service);       /* registration of service */
+    SRV_SET_NAME(&self->service, "FIFO");
     (void)Scd_AddService(&self->init.base_ptr->scd, &self->service);
 
     T_Ctor(&self->wd.timer);                                            /* setup watchdog */
@@ -142,12 +153,44 @@ void Fifo_Ctor(CPmFifo *self, const Fifo_InitData_t *init_ptr, const Fifo_Config
         TR_FAILED_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]");
     }
 
+    if ((self->config.rx_threshold_max > self->config.rx_threshold_min) && (self->config.rx_ack_delay_max != 0U))
+    {
+        if ((self->config.rx_threshold_max <= self->config.rx_credits) && (self->config.rx_threshold_min > 0U) &&
+            (self->config.rx_ack_delay_max >= self->config.rx_ack_delay_min))
+        {
+            self->rx.adaptive = true;               /* start within the configured bounds */
+
+            if (self->rx.ack_threshold < self->config.rx_threshold_min)
+            {
+                self->rx.ack_threshold = self->config.rx_threshold_min;
+            }
+            else if (self->rx.ack_threshold > self->config.rx_threshold_max)
+            {
+                self->rx.ack_threshold = self->config.rx_threshold_max;
+            }
+            else
+            {
+                /* threshold is within bounds */
+            }
+        }
+        else                                        /* configuration error - use static threshold */
+        {
+            TR_FAILED_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]");
+        }
+    }
+
+    T_Ctor(&self->rx.ack_timer);
+    self->rx.ack_delay = 0U;
+
     self->rx.wait_processing = false;
     Pmcmd_Ctor(&self->rx.status, self->config.fifo_id, PMP_MSG_TYPE_STATUS);
     Pmcmd_SetContent(&self->rx.status, 0U, PMP_STATUS_TYPE_FLOW, PMP_STATUS_CODE_SUCCESS, NULL, 0U);
 
     /* init Tx part */
-    Dl_Ctor(&self->tx.waiting_queue, self->init.base_ptr->ucs_user_ptr);
+    for (index = 0U; index < MSG_NUM_TX_PRIO; index++)
+    {
+        Dl_Ctor(&self->tx.waiting_queues[index], self->init.base_ptr->ucs_user_ptr);
+    }
     Dl_Ctor(&self->tx.pending_q, self->init.base_ptr->ucs_user_ptr);
 
     Pmcmd_Ctor(&self->tx.cancel_cmd, self->config.fifo_id, PMP_MSG_TYPE_CMD);
@@ -172,7 +215,8 @@ void Fifo_Ctor(CPmFifo *self, const Fifo_InitData_t *init_ptr, const Fifo_Config
     self->tx.pm_header.sid = 0U;
     self->tx.pm_header.ext_type = (uint8_t)self->tx.encoder_ptr->content_type;
 
-    Lldp_Ctor(&self->tx.lld_pool, self, self->init.base_ptr->ucs_user_ptr);
+    Lldp_Ctor(&self->tx.lld_pool, self, self->init.tx_handles_ptr, self->init.tx_handles_size, 
+              self->init.base_ptr->ucs_user_ptr);
 
     Pmch_RegisterReceiver(self->init.channel_ptr, self->config.fifo_id, &Fifo_OnRx, self);
 }
@@ -188,6 +232,13 @@ static void Fifo_InitCounters(CPmFifo *self, uint8_t tx_sid_complete, uint8_t tx
     self->rx.expected_sid = tx_sid_complete + 1U;
     self->rx.ack_last_ok_sid = tx_sid_complete;
 
+    if (self->rx.adaptive != false)                 /* assume low load until data messages are received */
+    {
+        self->rx.ack_delay = self->config.rx_ack_delay_max;
+        self->rx.avg_interval = self->config.rx_ack_delay_max;
+        self->rx.last_arrival = Tm_GetTickCount(&self->init.base_ptr->tm);
+    }
+
     self->tx.credits = tx_credits;
     self->tx.sid_next_to_use = tx_sid_complete +1U;
     self->tx.sid_last_completed = tx_sid_complete;
@@ -242,6 +293,11 @@ void Fifo_Stop(CPmFifo *self, Fifo_SyncState_t new_state, bool allow_notificatio
         Tm_ClearTimer(&self->init.base_ptr->tm, &self->wd.timer);
     }
 
+    if (self->rx.adaptive != false)
+    {
+        Tm_ClearTimer(&self->init.base_ptr->tm, &self->rx.ack_timer);
+    }
+
     if ((notify != false) && (allow_notification != false))
     {
         Sub_Notify(&self->sync_state_subject, &self->config.fifo_id);
@@ -257,6 +313,7 @@ void Fifo_Cleanup(CPmFifo *self)
 {
     CMessage *msg_ptr = NULL;
     CDlNode *node_ptr = NULL;
+    uint8_t prio;
 
     TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (self->sync_state == FIFO_S_UNSYNCED_INIT));
     TR_INFO((self->init.base_ptr->ucs_user_ptr, "[FIFO]", "Fifo_Cleanup(): FIFO: %u", 1U, self->config.fifo_id));
@@ -271,12 +328,17 @@ void Fifo_Cleanup(CPmFifo *self)
         Msg_SetLldHandle(msg_ptr, NULL);                    /* remove link to LLD message object */
     }
 
-    /* cleanup waiting queue */
-    for (node_ptr = Dl_PopHead(&self->tx.waiting_queue); node_ptr != NULL; node_ptr = Dl_PopHead(&self->tx.waiting_queue))
+    /* cleanup waiting queues */
+    for (prio = 0U; prio < MSG_NUM_TX_PRIO; prio++)
     {
-        msg_ptr = (CMessage*)Dln_GetData(node_ptr);
+        for (node_ptr = Dl_PopHead(&self->tx.waiting_queues[prio]); node_ptr != NULL; node_ptr = Dl_PopHead(&self->tx.waiting_queues[prio]))
+        {
+            msg_ptr = (CMessage*)Dln_GetData(node_ptr);
 
-        Msg_NotifyTxStatus(msg_ptr, UCS_MSG_STAT_ERROR_SYNC);
+            Msg_NotifyTxStatus(msg_ptr, UCS_MSG_STAT_ERROR_SYNC);
+        }
+
+        self->tx.prio_served[prio] = 0U;
     }
 
     /* cleanup Rx queue */
@@ -325,70 +387,110 @@ static void Fifo_Service(void *self)
 /* Tx Implementation                                                                              */
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief   Enqueues a message for transmission
+ *  \details The message is appended to the queue of its priority class,
+ *           see Msg_SetTxPrio().
  *  \param   self    The instance
  *  \param   msg_ptr The Tx message object
- *  \param   bypass  Use \c true if the message shall bypass all other messages
- *                   in the FIFO. Otherwise \c false.
  */
-void Fifo_Tx(CPmFifo *self, CMessage *msg_ptr, bool bypass)
+void Fifo_Tx(CPmFifo *self, CMessage *msg_ptr)
 {
     uint8_t *msg_hdr_ptr = NULL;
 
     TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (msg_ptr != NULL));
+    TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", ((uint8_t)Msg_GetTxPrio(msg_ptr) < MSG_NUM_TX_PRIO));
     TR_INFO((self->init.base_ptr->ucs_user_ptr, "[FIFO]", "Fifo_Tx(): FIFO: %u, msg_ptr: 0x%p, FuncId: 0x%X, queued Tx message", 3U, self->config.fifo_id, msg_ptr, msg_ptr->pb_msg.id.function_id));
 
     Msg_PullHeader(msg_ptr, self->tx.encoder_ptr->msg_hdr_sz);
     msg_hdr_ptr = Msg_GetHeader(msg_ptr);
     self->tx.encoder_ptr->encode_fptr(Msg_GetMostTel(msg_ptr), msg_hdr_ptr);
+                                                                            /* enqueue message for asynchronous transmission */
+    Dl_InsertTail(&self->tx.waiting_queues[Msg_GetTxPrio(msg_ptr)], Msg_GetNode(msg_ptr));
+    Srv_SetEvent(&self->service, FIFO_SE_TX_SERVICE);
+}
+
+/*! \brief   Retrieves the next waiting message according to the priority classes
+ *  \details The highest priority class with waiting messages is served first. A class
+ *           with a weight of \c N yields one transmission to the lower priority classes
+ *           after \c N messages were sent in a row. A weight of \c 0 means strict priority.
+ *           The quotas are not modified. They are updated by Fifo_TxCountServed() as soon
+ *           as the message is actually dispatched.
+ *  \param   self    The instance
+ *  \return  Returns the node of the next message or \c NULL if all queues are empty.
+ */
+static CDlNode *Fifo_TxPopNextMsg(CPmFifo *self)
+{
+    CDlNode *node_ptr = NULL;
+    uint8_t selected = MSG_NUM_TX_PRIO;
+    uint8_t prio;
 
-    if (bypass == false)
+    for (prio = 0U; prio < MSG_NUM_TX_PRIO; prio++)
     {
-        Dl_InsertTail(&self->tx.waiting_queue, Msg_GetNode(msg_ptr));       /* enqueue message for asynchronous transmission */
+        if (Dl_GetSize(&self->tx.waiting_queues[prio]) > 0U)
+        {                                                   /* skip class if its quota is exhausted */
+            if ((FIFO_TX_PRIO_WEIGHT[prio] == 0U) ||        /* and lower classes are waiting */
+                (self->tx.prio_served[prio] < FIFO_TX_PRIO_WEIGHT[prio]) ||
+                (Fifo_TxIsLowerPrioWaiting(self, prio) == false))
+            {
+                selected = prio;
+                break;
+            }
+        }
     }
-    else
+
+    if (selected < MSG_NUM_TX_PRIO)
     {
-        Fifo_TxEnqueueBypassMsg(self, &self->tx.waiting_queue, msg_ptr);    /* queue before first non-bypass message */
+        node_ptr = Dl_PopHead(&self->tx.waiting_queues[selected]);
     }
 
-    Srv_SetEvent(&self->service, FIFO_SE_TX_SERVICE);
+    return node_ptr;
 }
 
-/*! \brief   Enqueues a bypass message between the last bypass and the first regular message in a queue
+/*! \brief   Checks if messages of a lower priority class are waiting
  *  \param   self    The instance
- *  \param   q_ptr   The message queue
- *  \param   msg_ptr The Tx message object
+ *  \param   prio    The priority class
+ *  \return  Returns \c true if at least one class below \c prio has waiting messages,
+ *           otherwise \c false.
  */
-static void Fifo_TxEnqueueBypassMsg(CPmFifo *self, CDlList *q_ptr, CMessage *msg_ptr)
+static bool Fifo_TxIsLowerPrioWaiting(CPmFifo *self, uint8_t prio)
 {
-    CDlNode *node_ptr = Dl_Foreach(q_ptr, &Fifo_FindFirstRegularMsg, NULL); /* find first "non-bypass" message */
-    Msg_SetTxBypass(msg_ptr, true);                                         /* mark new message as bypass message */
+    bool ret = false;
+    uint8_t lower;
 
-    if (node_ptr == NULL)                                                   /* no message or only bypass messages found */
-    {                               
-        Dl_InsertTail(&self->tx.waiting_queue, Msg_GetNode(msg_ptr));       /* enqueue message to tail */   
-    }
-    else                                                                    /* first "non-bypass" message is found */
-    {                                                                       /* insert the bypass message before the first regular message found */
-        Dl_InsertBefore(&self->tx.waiting_queue, node_ptr, Msg_GetNode(msg_ptr));
+    for (lower = (uint8_t)(prio + 1U); (lower < MSG_NUM_TX_PRIO) && (ret == false); lower++)
+    {
+        ret = (Dl_GetSize(&self->tx.waiting_queues[lower]) > 0U);
     }
+
+    return ret;
 }
 
-/*! \brief   Required as "for-each" function to find the first "regular message"
- *  \param   d_ptr   Points to a message object in the queue
- *  \param   ud_ptr  Unused data reference, always \c NULL
- *  \return  Returns \c true if a regular (non-bypass) message is found.
+/*! \brief   Updates the quotas of the weighted priority classes after a message was dispatched
+ *  \details All higher priority classes have yielded to the dispatched message, hence their
+ *           quotas are restored. The quota of the dispatched class is only consumed while
+ *           lower priority messages are waiting. Thus, it does not build up across idle periods.
+ *  \param   self    The instance
+ *  \param   prio    The priority class of the dispatched message
  */
-static bool Fifo_FindFirstRegularMsg(void *d_ptr, void *ud_ptr)
+static void Fifo_TxCountServed(CPmFifo *self, Msg_TxPrio_t prio)
 {
-    bool ret = true;
-    MISC_UNUSED(ud_ptr);
+    uint8_t higher;
 
-    if (Msg_IsTxBypass((CMessage*)d_ptr))
+    for (higher = 0U; higher < (uint8_t)prio; higher++)
     {
-        ret = false;
+        self->tx.prio_served[higher] = 0U;
     }
 
-    return ret;
+    if (FIFO_TX_PRIO_WEIGHT[prio] > 0U)
+    {
+        if (Fifo_TxIsLowerPrioWaiting(self, (uint8_t)prio) != false)
+        {
+            self->tx.prio_served[prio]++;
+        }
+        else
+        {
+            self->tx.prio_served[prio] = 0U;
+        }
+    }
 }
 
 /*! \brief   Processing of data, status and command messages
@@ -410,8 +512,17 @@ static void Fifo_TxProcessStatus(CPmFifo *self)
     {
         if (Pmcmd_Reserve(&self->rx.status) != false)
         {
+            uint8_t ack_sid = (self->rx.expected_sid - self->rx.busy_num) - 1U;
+
+            if (self->rx.adaptive != false)
+            {
+                Tm_ClearTimer(&self->init.base_ptr->tm, &self->rx.ack_timer);
+                Fifo_RxAdaptAck(self, ack_sid - self->rx.ack_last_ok_sid);
+            }
+
+            self->rx.status_msgs++;
             Pmcmd_SetTrigger(&self->rx.status, false);
-            self->rx.ack_last_ok_sid = (self->rx.expected_sid - self->rx.busy_num) - 1U;
+            self->rx.ack_last_ok_sid = ack_sid;
             self->rx.wait_processing = false;
 
             if (self->rx.busy_num == 0U)                /* currently no processing of data messages active */
@@ -429,10 +540,16 @@ static void Fifo_TxProcessStatus(CPmFifo *self)
 }
 
 /*! \brief   Processing of queued data messages
+ *  \details If the LLD accepts chained messages, all messages which are sent in one
+ *           service pass are forwarded to the LLD in a single chain.
  *  \param   self    The instance
  */
 static void Fifo_TxProcessData(CPmFifo *self)
 {
+    Ucs_Lld_TxMsg_t *chain_head_ptr = NULL;
+    Ucs_Lld_TxMsg_t *chain_tail_ptr = NULL;
+    bool batch_enabled = Pmch_IsTxBatchEnabled(self->init.channel_ptr);
+
     /* process all queued messages as long as credits are available,
      * process all queued messages if FIFO is not synced 
      */
@@ -443,7 +560,7 @@ static void Fifo_TxProcessData(CPmFifo *self)
         uint8_t *msg_hdr_ptr = NULL;
         Lld_IntTxMsg_t *lld_tx_ptr = NULL;
 
-        node_ptr = Dl_PopHead(&self->tx.waiting_queue);             /* get message node */
+        node_ptr = Fifo_TxPopNextMsg(self);                         /* get message node */
         if (node_ptr == NULL)
         {
             msg_ptr = NULL;                                         /* stop processing - no further messages in queue */
@@ -459,8 +576,15 @@ static void Fifo_TxProcessData(CPmFifo *self)
         else
         {
             lld_tx_ptr = Lldp_GetTxFromPool(&self->tx.lld_pool);
+            if (lld_tx_ptr == NULL)
+            {                                                       /* Tx window is exhausted, wait until a */
+                Dl_InsertHead(&self->tx.waiting_queues[Msg_GetTxPrio(msg_ptr)], node_ptr);
+                break;                                              /* handle is returned by a Tx status    */
+            }
+
+            Fifo_TxCountServed(self, Msg_GetTxPrio(msg_ptr));
+
             TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (msg_ptr != NULL));
-            TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (lld_tx_ptr != NULL));
             TR_INFO((self->init.base_ptr->ucs_user_ptr, "[FIFO]", "Fifo_TxProcessData(): FIFO: %u, msg_ptr: 0x%p, FuncId: 0x%X, SID: 0x%02X, queued Tx message", 4U, self->config.fifo_id, msg_ptr, msg_ptr->pb_msg.id.function_id, self->tx.sid_next_to_use));
 
             Msg_SetLldHandle(msg_ptr, lld_tx_ptr);                     /* link message objects */
@@ -483,11 +607,29 @@ static void Fifo_TxProcessData(CPmFifo *self)
             Msg_SetTxActive(msg_ptr, true);
             Dl_InsertTail(&self->tx.pending_q, Msg_GetNode(msg_ptr));
 
-            Pmch_Transmit(self->init.channel_ptr, (Ucs_Lld_TxMsg_t*)(void*)lld_tx_ptr);
+            if (batch_enabled == false)
+            {
+                Pmch_Transmit(self->init.channel_ptr, (Ucs_Lld_TxMsg_t*)(void*)lld_tx_ptr);
+            }
+            else if (chain_tail_ptr == NULL)                           /* append message to the chain */
+            {
+                chain_head_ptr = &lld_tx_ptr->lld_msg;
+                chain_tail_ptr = chain_head_ptr;
+            }
+            else
+            {
+                chain_tail_ptr->custom_next_msg_ptr = &lld_tx_ptr->lld_msg;
+                chain_tail_ptr = chain_tail_ptr->custom_next_msg_ptr;
+            }
 
             self->tx.credits--;
         }
     }
+
+    if (chain_head_ptr != NULL)                                        /* forward the whole chain at once */
+    {
+        Pmch_TransmitChain(self->init.channel_ptr, chain_head_ptr);
+    }
 }
 
 /*! \brief   Processing of status messages
@@ -685,7 +827,7 @@ static void Fifo_TxRestorePending(CPmFifo *self)
         Lldp_ReturnTxToPool(&self->tx.lld_pool, (Lld_IntTxMsg_t*)Msg_GetLldHandle(msg_ptr));
         Msg_SetLldHandle(msg_ptr, NULL);                            /* remove link to LLD message object */
         Msg_PushHeader(msg_ptr, self->tx.encoder_ptr->pm_hdr_sz);   /* set index to position of message header */
-        Dl_InsertHead(&self->tx.waiting_queue, node_ptr);           /* enqueue message to waiting_q */
+        Dl_InsertHead(&self->tx.waiting_queues[Msg_GetTxPrio(msg_ptr)], node_ptr);   /* enqueue message to waiting_q */
     }
 }
 
@@ -711,7 +853,7 @@ static uint8_t Fifo_TxPendingGetFollowerId(CPmFifo *self)
     return ret;
 }
 
-/*! \brief  Aborts the transmission of all messages in the waiting_q with a given follower id
+/*! \brief  Aborts the transmission of all messages in the waiting queues with a given follower id
  *  \param  self          The instance
  *  \param  follower_id   The follower id a message needs to have to be canceled
  *  \param  status        The transmission status that shall be notified 
@@ -720,30 +862,36 @@ static void Fifo_TxCancelFollowers(CPmFifo *self, uint8_t follower_id, Ucs_MsgTx
 {
     CDlNode *node_ptr;
     CDlList temp_queue;
+    uint8_t prio;
 
     Dl_Ctor(&temp_queue, self->init.base_ptr->ucs_user_ptr);
     TR_INFO((self->init.base_ptr->ucs_user_ptr, "[FIFO]", "Fifo_TxCancelFollowers(): FIFO: %u: FollowerId: %u", 2U, self->config.fifo_id, follower_id));
 
-    for (node_ptr = Dl_PopHead(&self->tx.waiting_queue); node_ptr != NULL; node_ptr = Dl_PopHead(&self->tx.waiting_queue))
+    for (prio = 0U; prio < MSG_NUM_TX_PRIO; prio++)
     {
-        CMessage *tx_ptr = (CMessage*)Dln_GetData(node_ptr);
-
-        TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (Msg_GetLldHandle(tx_ptr) == NULL));
+        CDlList *q_ptr = &self->tx.waiting_queues[prio];
 
-        if (tx_ptr->pb_msg.opts.cancel_id == follower_id)
+        for (node_ptr = Dl_PopHead(q_ptr); node_ptr != NULL; node_ptr = Dl_PopHead(q_ptr))
         {
-            Msg_NotifyTxStatus(tx_ptr, status);             /* notify failed transmission of message and all followers */
+            CMessage *tx_ptr = (CMessage*)Dln_GetData(node_ptr);
+
+            TR_ASSERT(self->init.base_ptr->ucs_user_ptr, "[FIFO]", (Msg_GetLldHandle(tx_ptr) == NULL));
+
+            if (tx_ptr->pb_msg.opts.cancel_id == follower_id)
+            {
+                Msg_NotifyTxStatus(tx_ptr, status);         /* notify failed transmission of message and all followers */
+            }
+            else
+            {
+                Dl_InsertTail(&temp_queue, node_ptr);       /* add to temporary queue and keep order of messages */
+            }
         }
-        else
+
+        if (Dl_GetSize(&temp_queue) > 0U)                   /* restore temp_queue to waiting queue */
         {
-            Dl_InsertTail(&temp_queue, node_ptr);           /* add to temporary queue and keep order of messages */
+            Dl_AppendList(q_ptr, &temp_queue);              /* temp_queue will be empty now */
         }
     }
-
-    if (Dl_GetSize(&temp_queue) > 0U)                       /* restore temp_queue to waiting_q */
-    {
-        Dl_AppendList(&self->tx.waiting_queue, &temp_queue);/* temp_queue will be empty now */
-    }
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -1034,20 +1182,112 @@ static void Fifo_RxCheckStatusTrigger(CPmFifo *self)
 
     if ((consumed_inic_credits >= self->rx.ack_threshold) && (possible_acks > 0U))
     {
-        if (Pmcmd_IsTriggered(&self->rx.status) == false)
+        Fifo_RxTriggerStatus(self);                         /* INIC might run out of credits */
+    }
+}
+
+/*! \brief  Triggers the transmission of an Rx status if not already triggered
+ *  \param  self    The instance
+ */
+static void Fifo_RxTriggerStatus(CPmFifo *self)
+{
+    if (Pmcmd_IsTriggered(&self->rx.status) == false)
+    {
+        Pmcmd_SetTrigger(&self->rx.status, true);
+        Srv_SetEvent(&self->service, FIFO_SE_TX_SERVICE);
+    }
+}
+
+/*! \brief  Timer callback which acknowledges all possible Rx credits when the 
+ *          delayed acknowledge time has expired
+ *  \param  self    The instance
+ */
+static void Fifo_RxOnAckTimer(void *self)
+{
+    CPmFifo *self_ = (CPmFifo*)self;
+    uint8_t consumed_inic_credits = (self_->rx.expected_sid - self_->rx.ack_last_ok_sid) - 1U;
+
+    if (consumed_inic_credits > self_->rx.busy_num)
+    {
+        Fifo_RxTriggerStatus(self_);
+    }
+}
+
+/*! \brief   Adapts the acknowledge threshold and the delayed acknowledge time
+ *  \details The function is called before an Rx status is transmitted. The threshold is 
+ *           increased if the data messages arrive fast enough to reach the threshold within 
+ *           the maximum delay. Thus, fewer status messages are sent at high load. The threshold 
+ *           is decreased if a status acknowledges less messages than the threshold, i.e. the 
+ *           status was requested by the INIC, the delay timer or a released message. Thus, 
+ *           the acknowledge latency is reduced at low load. The delay is set to the expected 
+ *           time to receive the number of threshold messages.
+ *  \param   self    The instance
+ *  \param   acked   Number of data messages which are acknowledged by the status
+ */
+static void Fifo_RxAdaptAck(CPmFifo *self, uint8_t acked)
+{
+    uint32_t fill_time = (uint32_t)self->rx.avg_interval * (uint32_t)self->rx.ack_threshold;
+
+    if (acked >= self->rx.ack_threshold)
+    {
+        if ((fill_time <= self->config.rx_ack_delay_max) && (self->rx.ack_threshold < self->config.rx_threshold_max))
         {
-            Pmcmd_SetTrigger(&self->rx.status, true);       /* INIC might run out of credits */ 
-            Srv_SetEvent(&self->service, FIFO_SE_TX_SERVICE);
+            self->rx.ack_threshold++;
         }
     }
+    else if (self->rx.ack_threshold > self->config.rx_threshold_min)
+    {
+        self->rx.ack_threshold--;
+    }
+    else
+    {
+        /* threshold is already at the lower bound */
+    }
+
+    if (fill_time < self->config.rx_ack_delay_min)
+    {
+        self->rx.ack_delay = self->config.rx_ack_delay_min;
+    }
+    else if (fill_time > self->config.rx_ack_delay_max)
+    {
+        self->rx.ack_delay = self->config.rx_ack_delay_max;
+    }
+    else
+    {
+        self->rx.ack_delay = (uint16_t)fill_time;
+    }
 }
 
 /*! \brief  This function shall be called before processing a valid FIFO data message
+ *  \details If the adaptive acknowledge policy is enabled, the interval between data messages 
+ *           is measured and the delayed acknowledge timer is started if it is not running.
  *  \param  self    The instance
  */
 static void Fifo_RxGetCredit(CPmFifo *self)
 {
     self->rx.busy_num++;
+    self->rx.data_msgs++;
+
+    if (self->rx.adaptive != false)
+    {
+        Tm_Tick_t now = Tm_GetTickCount(&self->init.base_ptr->tm);
+        uint32_t interval = (Tm_Tick_t)(now - self->rx.last_arrival);
+
+        if (interval > 0xFFFFU)
+        {
+            interval = 0xFFFFU;
+        }
+
+        self->rx.avg_interval = (uint16_t)((((uint32_t)self->rx.avg_interval * 3U) + interval) / 4U);
+        self->rx.last_arrival = now;
+
+        if (T_IsTimerInUse(&self->rx.ack_timer) == false)
+        {
+            Tm_SetTimer(&self->init.base_ptr->tm, &self->rx.ack_timer, &Fifo_RxOnAckTimer, self, 
+                        (Tm_Tick_t)self->rx.ack_delay, 0U);
+        }
+    }
+
     Fifo_RxCheckStatusTrigger(self);
 }
 
@@ -1079,6 +1319,41 @@ void Fifo_RxReleaseMsg(CPmFifo *self, CMessage *msg_ptr)
     Fifo_RxReleaseCredit(self);
 }
 
+/*! \brief   Detaches a FIFO data message from the FIFO's flow control
+ *  \details The function releases the credit of an Rx message which is retained
+ *           by the receiver for a longer period, e.g. a segment of a zero-copy
+ *           segmented message. The message object stays allocated and has to be
+ *           returned by calling Fifo_RxReleaseDetachedMsg() later.
+ *  \param   self    The instance
+ *  \param   msg_ptr The Rx data message
+ *  \return  Returns \c true if the message is detached. Returns \c false if the channel
+ *           does not permit further detached messages. In this case the message must be 
+ *           released by Fifo_RxReleaseMsg().
+ */
+bool Fifo_RxDetachMsg(CPmFifo *self, CMessage *msg_ptr)
+{
+    bool ret = Pmch_DetachRx(self->init.channel_ptr);
+
+    if (ret != false)
+    {
+        Fifo_RxReleaseCredit(self);
+    }
+
+    MISC_UNUSED(msg_ptr);
+    return ret;
+}
+
+/*! \brief   Releases a FIFO data message which was detached by Fifo_RxDetachMsg()
+ *  \details The function only returns the message to the channel's Rx message pool
+ *           since its credit was already released.
+ *  \param   self    The instance
+ *  \param   msg_ptr The Rx data message
+ */
+void Fifo_RxReleaseDetachedMsg(CPmFifo *self, CMessage *msg_ptr)
+{
+    Pmch_ReturnDetachedRxToPool(self->init.channel_ptr, msg_ptr);
+}
+
 /*! \brief  Processes an Rx data message
  *  \param  self    The instance
  *  \param  msg_ptr The Rx data message
@@ -1311,6 +1586,30 @@ Fifo_SyncState_t Fifo_GetState(CPmFifo *self)
     return self->sync_state;
 }
 
+/*! \brief  Retrieves the statistics of the Tx window
+ *  \param  self        The instance
+ *  \param  stats_ptr   Reference to the structure which is filled with the statistics
+ */
+void Fifo_GetTxWindowStats(CPmFifo *self, Fifo_TxWindowStats_t *stats_ptr)
+{
+    stats_ptr->size = Lldp_GetSize(&self->tx.lld_pool);
+    stats_ptr->stalls = Lldp_GetStallCount(&self->tx.lld_pool);
+}
+
+/*! \brief  Retrieves the acknowledge statistics of the Rx direction
+ *  \details The ratio of \c status_msgs and \c data_msgs is the number of acknowledges 
+ *           per data message.
+ *  \param  self        The instance
+ *  \param  stats_ptr   Reference to the structure which is filled with the statistics
+ */
+void Fifo_GetRxAckStats(CPmFifo *self, Fifo_RxAckStats_t *stats_ptr)
+{
+    stats_ptr->data_msgs = self->rx.data_msgs;
+    stats_ptr->status_msgs = self->rx.status_msgs;
+    stats_ptr->ack_threshold = self->rx.ack_threshold;
+    stats_ptr->ack_delay = self->rx.ack_delay;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* Watchdog                                                                                       */
 /*------------------------------------------------------------------------------------------------*/
@@ -124,6 +124,86 @@ uint16_t Pool_GetCurrentSize(CPool *self)
     return list_size;
 }
 
+#ifdef UCS_ATOMIC_EVENTS
+/*------------------------------------------------------------------------------------------------*/
+/* Implementation of class CLfPool                                                                */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Constructor of the lock-free message pool class
+ *  \param  self            The instance
+ *  \param  messages        Reference to an array of message objects
+ *  \param  size            Number of message objects the \c messages array is comprising.
+ *  \param  ucs_user_ptr    User reference that needs to be passed in every callback function
+ */
+void Lfp_Ctor(CLfPool *self, CMessage messages[], uint16_t size, void *ucs_user_ptr)
+{
+    uint16_t index;
+
+    MISC_MEM_SET(self, 0, sizeof(*self));
+    self->ucs_user_ptr = ucs_user_ptr;
+    self->initial_size = size;
+    atomic_init(&self->head, NULL);
+    atomic_init(&self->size, 0U);
+
+    for (index = size; index > 0U; index--)     /* push in reverse order to hand out the first message first */
+    {
+        Msg_Ctor(&messages[index - 1U]);
+        Msg_SetPoolReference(&messages[index - 1U], self);
+        Lfp_ReturnMsg(self, &messages[index - 1U]);
+    }
+}
+
+/*! \brief  Retrieves a message object from the pool. The function may be called from any thread, 
+ *          but not from multiple threads concurrently.
+ *  \param  self    The instance
+ *  \return Reference to the CMessage structure if a message is available.
+ *          Otherwise \c NULL.
+ */
+CMessage* Lfp_GetMsg(CLfPool *self)
+{
+    CMessage *msg = NULL;
+    CDlNode *node = atomic_load(&self->head);
+
+    while ((node != NULL) && (atomic_compare_exchange_weak(&self->head, &node, node->next) == false))
+    {
+        /* retry with updated head */
+    }
+    if (node != NULL)
+    {
+        (void)atomic_fetch_sub(&self->size, 1U);
+        node->next = NULL;
+        msg = (CMessage*)node->data_ptr;
+    }
+
+    return msg;
+}
+
+/*! \brief  Returns a message object to the pool. The function may be called from any thread.
+ *  \param  self    The instance
+ *  \param  msg_ptr Reference to the message object which needs to be returned to the pool
+ */
+void Lfp_ReturnMsg(CLfPool *self, CMessage *msg_ptr)
+{
+    CDlNode *node = Msg_GetNode(msg_ptr);
+
+    TR_ASSERT(self->ucs_user_ptr, "[POOL]", (Dln_IsNodePartOfAList(node) == false));
+    node->next = atomic_load(&self->head);
+    while (atomic_compare_exchange_weak(&self->head, &node->next, node) == false)
+    {
+        /* retry with updated head */
+    }
+    (void)atomic_fetch_add(&self->size, 1U);
+}
+
+/*! \brief  Retrieves the current number of available message objects in the pool 
+ *  \param  self    The instance
+ *  \return The current number of available message objects in the pool
+ */
+uint16_t Lfp_GetCurrentSize(CLfPool *self)
+{
+    return (uint16_t)atomic_load(&self->size);
+}
+
+#endif
 /*!
  * @}
  * \endcond
@@ -277,6 +277,7 @@ void Prg_Ctor(CProgramming *self, CInic *inic, CBase *base, CExc *exc)
 
     /* Initialize Programming service */
     Srv_Ctor(&self->service, PRG_SRV_PRIO, self, &Prg_Service);
+    SRV_SET_NAME(&self->service, "PRG");
     /* Add Programming service to scheduler */
     (void)Scd_AddService(&self->base->scd, &self->service);
 
@@ -111,6 +111,7 @@ void Rsm_Ctor(CRemoteSyncManagement *self, Rsm_InitData_t *init_ptr)
 
     /* Initialize Sync Management service */
     Srv_Ctor(&self->rsm_srv, RSM_SRV_PRIO, self, &Rsm_Service);
+    SRV_SET_NAME(&self->rsm_srv, "RSM");
     /* Add RSM service to scheduler */
     (void)Scd_AddService(&self->base_ptr->scd, &self->rsm_srv);
     /* Add Observer for MNS initialization Result */
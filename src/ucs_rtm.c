@@ -53,6 +53,8 @@ static const Srv_Event_t RTM_EVENT_HANDLE_NEXTROUTE = 0x01U;
 static const Srv_Event_t RTM_EVENT_PROCESS_PAUSE    = 0x02U;
 /*! \brief Interval (in ms) for checking the RoutingJob queue */
 static const uint16_t RTM_JOB_CHECK_INTERVAL = 50U;   /* parasoft-suppress  MISRA2004-8_7 "Value shall be part of the module, not part of a function." */
+/*! \brief Tolerated delay (in ms) of the timer for checking the RoutingJob queue */
+static const uint16_t RTM_JOB_CHECK_SLACK = 20U;      /* parasoft-suppress  MISRA2004-8_7 "Value shall be part of the module, not part of a function." */
 
 /*------------------------------------------------------------------------------------------------*/
 /* Internal Constants                                                                             */
@@ -118,6 +120,7 @@ void Rtm_Ctor(CRouteManagement *self, Rtm_InitData_t *init_ptr)
 
     /* Initialize Route Management service */
     Srv_Ctor(&self->rtm_srv, RTM_SRV_PRIO, self, &Rtm_Service);
+    SRV_SET_NAME(&self->rtm_srv, "RTM");
 
     /* Add Observer for UCS initialization Result */
     Mobs_Ctor(&self->ucsinit_observer, self, EH_E_INIT_SUCCEEDED, &Rtm_UcsInitSucceededCb);
@@ -1004,12 +1007,13 @@ static void Rtm_StartTmr4HandlingRoutes(CRouteManagement * self)
     if((T_IsTimerInUse(&self->route_check) == false) &&
        (!self->ucs_is_stopping))
     {
-        Tm_SetTimer(self->tm_ptr,
-                    &self->route_check,
-                    &Rtm_ExecRoutesHandling,
-                    self,
-                    RTM_JOB_CHECK_INTERVAL,
-                    RTM_JOB_CHECK_INTERVAL);
+        Tm_SetTimerEx(self->tm_ptr,
+                      &self->route_check,
+                      &Rtm_ExecRoutesHandling,
+                      self,
+                      RTM_JOB_CHECK_INTERVAL,
+                      RTM_JOB_CHECK_INTERVAL,
+                      RTM_JOB_CHECK_SLACK);
     }
 }
 
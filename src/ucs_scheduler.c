@@ -53,6 +53,15 @@ const Srv_Event_t SRV_EMPTY_EVENT_MASK = (Srv_Event_t)0x00000000;   /*!< \brief
 /* Internal prototypes                                                                            */
 /*------------------------------------------------------------------------------------------------*/
 static bool Scd_SearchSlot(void *current_prio_ptr, void *new_prio_ptr);
+static bool Scd_SearchReadySlot(void *current_srv_ptr, void *new_prio_ptr);
+static void Scd_SetReady(CScheduler *self, CService *srv_ptr);
+#ifdef UCS_PROF_GET_TIME
+static void Srv_UpdateStats(CService *self, uint32_t start_time, uint32_t end_time);
+#endif
+
+#ifdef UCS_ATOMIC_EVENTS
+static void Scd_TakeAsyncEvents(CScheduler *self);
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CScheduler                                                             */
@@ -67,10 +76,14 @@ void Scd_Ctor(CScheduler *self, Scd_InitData_t *init_ptr, void * ucs_user_ptr)
     MISC_MEM_SET(self, 0, sizeof(*self));
     self->ucs_user_ptr = ucs_user_ptr;
     Dl_Ctor(&self->srv_list, ucs_user_ptr);
+    Dl_Ctor(&self->ready_list, ucs_user_ptr);
     Ssub_Ctor(&self->service_request_subject, ucs_user_ptr);
     (void)Ssub_AddObserver(&self->service_request_subject,
                            init_ptr->service_request_obs_ptr);
     self->scd_srv_is_running = false;
+#ifdef UCS_ATOMIC_EVENTS
+    atomic_init(&self->async_pending, false);
+#endif
 }
 
 /*! \brief  Add the given service to the scheduler. All services are arranged in priority order.
@@ -101,6 +114,9 @@ Scd_Ret_t Scd_AddService(CScheduler *self, CService *srv_ptr)
         /* Create back link service -> scheduler */
         srv_ptr->scd_ptr = self;
         Dln_SetData(&srv_ptr->list_node, &srv_ptr->priority);
+        Dln_SetData(&srv_ptr->ready_node, srv_ptr);
+        /* Events set before the service was (re-)added must not get lost */
+        Scd_SetReady(self, srv_ptr);
         ret_val = SCD_OK;
     }
     else    /* Service is already part of schedulers list */
@@ -126,42 +142,118 @@ Scd_Ret_t Scd_RemoveService(CScheduler *self, CService *srv_ptr)
     {
         ret_val = SCD_UNKNOWN_SRV;
     }
+    else
+    {
+        if(Dln_IsNodePartOfAList(&srv_ptr->ready_node) != false)
+        {
+            (void)Dl_Remove(&self->ready_list, &srv_ptr->ready_node);
+        }
+        if(self->current_srv_ptr == srv_ptr)    /* Service removed itself from the scheduler? */
+        {
+            self->current_srv_ptr = NULL;
+        }
+    }
 
     return ret_val;
 }
 
-/*! \brief Service function of the scheduler module.
+/*! \brief Service function of the scheduler module. Only services with pending events are 
+ *         visited. Services which become ready during the run are executed within the same run if 
+ *         their priority is lower than or equal to the priority of the current service.
  *  \param self   Instance pointer
  */
 void Scd_Service(CScheduler *self)
 {
-    CService *current_srv_ptr = (CService *)(void*)self->srv_list.head;
+    Scd_ServiceBudget(self, SCD_UNLIMITED_BUDGET);
+}
+
+/*! \brief Service function of the scheduler module which executes at most \c max_services 
+ *         service callbacks. Services which are not executed keep their pending events and 
+ *         remain in the ready list. Thus, they are executed during the next run.
+ *  \param self           Instance pointer
+ *  \param max_services   Maximum number of service callbacks to execute. The value 
+ *                        \ref SCD_UNLIMITED_BUDGET executes all ready services.
+ */
+void Scd_ServiceBudget(CScheduler *self, uint16_t max_services)
+{
+    CDlNode *current_node_ptr = NULL;
+    uint16_t executed = 0U;
+
+#ifdef UCS_ATOMIC_EVENTS
+    Scd_TakeAsyncEvents(self);
+#endif
+    current_node_ptr = Dl_PeekHead(&self->ready_list);
 
     /* Scheduler service is running. Important for event handling */
     self->scd_srv_is_running = true;
 
-    while(current_srv_ptr != NULL)   /* Process registered services */
+    while(current_node_ptr != NULL)   /* Process ready services */
     {
+        CService *current_srv_ptr = (CService *)Dln_GetData(current_node_ptr);
+
         if(current_srv_ptr->service_fptr != NULL)
         {
-            /* Are events pending for the current service */
-            if(current_srv_ptr->event_mask != SRV_EMPTY_EVENT_MASK)
+#ifdef UCS_PROF_GET_TIME
+            uint32_t start_time = UCS_PROF_GET_TIME();
+#endif
+            /* Keep the service in the ready list while it is executed. Therefore, its 
+             * successor can be determined after the callback has returned. */
+            self->current_srv_ptr = current_srv_ptr;
+            /* Execute service callback function */
+            current_srv_ptr->service_fptr(current_srv_ptr->instance_ptr);
+#ifdef UCS_PROF_GET_TIME
+            Srv_UpdateStats(current_srv_ptr, start_time, UCS_PROF_GET_TIME());
+#endif
+            /* Was the current service removed from the schedulers list? */
+            if(self->current_srv_ptr == NULL)
             {
-                /* Execute service callback function */
-                current_srv_ptr->service_fptr(current_srv_ptr->instance_ptr);
-                /* Was the current service removed from the schedulers list? */
-                if((current_srv_ptr->list_node.prev == NULL) && (current_srv_ptr->list_node.next == NULL))
-                {
-                    break;  /* Abort scheduler service */
-                }
+                break;  /* Abort scheduler service */
             }
+            self->current_srv_ptr = NULL;
+            executed++;
+        }
+        current_node_ptr = current_node_ptr->next;
+        /* Remove service from ready list if all events have been cleared */
+        if(current_srv_ptr->event_mask == SRV_EMPTY_EVENT_MASK)
+        {
+            (void)Dl_Remove(&self->ready_list, &current_srv_ptr->ready_node);
+        }
+        if((max_services != SCD_UNLIMITED_BUDGET) && (executed >= max_services))
+        {
+            break;  /* Budget exhausted, remaining services are executed during the next run */
         }
-        current_srv_ptr = (CService *)(void*)current_srv_ptr->list_node.next;
     }
     /* Scheduler services finished */
+    self->current_srv_ptr = NULL;
     self->scd_srv_is_running = false;
 }
 
+/*! \brief  Collects service requests instead of notifying each one separately
+ *  \details All service requests which occur until Scd_ReleaseRequest() is called 
+ *           result in a single service request notification.
+ *  \param  self   Instance pointer
+ */
+void Scd_DeferRequest(CScheduler *self)
+{
+    self->request_deferred = true;
+    self->request_pending = false;
+}
+
+/*! \brief  Stops collecting service requests and notifies a collected request
+ *  \param  self   Instance pointer
+ */
+void Scd_ReleaseRequest(CScheduler *self)
+{
+    self->request_deferred = false;
+
+    if ((self->request_pending != false) && (self->scd_srv_is_running == false))
+    {
+        Ssub_Notify(&self->service_request_subject, NULL, false);
+    }
+
+    self->request_pending = false;
+}
+
 /*! \brief  Searches for pending events.
  *  \param  self   Instance pointer
  *  \return true: At least one event is active
@@ -169,20 +261,91 @@ void Scd_Service(CScheduler *self)
  */
 bool Scd_AreEventsPending(CScheduler *self)
 {
-    bool ret_val = false;
-    CService *current_srv_ptr = (CService *)(void*)self->srv_list.head;
+#ifdef UCS_ATOMIC_EVENTS
+    return ((Dl_GetSize(&self->ready_list) != 0U) || (atomic_load(&self->async_pending) != false));
+#else
+    return (Dl_GetSize(&self->ready_list) != 0U);
+#endif
+}
 
-    while(current_srv_ptr != NULL)
+#ifdef UCS_ATOMIC_EVENTS
+/*! \brief  Transfers the events which were set by Srv_SetEventAsync() into the event masks of 
+ *          the respective services and adds these services to the ready list. The function 
+ *          must be called in the context of the UNICENS thread.
+ *  \param  self   Instance pointer
+ */
+static void Scd_TakeAsyncEvents(CScheduler *self)
+{
+    if(atomic_exchange(&self->async_pending, false) != false)
     {
-        if(current_srv_ptr->event_mask != SRV_EMPTY_EVENT_MASK)
+        CDlNode *node_ptr = Dl_PeekHead(&self->srv_list);
+
+        while(node_ptr != NULL)
         {
-            ret_val = true;
-            break;
+            CService *srv_ptr = (CService *)(void *)node_ptr;   /* list_node is the first attribute of CService */
+            Srv_Event_t event_mask = atomic_exchange(&srv_ptr->async_event_mask, SRV_EMPTY_EVENT_MASK);
+
+            if(event_mask != SRV_EMPTY_EVENT_MASK)
+            {
+                srv_ptr->event_mask |= event_mask;
+                Scd_SetReady(self, srv_ptr);
+            }
+            node_ptr = node_ptr->next;
         }
-        current_srv_ptr = (CService *)(void*)current_srv_ptr->list_node.next;
     }
+}
+#endif
 
-    return ret_val;
+#ifdef UCS_PROF_GET_TIME
+/*! \brief  Passes the execution statistics of all registered services in priority order to the 
+ *          given callback function. The list of services is traversed once.
+ *  \param  self        Instance pointer
+ *  \param  stats_fptr  Callback function which is invoked for every service until it returns \c true
+ *  \param  inst_ptr    Instance pointer passed to stats_fptr()
+ */
+void Scd_GetServiceStats(CScheduler *self, Scd_StatsCb_t stats_fptr, void *inst_ptr)
+{
+    CDlNode *node_ptr = Dl_PeekHead(&self->srv_list);
+    bool stop = false;
+
+    while((node_ptr != NULL) && (stop == false))
+    {
+        CService *srv_ptr = (CService *)(void *)node_ptr;   /* list_node is the first attribute of CService */
+        Srv_Stats_t stats = srv_ptr->stats;
+
+        stats.priority = srv_ptr->priority;
+        stop = stats_fptr(inst_ptr, &stats);
+        node_ptr = node_ptr->next;
+    }
+}
+
+#endif
+/*! \brief  Adds the given service to the list of ready services if events are pending and the 
+ *          service is registered. The ready list is arranged in priority order. Services of 
+ *          equal priority are executed in the order they became ready.
+ *  \param  self       Instance pointer
+ *  \param  srv_ptr    Reference of the service
+ */
+static void Scd_SetReady(CScheduler *self, CService *srv_ptr)
+{
+    if((srv_ptr->event_mask != SRV_EMPTY_EVENT_MASK) &&
+       (Dln_IsNodePartOfAList(&srv_ptr->list_node) != false) &&
+       (Dln_IsNodePartOfAList(&srv_ptr->ready_node) == false))
+    {
+        CDlNode *result_ptr = Dl_Foreach(&self->ready_list, &Scd_SearchReadySlot, &srv_ptr->priority);
+
+#ifdef UCS_PROF_GET_TIME
+        srv_ptr->ready_time = UCS_PROF_GET_TIME();
+#endif
+        if(result_ptr != NULL)   /* Slot found? */
+        {
+            Dl_InsertBefore(&self->ready_list, result_ptr, &srv_ptr->ready_node);
+        }
+        else                    /* No slot found -> Insert as last node */
+        {
+            Dl_InsertTail(&self->ready_list, &srv_ptr->ready_node);
+        }
+    }
 }
 
 /*! \brief  Searches the slot where the new service has to be inserted. The position depends on 
@@ -207,6 +370,22 @@ static bool Scd_SearchSlot(void *current_prio_ptr, void *new_prio_ptr)
     return ret_val;
 }
 
+/*! \brief  Searches the slot in the ready list where a service has to be inserted. In contrast to
+ *          Scd_SearchSlot() the search stops only at a service of lower priority. Thus, ready 
+ *          services of equal priority are kept in FIFO order.
+ *  \param  current_srv_ptr    Current ready service which is analyzed 
+ *  \param  new_prio_ptr       Priority of the new ready service
+ *  \return false: The priority of the current service is greater than or equal to the new priority
+ *  \return true: The priority of the current service is less than the new priority
+ */
+static bool Scd_SearchReadySlot(void *current_srv_ptr, void *new_prio_ptr)
+{
+    uint8_t current_prio_ = ((CService *)current_srv_ptr)->priority;
+    uint8_t new_prio_ = *((uint8_t*)new_prio_ptr);
+
+    return (current_prio_ < new_prio_);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CService                                                               */
 /*------------------------------------------------------------------------------------------------*/
@@ -220,9 +399,13 @@ void Srv_Ctor(CService *self, uint8_t priority, void *instance_ptr, Srv_Cb_t ser
 {
     MISC_MEM_SET(self, 0, sizeof(*self));
     Dln_Ctor(&self->list_node, NULL);
+    Dln_Ctor(&self->ready_node, self);
     self->priority = priority;
     self->instance_ptr = instance_ptr;
     self->service_fptr = service_fptr;
+#ifdef UCS_ATOMIC_EVENTS
+    atomic_init(&self->async_event_mask, SRV_EMPTY_EVENT_MASK);
+#endif
 }
 
 /*! \brief Sets events for the given service according to the given event mask.
@@ -232,12 +415,65 @@ void Srv_Ctor(CService *self, uint8_t priority, void *instance_ptr, Srv_Cb_t ser
 void Srv_SetEvent(CService *self, Srv_Event_t event_mask)
 {
     self->event_mask |= event_mask;
+    Scd_SetReady(self->scd_ptr, self);
     if(self->scd_ptr->scd_srv_is_running == false) 
     {
-        Ssub_Notify(&self->scd_ptr->service_request_subject, NULL, false);
+        if(self->scd_ptr->request_deferred != false)
+        {
+            self->scd_ptr->request_pending = true;
+        }
+        else
+        {
+            Ssub_Notify(&self->scd_ptr->service_request_subject, NULL, false);
+        }
+    }
+}
+
+#ifdef UCS_PROF_GET_TIME
+/*! \brief Updates the execution statistics of the given service after its callback has returned.
+ *  \param self        Instance pointer
+ *  \param start_time  Time stamp before the service callback was invoked
+ *  \param end_time    Time stamp after the service callback has returned
+ */
+static void Srv_UpdateStats(CService *self, uint32_t start_time, uint32_t end_time)
+{
+    uint32_t exec_time = end_time - start_time;
+    uint32_t dwell_time = start_time - self->ready_time;
+
+    self->stats.invocations++;
+    self->stats.total_time += exec_time;
+    self->stats.total_dwell_time += dwell_time;
+    if(exec_time > self->stats.max_time)
+    {
+        self->stats.max_time = exec_time;
     }
+    if(dwell_time > self->stats.max_dwell_time)
+    {
+        self->stats.max_dwell_time = dwell_time;
+    }
+    /* Events which remain pending wait from now on */
+    self->ready_time = end_time;
 }
 
+#endif
+
+#ifdef UCS_ATOMIC_EVENTS
+/*! \brief Sets events for the given service from any thread or interrupt context.
+ *  \details The events are stored without locking and are transferred to the service by the next 
+ *           run of Scd_Service(). The function requests a UNICENS service call. Therefore, the 
+ *           application callback request_service_fptr() must be safe to be called from the 
+ *           context of the caller.
+ *  \param self        Instance pointer
+ *  \param event_mask  Mask of the events to be set
+ */
+void Srv_SetEventAsync(CService *self, Srv_Event_t event_mask)
+{
+    (void)atomic_fetch_or(&self->async_event_mask, event_mask);
+    atomic_store(&self->scd_ptr->async_pending, true);
+    Ssub_Notify(&self->scd_ptr->service_request_subject, NULL, false);
+}
+
+#endif
 /*! \brief The function returns the current state of all event bits of the service.
  *  \param self            Instance pointer
  *  \param event_mask_ptr  Reference to the memory of the returned event mask
@@ -254,6 +490,12 @@ void Srv_GetEvent(CService *self, Srv_Event_t *event_mask_ptr)
 void Srv_ClearEvent(CService *self, Srv_Event_t event_mask)
 {
     self->event_mask &= ~event_mask;
+    /* The running service is removed from the ready list by Scd_Service() */
+    if((self->event_mask == SRV_EMPTY_EVENT_MASK) && (self->scd_ptr != NULL) &&
+       (self->scd_ptr->current_srv_ptr != self) && (Dln_IsNodePartOfAList(&self->ready_node) != false))
+    {
+        (void)Dl_Remove(&self->scd_ptr->ready_list, &self->ready_node);
+    }
 }
 
 /*!
@@ -57,15 +57,18 @@ static const uint16_t SEGM_GC_TIMEOUT = 5000U;  /* parasoft-suppress  MISRA2004-
 /*------------------------------------------------------------------------------------------------*/
 /* Internal prototypes                                                                            */
 /*------------------------------------------------------------------------------------------------*/
+static void Segm_TxAttachPayload(Msg_MostTel_t *tel_ptr, Ucs_AmsTx_Msg_t *msg_ptr, uint16_t index, uint8_t size);
+static Msg_TxPrio_t Segm_TxGetPriority(Ucs_AmsTx_Msg_t *msg_ptr);
 static Ucs_AmsRx_Msg_t *Segm_RxRetrieveProcessingHandle(CSegmentation *self, Msg_MostTel_t *tel_ptr);
 static void Segm_RxStoreProcessingHandle(CSegmentation *self, Ucs_AmsRx_Msg_t *msg_ptr);
 static bool Segm_RxSearchProcessingHandle(void *current_data, void *search_data);
 static bool Segm_RxGcSetLabel(void *current_data, void *search_data);
 static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId0(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
 static void             Segm_RxProcessTelId1(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
-static void             Segm_RxProcessTelId2(CSegmentation *self, Msg_MostTel_t *tel_ptr);
-static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId3(CSegmentation *self, Msg_MostTel_t *tel_ptr);
+static void             Segm_RxProcessTelId2(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
+static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId3(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
 static void             Segm_RxProcessTelId4(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
+static bool             Segm_RxKeepSegment(CSegmentation *self, Ucs_AmsRx_Msg_t *msg_ptr, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Initialization methods                                                                         */
@@ -118,11 +121,41 @@ void Segm_Cleanup(CSegmentation *self)
     {
         Ucs_AmsRx_Msg_t *rx_ptr = (Ucs_AmsRx_Msg_t*)Dln_GetData(node_ptr);
 
-        Amsp_FreeRxPayload(self->pool_ptr, rx_ptr);
+        Segm_RxFreePayload(self, rx_ptr);
         Amsp_FreeRxObj(self->pool_ptr, rx_ptr);
     }
 }
 
+/*! \brief Enables or disables zero-copy reception of segmented messages
+ *  \details If enabled, the received telegrams of a segmented message are not copied to a 
+ *           contiguous payload buffer. The telegrams are kept and provided as chain of memory 
+ *           buffers in Ucs_AmsRx_Msg_t::segments_ptr until the message is freed.
+ *  \param  self       The instance
+ *  \param  enabled    \c true to enable zero-copy reception, otherwise \c false
+ */
+void Segm_RxSetZeroCopy(CSegmentation *self, bool enabled)
+{
+    self->rx_zero_copy = enabled;
+}
+
+/*! \brief  Frees the payload of an Rx message
+ *  \details Releases all telegrams which are kept as payload segments and frees the payload
+ *           which is provided by the memory management.
+ *  \param  self       The instance
+ *  \param  msg_ptr    Reference to the Rx message
+ */
+void Segm_RxFreePayload(CSegmentation *self, Ucs_AmsRx_Msg_t *msg_ptr)
+{
+    Msg_MostTel_t *tel_ptr;
+
+    for (tel_ptr = Amsg_RxRemoveSegment(msg_ptr); tel_ptr != NULL; tel_ptr = Amsg_RxRemoveSegment(msg_ptr))
+    {
+        Trcv_RxReleaseDetachedMsg((CTransceiver*)tel_ptr->info_ptr, tel_ptr);   /* credit was released when kept */
+    }
+
+    Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* Tx segmentation                                                                                */
 /*------------------------------------------------------------------------------------------------*/
@@ -142,10 +175,11 @@ bool Segm_TxBuildSegment(CSegmentation *self, Ucs_AmsTx_Msg_t* msg_ptr, Msg_Most
     tel_ptr->opts.llrbc       = msg_ptr->llrbc;
     tel_ptr->info_ptr         = msg_ptr;                            /* info_ptr must carry the reference to AMS Tx message object */
     tel_ptr->opts.cancel_id   = Amsg_TxGetFollowerId(msg_ptr);
+    Trcv_TxSetPriority(tel_ptr, Segm_TxGetPriority(msg_ptr));       /* all segments share the priority class of the message */
 
     if (msg_ptr->data_size <= SEGM_MAX_SIZE_TEL)                      /* is single transfer? */
     {
-        Msg_SetExtPayload((CMessage*)(void*)tel_ptr, msg_ptr->data_ptr, (uint8_t)msg_ptr->data_size, NULL);
+        Segm_TxAttachPayload(tel_ptr, msg_ptr, 0U, (uint8_t)msg_ptr->data_size);
         finished = true;
     }
     else                                                            /* is segmented transfer? */
@@ -184,7 +218,7 @@ bool Segm_TxBuildSegment(CSegmentation *self, Ucs_AmsTx_Msg_t* msg_ptr, Msg_Most
             }
 
             tel_ptr->tel.tel_cnt = (uint8_t)next_segm_cnt;
-            Msg_SetExtPayload((CMessage*)(void*)tel_ptr, &msg_ptr->data_ptr[index], tel_sz, NULL);
+            Segm_TxAttachPayload(tel_ptr, msg_ptr, index, tel_sz);
         }
 
         Amsg_TxIncrementNextSegmCnt(msg_ptr);
@@ -193,6 +227,52 @@ bool Segm_TxBuildSegment(CSegmentation *self, Ucs_AmsTx_Msg_t* msg_ptr, Msg_Most
     return finished;
 }
 
+/*! \brief   Attaches a part of the Application Message payload to a MOST telegram
+ *  \details The payload is attached as external memory. Only if the part is located in 
+ *           multiple memory buffers of an application owned payload, it is copied to 
+ *           the internal payload of the telegram.
+ *  \param   tel_ptr Reference to the MOST Telegram handle
+ *  \param   msg_ptr Reference to the Application Message Tx handle
+ *  \param   index   Payload index of the first byte
+ *  \param   size    Size of the part in bytes
+ */
+static void Segm_TxAttachPayload(Msg_MostTel_t *tel_ptr, Ucs_AmsTx_Msg_t *msg_ptr, uint16_t index, uint8_t size)
+{
+    uint8_t *data_ptr = Amsg_TxGetPayload(msg_ptr, index, size, tel_ptr->tel.tel_data_ptr);
+
+    if (data_ptr == tel_ptr->tel.tel_data_ptr)
+    {
+        tel_ptr->tel.tel_len = size;                                /* payload was copied to the telegram */
+    }
+    else
+    {
+        Msg_SetExtPayload((CMessage*)(void*)tel_ptr, data_ptr, size, NULL);
+    }
+}
+
+/*! \brief  Maps the application message priority to the FIFO priority class
+ *  \param  msg_ptr The application message
+ *  \return The priority class of the related telegrams
+ */
+static Msg_TxPrio_t Segm_TxGetPriority(Ucs_AmsTx_Msg_t *msg_ptr)
+{
+    Msg_TxPrio_t ret = MSG_TX_PRIO_NORMAL;
+
+    switch (msg_ptr->priority)
+    {
+        case UCS_AMSTX_PRIO_HIGH:
+            ret = MSG_TX_PRIO_HIGH;
+            break;
+        case UCS_AMSTX_PRIO_LOW:
+            ret = MSG_TX_PRIO_LOW;
+            break;
+        default:
+            break;
+    }
+
+    return ret;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /* Rx pools                                                                                       */
 /*------------------------------------------------------------------------------------------------*/
@@ -250,7 +330,7 @@ void Segm_RxGcScanProcessingHandles(void *self)
 
             (void)Dl_Remove(&self_->processing_list, node_ptr);
 
-            Amsp_FreeRxPayload(self_->pool_ptr, msg_ptr);
+            Segm_RxFreePayload(self_, msg_ptr);
             Amsp_FreeRxObj(self_->pool_ptr, msg_ptr);
 
             node_ptr = Dl_PeekHead(&self_->processing_list);                /* get next candidate from head */
@@ -314,10 +394,10 @@ Ucs_AmsRx_Msg_t* Segm_RxExecuteSegmentation(CSegmentation *self, Msg_MostTel_t *
             Segm_RxProcessTelId1(self, tel_ptr, result_ptr);
             break;
         case 2U:
-            Segm_RxProcessTelId2(self, tel_ptr);
+            Segm_RxProcessTelId2(self, tel_ptr, result_ptr);
             break;
         case 3U:
-            msg_ptr = Segm_RxProcessTelId3(self, tel_ptr);
+            msg_ptr = Segm_RxProcessTelId3(self, tel_ptr, result_ptr);
             break;
         case 4U:
             Segm_RxProcessTelId4(self, tel_ptr, result_ptr);
@@ -344,7 +424,7 @@ static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId0(CSegmentation *self, Msg_MostTel_t
     if (msg_ptr != NULL)                            /* treat error: segmentation process is ongoing */ 
     {
         self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_7);
-        Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);/* free assigned user payload and throw segmentation error */
+        Segm_RxFreePayload(self, msg_ptr);          /* free assigned user payload and throw segmentation error */
         Amsp_FreeRxObj(self->pool_ptr, msg_ptr);
         msg_ptr = NULL;
     }
@@ -353,7 +433,7 @@ static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId0(CSegmentation *self, Msg_MostTel_t
 
     if (msg_ptr == NULL)
     {
-        msg_ptr = Amsp_AllocRxRsvd(self->pool_ptr);
+        msg_ptr = Amsp_AllocRxRsvd(self->pool_ptr, tel_ptr->source_addr, Msg_GetAltMsgId((CMessage*)(void*)tel_ptr));
     }
 
     if (msg_ptr != NULL)                            /* handle available: setup Rx Application Message */
@@ -401,7 +481,7 @@ static void Segm_RxProcessTelId1(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
             if ((Amsg_RxGetExpTelCnt(msg_ptr) != 0U) || (msg_ptr->data_size > 0U)) 
             {                                                   /* error: previous message already contains segments */
                 self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_7);
-                Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);
+                Segm_RxFreePayload(self, msg_ptr);
                 Amsg_RxHandleSetup(msg_ptr);                    /* initialize message for re-use */
             }
             else                                                /* message and payload had been allocated by TelId '4' */
@@ -419,10 +499,28 @@ static void Segm_RxProcessTelId1(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
             if (is_size_prefixed == false)
             {
                 Amsg_RxCopySignatureFromTel(msg_ptr, tel_ptr);  /* save signature and try to allocate */
-                (void)Amsp_AllocRxPayload(self->pool_ptr, self->rx_default_payload_sz, msg_ptr);
+
+                if (self->rx_zero_copy == false)
+                {
+                    (void)Amsp_AllocRxPayload(self->pool_ptr, self->rx_default_payload_sz, msg_ptr);
+                }
             }
 
-            if (!Amsg_RxHasExternalPayload(msg_ptr))            /* allocation of payload failed */
+            if (self->rx_zero_copy != false)                    /* keep telegram as first segment */
+            {
+                if (Segm_RxKeepSegment(self, msg_ptr, tel_ptr, result_ptr) != false)
+                {
+                    Segm_RxStoreProcessingHandle(self, msg_ptr);
+                }
+                else
+                {
+                    self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_2);
+                    Segm_RxFreePayload(self, msg_ptr);
+                    Amsp_FreeRxObj(self->pool_ptr, msg_ptr);
+                }
+                msg_ptr = NULL;
+            }
+            else if (!Amsg_RxHasExternalPayload(msg_ptr))       /* allocation of payload failed */
             {
                 self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_2);
                 Amsp_FreeRxObj(self->pool_ptr, msg_ptr);
@@ -443,13 +541,14 @@ static void Segm_RxProcessTelId1(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
 }
 
 /*! \brief  Processes segmentation for a received MOST telegram with \c TelId="2"
- *  \param  self    The instance
- *  \param  tel_ptr The received MOST telegram
+ *  \param  self        The instance
+ *  \param  tel_ptr     The received MOST telegram
+ *  \param  result_ptr  Result of segmentation process
  */
-static void Segm_RxProcessTelId2(CSegmentation *self, Msg_MostTel_t *tel_ptr)
+static void Segm_RxProcessTelId2(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr)
 {
-    Ucs_AmsRx_Msg_t *msg_ptr = Segm_RxProcessTelId3(self, tel_ptr); /* pretend having TelId '2' but store the */
-                                                                    /* assembled message again */
+    Ucs_AmsRx_Msg_t *msg_ptr = Segm_RxProcessTelId3(self, tel_ptr, result_ptr); /* pretend having TelId '2' but store the */
+                                                                                /* assembled message again */
     if (msg_ptr != NULL)
     {
         Segm_RxStoreProcessingHandle(self, msg_ptr);
@@ -457,12 +556,13 @@ static void Segm_RxProcessTelId2(CSegmentation *self, Msg_MostTel_t *tel_ptr)
 }
 
 /*! \brief  Processes segmentation for a received MOST telegram with \c TelId="3"
- *  \param  self    The instance
- *  \param  tel_ptr The received MOST telegram
+ *  \param  self        The instance
+ *  \param  tel_ptr     The received MOST telegram
+ *  \param  result_ptr  Result of segmentation process
  *  \return The assembled Rx Application Message or \c NULL if segmentation process
  *          did not process successfully.
  */
-static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId3(CSegmentation *self, Msg_MostTel_t *tel_ptr)
+static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId3(CSegmentation *self, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr)
 {
     Ucs_AmsRx_Msg_t *msg_ptr = Segm_RxRetrieveProcessingHandle(self, tel_ptr);
 
@@ -489,12 +589,21 @@ static Ucs_AmsRx_Msg_t* Segm_RxProcessTelId3(CSegmentation *self, Msg_MostTel_t
 
         if (msg_ptr != NULL)
         {
-            bool succ = Amsg_RxAppendPayload(msg_ptr, tel_ptr);
+            bool succ;
+
+            if (self->rx_zero_copy != false)                /* keep telegram as further segment */
+            {
+                succ = Segm_RxKeepSegment(self, msg_ptr, tel_ptr, result_ptr);
+            }
+            else
+            {
+                succ = Amsg_RxAppendPayload(msg_ptr, tel_ptr);
+            }
 
             if (succ == false)
             {
                 self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_2);
-                Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);
+                Segm_RxFreePayload(self, msg_ptr);
                 Amsp_FreeRxObj(self->pool_ptr, msg_ptr);
                 msg_ptr = NULL;
             }
@@ -524,7 +633,7 @@ static void Segm_RxProcessTelId4(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
 
             if (msg_ptr != NULL)                            /* treat error: segmentation process is ongoing */
             {
-                Amsp_FreeRxPayload(self->pool_ptr, msg_ptr);
+                Segm_RxFreePayload(self, msg_ptr);
                 self->error_fptr(self->error_inst, tel_ptr, SEGM_ERR_7);
                 Amsg_RxHandleSetup(msg_ptr);                /* initialize message for re-use */
             }
@@ -536,7 +645,12 @@ static void Segm_RxProcessTelId4(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
             if (msg_ptr != NULL)                            /* allocation succeeded: decode length and allocate payload */
             {
                 Amsg_RxCopySignatureFromTel(msg_ptr, tel_ptr);
-                (void)Amsp_AllocRxPayload(self->pool_ptr, msg_size, msg_ptr);
+                Amsg_RxSetExpSize(msg_ptr, msg_size);       /* limits the zero-copy reception */
+
+                if (self->rx_zero_copy == false)            /* payload is not required for zero-copy reception */
+                {
+                    (void)Amsp_AllocRxPayload(self->pool_ptr, msg_size, msg_ptr);
+                }
                 Segm_RxStoreProcessingHandle(self, msg_ptr);/* store handle and don't care if payload was allocated or not */
                 msg_ptr = NULL;                             /* segmentation error 2 is treated by TelId 1 */
             }
@@ -548,6 +662,57 @@ static void Segm_RxProcessTelId4(CSegmentation *self, Msg_MostTel_t *tel_ptr, Se
     }
 }
 
+/*! \brief  Appends a received telegram to a message of the zero-copy reception
+ *  \details The telegram is kept as payload segment as long as the Rx pool of the channel
+ *           permits further detached telegrams. Otherwise, the telegram and all further 
+ *           telegrams of the message are copied to payload which is allocated from the memory
+ *           management. Thus, long messages cannot exhaust the Rx pool of the channel.
+ *  \param  self        The instance
+ *  \param  msg_ptr     The Rx message
+ *  \param  tel_ptr     The received MOST telegram
+ *  \param  result_ptr  Result of segmentation process, is set to \c SEGM_RES_KEPT if the 
+ *                      telegram is kept
+ *  \return Returns \c true if the telegram was appended, otherwise \c false if the message 
+ *          size is exceeded or no payload is available.
+ */
+static bool Segm_RxKeepSegment(CSegmentation *self, Ucs_AmsRx_Msg_t *msg_ptr, Msg_MostTel_t *tel_ptr, Segm_Result_t *result_ptr)
+{
+    bool succ = Amsg_RxCheckSize(msg_ptr, tel_ptr->tel.tel_len);
+
+    if (succ == false)
+    {
+        /* message size exceeds announced size */
+    }
+    else if ((Amsg_RxHasExternalPayload(msg_ptr) == false) &&
+             (Trcv_RxDetachMsg((CTransceiver*)tel_ptr->info_ptr, tel_ptr) != false))
+    {
+        Amsg_RxAppendSegment(msg_ptr, tel_ptr);
+        *result_ptr = SEGM_RES_KEPT;
+    }
+    else                                                        /* fall back to copying */
+    {
+        if (Amsg_RxHasExternalPayload(msg_ptr) == false)
+        {
+            uint16_t payload_sz = self->rx_default_payload_sz;
+            uint16_t exp_size = Amsg_RxGetExpSize(msg_ptr);
+
+            if (exp_size > msg_ptr->data_size)
+            {
+                payload_sz = exp_size - msg_ptr->data_size;     /* remaining size of announced message */
+            }
+
+            succ = Amsp_AllocRxPayload(self->pool_ptr, payload_sz, msg_ptr);
+        }
+
+        if (succ != false)
+        {
+            succ = Amsg_RxAppendPayload(msg_ptr, tel_ptr);
+        }
+    }
+
+    return succ;
+}
+
 /*!
  * @}
  * \endcond
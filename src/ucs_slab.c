@@ -0,0 +1,375 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \file
+ * \brief Implementation of the class CSlabMemoryManager.
+ * \details The slab memory manager is a plug-in for the memory allocator interface of the 
+ *          application message service. The three small size classes are derived from the
+ *          configured payload size and from the size of the Rx and Tx message objects. The two
+ *          large size classes hold segmented payload. The arena is split into one partition per
+ *          size class. Memory blocks are carved from the partition of their size class on demand.
+ *          Freed blocks are kept in the list of their size class and are reused by subsequent
+ *          allocations. If a size class is exhausted, a block is borrowed from the next larger
+ *          size class.
+ * \cond UCS_INTERNAL_DOC
+ * \addtogroup G_UCS_SLAB_CLASS
+ * @{
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include "ucs_slab.h"
+#include "ucs_amsmessage.h"
+#include "ucs_smm_pb.h"
+#include "ucs_misc.h"
+#include "ucs_trace.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Internal constants                                                                             */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Rounds a size up to a multiple of 16 to keep the alignment of the arena for each block */
+#define SLAB_ALIGN(size)        ((((uint32_t)(size)) + 15U) & ~((uint32_t)15U))
+/*! \brief Larger one of the configured Rx and Tx payload sizes */
+#if (UCS_AMS_SIZE_RX_MSG > UCS_AMS_SIZE_TX_MSG)
+# define SLAB_SIZE_PAYLOAD      UCS_AMS_SIZE_RX_MSG
+#else
+# define SLAB_SIZE_PAYLOAD      UCS_AMS_SIZE_TX_MSG
+#endif
+/*! \brief Block size of the payload class, limited to the block size of the first large class */
+#if (SLAB_SIZE_PAYLOAD > 1024)
+# define SLAB_BLOCK_PAYLOAD     1024U
+#else
+# define SLAB_BLOCK_PAYLOAD     SLAB_ALIGN(SLAB_SIZE_PAYLOAD)
+#endif
+
+/*! \brief Index of the size class for Rx message objects */
+#define SLAB_IDX_RX_OBJECT      1U
+/*! \brief Index of the size class for Tx message objects */
+#define SLAB_IDX_TX_OBJECT      2U
+/*! \brief Index of the first large size class */
+#define SLAB_IDX_LARGE          3U
+
+/*! \brief Block sizes of the size classes: payload of single telegram messages, Rx and Tx
+ *         message objects and two classes for segmented payload
+ */
+static const uint16_t SLAB_BLOCK_SIZES[SLAB_NUM_CLASSES] =
+{
+    (uint16_t)SLAB_BLOCK_PAYLOAD,
+    (uint16_t)SLAB_ALIGN(AMSG_RX_OBJECT_SZ),
+    (uint16_t)SLAB_ALIGN(AMSG_TX_OBJECT_SZ),
+    1024U,
+    4096U
+};
+/*! \brief Number of blocks per size class which hold one Rx and one Tx message of a single
+ *         telegram. The small partitions are sized in multiples of such message pairs.
+ */
+static const uint8_t SLAB_BLOCKS_PER_PAIR[SLAB_IDX_LARGE] = { 2U, 1U, 1U };
+/*! \brief Shares of the arena in sixteenths which take message pairs */
+static const uint32_t SLAB_PAIR_SHARES = 12U;
+/*! \brief Shares of the large size classes in sixteenths of the remaining memory */
+static const uint8_t SLAB_LARGE_SHARES[SLAB_NUM_CLASSES - SLAB_IDX_LARGE] = { 4U, 12U };
+/*! \brief Sum of all shares */
+static const uint32_t SLAB_SHARES_TOTAL = 16U;
+
+/*------------------------------------------------------------------------------------------------*/
+/* Internal prototypes                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+static Slab_Class_t* Slab_FindClass(CSlabMemoryManager *self, uint16_t mem_size);
+static Slab_Class_t* Slab_FindLender(CSlabMemoryManager *self, Slab_Class_t *class_ptr);
+static void* Slab_AllocateBlock(Slab_Class_t *class_ptr);
+static void* Slab_Allocate(void *self, uint16_t mem_size, Ams_MemUsage_t type, void** custom_info_pptr);
+static void Slab_Free(void *self, void *mem_ptr, Ams_MemUsage_t type, void* custom_info_ptr);
+
+/*------------------------------------------------------------------------------------------------*/
+/* Implementation                                                                                 */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Constructor of the slab memory manager. The arena is split into the partitions of 
+ *         the size classes. Twelve sixteenths of the arena are given to the small size classes
+ *         in multiples of a message pair, i.e. two payload blocks, one Rx and one Tx message
+ *         object. The remaining memory is split 1:3 among the large size classes. Memory of a
+ *         partition which is too small for a block of its size class is passed on to the next
+ *         smaller size class.
+ *  \param self         The instance
+ *  \param arena_ptr    Reference to the arena. The memory must be aligned like memory 
+ *                      returned by malloc().
+ *  \param arena_size   Size of the arena in bytes
+ *  \param ucs_user_ptr User reference that needs to be passed in every callback function
+ */
+void Slab_Ctor(CSlabMemoryManager *self, void *arena_ptr, uint32_t arena_size, void *ucs_user_ptr)
+{
+    uint8_t *area_ptr = (uint8_t*)arena_ptr;
+    uint32_t sizes[SLAB_NUM_CLASSES];
+    uint32_t pair_size = 0U;
+    uint32_t num_pairs;
+    uint32_t large_size;
+    uint32_t large_used = 0U;
+    uint32_t carry;
+    uint8_t index;
+
+    MISC_MEM_SET(self, 0, sizeof(*self));
+    self->ucs_user_ptr = ucs_user_ptr;
+    self->arena_ptr = (uint8_t*)arena_ptr;
+    self->arena_size = arena_size;
+
+    for (index = 0U; index < SLAB_IDX_LARGE; index++)
+    {
+        pair_size += (uint32_t)SLAB_BLOCK_SIZES[index] * (uint32_t)SLAB_BLOCKS_PER_PAIR[index];
+    }
+
+    num_pairs = ((arena_size / SLAB_SHARES_TOTAL) * SLAB_PAIR_SHARES) / pair_size;
+    large_size = arena_size - (num_pairs * pair_size);
+
+    for (index = 0U; index < SLAB_NUM_CLASSES; index++)
+    {
+        if (index < SLAB_IDX_LARGE)
+        {
+            sizes[index] = num_pairs * (uint32_t)SLAB_BLOCK_SIZES[index] * (uint32_t)SLAB_BLOCKS_PER_PAIR[index];
+        }
+        else
+        {
+            sizes[index] = (large_size / SLAB_SHARES_TOTAL) * (uint32_t)SLAB_LARGE_SHARES[index - SLAB_IDX_LARGE];
+            large_used += sizes[index];
+        }
+    }
+
+    carry = large_size - large_used;                /* rounding remainder of the large partitions */
+
+    for (index = SLAB_NUM_CLASSES; index > 0U; index--)
+    {
+        Slab_Class_t *class_ptr = &self->classes[index - 1U];
+        class_ptr->block_size = SLAB_BLOCK_SIZES[index - 1U];
+
+        if (area_ptr != NULL)
+        {
+            uint32_t size = sizes[index - 1U] + carry;
+            carry = size % (uint32_t)class_ptr->block_size;
+            class_ptr->area_ptr = area_ptr;
+            class_ptr->area_remaining = size - carry;
+            area_ptr = &area_ptr[class_ptr->area_remaining];
+        }
+    }
+}
+
+/*! \brief  Load function of the slab memory management plug-in.
+ *  \param  self                The instance
+ *  \param  allocator_ptr       Assignable interface for allocate and free functions
+ *  \param  rx_def_payload_size The default Rx allocation size the AMS uses if TelId "4" is missing.
+ *                              Just use for checks. Do not overrule.
+ *  \return Returns \c UCS_RET_SUCCESS if the initialization succeeded, otherwise \c UCS_RET_ERR_PARAM.
+ *          The initialization fails if the arena cannot hold one Rx and one Tx message or if
+ *          no partition provides a block for \c rx_def_payload_size.
+ */
+Ucs_Return_t Slab_LoadPlugin(CSlabMemoryManager *self, Ams_MemAllocator_t *allocator_ptr, uint16_t rx_def_payload_size)
+{
+    Ucs_Return_t ret = UCS_RET_SUCCESS;
+    bool rx_def_fits = false;
+    uint8_t index;
+
+    for (index = 0U; index < SLAB_NUM_CLASSES; index++)
+    {
+        if ((rx_def_payload_size <= self->classes[index].block_size) && (self->classes[index].area_remaining > 0U))
+        {
+            rx_def_fits = true;
+        }
+    }
+
+    allocator_ptr->inst_ptr = self;             /* assign instance to allocator */
+    allocator_ptr->alloc_fptr = &Slab_Allocate; /* assign callback functions */
+    allocator_ptr->free_fptr = &Slab_Free;
+    allocator_ptr->alloc_bulk_fptr = NULL;      /* chunks are allocated one by one */
+
+    if ((self->arena_ptr == NULL) || (self->classes[SLAB_IDX_RX_OBJECT].area_remaining == 0U) ||
+        (self->classes[SLAB_IDX_TX_OBJECT].area_remaining == 0U) || (rx_def_fits == false))
+    {
+        ret = UCS_RET_ERR_PARAM;
+        TR_ERROR((self->ucs_user_ptr, "[SLAB]", "SLAB initialization failed: wrong configuration of arena or rx_def_payload_size.", 0U));
+    }
+
+    return ret;
+}
+
+/*! \brief  Retrieves the size class with the smallest blocks which fit the requested size and
+ *          which owns a partition of the arena
+ *  \param  self        The instance
+ *  \param  mem_size    Size of the memory in bytes
+ *  \return Returns a reference to the size class or \c NULL if no size class fits
+ */
+static Slab_Class_t* Slab_FindClass(CSlabMemoryManager *self, uint16_t mem_size)
+{
+    Slab_Class_t *class_ptr = NULL;
+    uint8_t index;
+
+    for (index = 0U; index < SLAB_NUM_CLASSES; index++)
+    {
+        Slab_Class_t *curr_ptr = &self->classes[index];
+
+        if ((mem_size <= curr_ptr->block_size) && ((curr_ptr->num_blocks > 0U) || (curr_ptr->area_remaining > 0U)))
+        {
+            if ((class_ptr == NULL) || (curr_ptr->block_size < class_ptr->block_size))
+            {
+                class_ptr = curr_ptr;
+            }
+        }
+    }
+
+    return class_ptr;
+}
+
+/*! \brief  Retrieves the size class with the smallest blocks which are at least as large as the
+ *          blocks of an exhausted size class and which still provides a block
+ *  \param  self        The instance
+ *  \param  class_ptr   Reference to the exhausted size class
+ *  \return Returns a reference to the lending size class or \c NULL if no size class provides
+ *          a block
+ */
+static Slab_Class_t* Slab_FindLender(CSlabMemoryManager *self, Slab_Class_t *class_ptr)
+{
+    Slab_Class_t *lender_ptr = NULL;
+    uint8_t index;
+
+    for (index = 0U; index < SLAB_NUM_CLASSES; index++)
+    {
+        Slab_Class_t *curr_ptr = &self->classes[index];
+
+        if ((curr_ptr != class_ptr) && (curr_ptr->block_size >= class_ptr->block_size) &&
+            ((curr_ptr->free_ptr != NULL) || (curr_ptr->area_remaining >= curr_ptr->block_size)))
+        {
+            if ((lender_ptr == NULL) || (curr_ptr->block_size < lender_ptr->block_size))
+            {
+                lender_ptr = curr_ptr;
+            }
+        }
+    }
+
+    return lender_ptr;
+}
+
+/*! \brief  Retrieves a block of a size class. A new block is carved from the partition of the
+ *          size class if no unused block is available.
+ *  \param  class_ptr   Reference to the size class
+ *  \return Returns a reference to the block or \c NULL if neither an unused block nor enough 
+ *          memory of the partition is available
+ */
+static void* Slab_AllocateBlock(Slab_Class_t *class_ptr)
+{
+    void *mem_ptr = NULL;
+
+    if (class_ptr->free_ptr != NULL)
+    {
+        mem_ptr = class_ptr->free_ptr;
+        class_ptr->free_ptr = class_ptr->free_ptr->next_ptr;
+        class_ptr->num_free--;
+    }
+    else if (class_ptr->area_remaining >= class_ptr->block_size)
+    {
+        mem_ptr = class_ptr->area_ptr;
+        class_ptr->area_ptr = &class_ptr->area_ptr[class_ptr->block_size];
+        class_ptr->area_remaining -= class_ptr->block_size;
+        class_ptr->num_blocks++;
+    }
+    else
+    {
+        /* no memory available in this size class */
+    }
+
+    return mem_ptr;
+}
+
+/*! \brief  Allocates memory of a certain type. The memory is taken from the smallest size class
+ *          which fits the requested size and owns a partition of the arena. If this size class
+ *          is exhausted, the block is borrowed from the next larger size class which still
+ *          provides memory. A borrowed block returns to the lending size class when it is freed.
+ *  \param  self             The instance
+ *  \param  mem_size         Size of the memory in bytes
+ *  \param  type             The memory usage type
+ *  \param  custom_info_pptr Reference to custom information
+ *  \return Returns a reference to the allocated memory or \c NULL if the allocation is not possible
+ */
+static void* Slab_Allocate(void *self, uint16_t mem_size, Ams_MemUsage_t type, void** custom_info_pptr)
+{
+    CSlabMemoryManager *self_ = (CSlabMemoryManager*)self;
+    Slab_Class_t *class_ptr = Slab_FindClass(self_, mem_size);
+    void *mem_ptr = NULL;
+
+    if (class_ptr != NULL)
+    {
+        mem_ptr = Slab_AllocateBlock(class_ptr);
+
+        if (mem_ptr == NULL)                        /* borrow from the next larger size class */
+        {
+            class_ptr = Slab_FindLender(self_, class_ptr);
+
+            if (class_ptr != NULL)
+            {
+                mem_ptr = Slab_AllocateBlock(class_ptr);
+            }
+        }
+
+        if (mem_ptr != NULL)
+        {
+            *custom_info_pptr = class_ptr;
+        }
+    }
+
+    MISC_UNUSED(type);
+    return mem_ptr;
+}
+
+/*! \brief  Frees memory of a certain type
+ *  \param  self             The instance
+ *  \param  mem_ptr          Reference to the memory chunk
+ *  \param  type             The memory usage type
+ *  \param  custom_info_ptr  Reference to the size class of the memory chunk
+ */
+static void Slab_Free(void *self, void *mem_ptr, Ams_MemUsage_t type, void* custom_info_ptr)
+{
+    CSlabMemoryManager *self_ = (CSlabMemoryManager*)self;
+    Slab_Class_t *class_ptr = (Slab_Class_t*)custom_info_ptr;
+    Slab_FreeBlock_t *block_ptr = (Slab_FreeBlock_t*)mem_ptr;
+
+    TR_ASSERT(self_->ucs_user_ptr, "[SLAB]", ((class_ptr != NULL) && (block_ptr != NULL)));
+    block_ptr->next_ptr = class_ptr->free_ptr;
+    class_ptr->free_ptr = block_ptr;
+    class_ptr->num_free++;
+    MISC_UNUSED(self_);
+    MISC_UNUSED(type);
+}
+
+/*!
+ * @}
+ * \endcond
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+
@@ -49,6 +49,8 @@
 static Smm_Descriptor_t* Smm_GetTypeDescriptor(CStaticMemoryManager *self, Ams_MemUsage_t type);
 static void* Smm_Allocate(void *self, uint16_t mem_size, Ams_MemUsage_t type, void** custom_info_pptr);
 static void Smm_Free(void *self, void *mem_ptr, Ams_MemUsage_t type, void* custom_info_ptr);
+static bool Smm_AllocateBulk(void *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, 
+                             void* mem_ptrs[], void* custom_info_ptrs[]);
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation                                                                                 */
@@ -107,6 +109,7 @@ Ucs_Return_t Smm_LoadPlugin(CStaticMemoryManager *self, Ams_MemAllocator_t *allo
     allocator_ptr->inst_ptr = self;             /* assign instance to allocator */
     allocator_ptr->alloc_fptr = &Smm_Allocate;  /* assign callback functions */
     allocator_ptr->free_fptr = &Smm_Free;
+    allocator_ptr->alloc_bulk_fptr = &Smm_AllocateBulk;
 
     if (rx_def_payload_size != SMM_SIZE_RX_MSG)
     {
@@ -178,6 +181,40 @@ static void* Smm_Allocate(void *self, uint16_t mem_size, Ams_MemUsage_t type, vo
     return mem_ptr;
 }
 
+/*! \brief  Allocates several memory chunks of a certain type in one operation
+ *  \details The function allocates either all or no memory chunks.
+ *  \param  self             The instance
+ *  \param  mem_size         Size of every memory chunk in bytes
+ *  \param  type             The memory usage type
+ *  \param  count            Number of memory chunks
+ *  \param  mem_ptrs         Receives the references to the memory chunks
+ *  \param  custom_info_ptrs Receives the custom references of the memory chunks
+ *  \return Returns \c true if all memory chunks are allocated, otherwise \c false.
+ */
+static bool Smm_AllocateBulk(void *self, uint16_t mem_size, Ams_MemUsage_t type, uint8_t count, 
+                             void* mem_ptrs[], void* custom_info_ptrs[])
+{
+    CStaticMemoryManager *self_ = (CStaticMemoryManager*)self;
+    Smm_Descriptor_t* descr_ptr = Smm_GetTypeDescriptor(self_, type);
+    bool success = false;
+
+    if ((mem_size <= descr_ptr->max_mem_size) && (Dl_GetSize(&descr_ptr->list) >= (uint16_t)count))
+    {
+        uint8_t i;
+
+        for (i = 0U; i < count; i++)
+        {
+            CDlNode *node_ptr = Dl_PopHead(&descr_ptr->list);
+            mem_ptrs[i] = Dln_GetData(node_ptr);
+            custom_info_ptrs[i] = node_ptr;
+        }
+
+        success = true;
+    }
+
+    return success;
+}
+
 /*! \brief  Frees memory of a certain type
  *  \param  self             The instance
  *  \param  mem_ptr          Reference to the memory chunk
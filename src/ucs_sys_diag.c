@@ -402,6 +402,7 @@ static const Fsm_StateElem_t sys_diag_trans_tab[SYS_DIAG_NUM_STATES][SYS_DIAG_NU
 
     /* Initialize System Diagnosis service */
     Srv_Ctor(&self->sd_srv, SD_SRV_PRIO, self, &Sd_Service);
+    SRV_SET_NAME(&self->sd_srv, "SD");
     /* Add System Diagnosis service to scheduler */
     (void)Scd_AddService(&self->base->scd, &self->sd_srv);
 
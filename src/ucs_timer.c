@@ -57,14 +57,29 @@ static const Srv_Event_t TM_EVENT_UPDATE_TIMERS = 1U;
 /*------------------------------------------------------------------------------------------------*/
 static void Tm_Service(void *self);
 static void Tm_UpdateTimers(CTimerManagement *self);
-static bool Tm_HandleElapsedTimer(CTimerManagement *self);
-static bool Tm_UpdateTimersAdd(void *c_timer_ptr, void *n_timer_ptr);
+static bool Tm_IsAnyTimerRunning(CTimerManagement *self);
+static void Tm_ReleaseTimers(CDlList *list_ptr);
+static bool Tm_GetNextTimeout(CTimerManagement *self, Tm_Tick_t *new_time_ptr);
+static Tm_Tick_t Tm_GetReloadTime(CTimerManagement *self, CTimer *timer_ptr);
 static void Tm_SetTimerInternal(CTimerManagement *self,
                                 CTimer *timer_ptr,
                                 Tm_Handler_t handler_fptr,
                                 void *args_ptr,
-                                uint16_t elapse,
-                                uint16_t period);
+                                Tm_Tick_t elapse,
+                                Tm_Tick_t period,
+                                Tm_Tick_t slack);
+#ifdef TM_FOOTPRINT_TINY
+static void Tm_HandleElapsedTimer(CTimerManagement *self);
+static bool Tm_UpdateTimersAdd(void *c_timer_ptr, void *n_timer_ptr);
+#else
+static uint32_t Tm_GetCurrentTime(CTimerManagement *self);
+static void Tm_WheelInsert(CTimerManagement *self, CTimer *timer_ptr);
+static void Tm_WheelRemove(CTimerManagement *self, CTimer *timer_ptr);
+static void Tm_WheelCascade(CTimerManagement *self);
+static bool Tm_WheelProcessSlot(CTimerManagement *self, uint8_t slot);
+static uint32_t Tm_WheelGetNextTick(CTimerManagement *self, uint32_t current_time);
+static bool Tm_WheelGetDeadline(CTimerManagement *self, uint32_t *deadline_ptr);
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CTimerManagement                                                       */
@@ -77,8 +92,24 @@ static void Tm_SetTimerInternal(CTimerManagement *self,
  */
 void Tm_Ctor(CTimerManagement *self, CScheduler *scd, const Tm_InitData_t *init_ptr, void * ucs_user_ptr)
 {
+#ifndef TM_FOOTPRINT_TINY
+    uint8_t level;
+    uint8_t slot;
+#endif
+
     MISC_MEM_SET(self, 0, sizeof(*self));
     self->ucs_user_ptr = ucs_user_ptr;
+#ifndef TM_FOOTPRINT_TINY
+    /* Initialize the slots of the timer wheel */
+    for(level = 0U; level < TM_WHEEL_LEVELS; level++)
+    {
+        for(slot = 0U; slot < TM_WHEEL_SLOTS; slot++)
+        {
+            Dl_Ctor(&self->wheel[level][slot], self->ucs_user_ptr);
+        }
+    }
+    Dl_Ctor(&self->expired_list, self->ucs_user_ptr);
+#endif
     /* Initialize subjects and add observers */
     Ssub_Ctor(&self->get_tick_count_subject, self->ucs_user_ptr);
     (void)Ssub_AddObserver(&self->get_tick_count_subject,
@@ -92,6 +123,7 @@ void Tm_Ctor(CTimerManagement *self, CScheduler *scd, const Tm_InitData_t *init_
     }
     /* Initialize timer management service */
     Srv_Ctor(&self->tm_srv, TM_SRV_PRIO, self, &Tm_Service);
+    SRV_SET_NAME(&self->tm_srv, "TM");
     /* Add timer management service to scheduler */
     (void)Scd_AddService(scd, &self->tm_srv);
 }
@@ -113,6 +145,7 @@ static void Tm_Service(void *self)
     }
 }
 
+#ifdef TM_FOOTPRINT_TINY
 /*! \brief If event TM_EVENT_UPDATE_TIMERS is set this function is called. Handles the update
  *         of the timer list. If a timer has expired the corresponding callback function is
  *         executed. If the expired timer is a periodic timer, the timer will be set again.
@@ -120,48 +153,59 @@ static void Tm_Service(void *self)
  */
 static void Tm_UpdateTimers(CTimerManagement *self)
 {
-    uint16_t current_tick_count;
+    Tm_Tick_t current_tick_count;
     Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
 
     if(self->timer_list.head != NULL)      /* At least one timer is running? */
     {
-        bool continue_loop = true;
+        uint16_t expiry_points = 0U;
+        CDlNode *node = self->timer_list.head;
         /* Calculate time difference between the current and the last TM service run */
-        uint16_t tick_count_diff = (uint16_t)(current_tick_count - self->last_tick_count);
+        Tm_Tick_t tick_count_diff = (Tm_Tick_t)(current_tick_count - self->last_tick_count);
         /* Save current tick count for next service run */
         self->last_tick_count = current_tick_count;
 
-        /* Loop while timer list is not empty */
-        while((self->timer_list.head != NULL) && (continue_loop!= false))
+        /* Apply the time difference to the whole list before any handler is called. Thus, timers
+           which are set within a handler relate to the same tick count as the list. Afterwards,
+           all elapsed timers are placed at the beginning of the list with a delta of zero. */
+        while(node != NULL)
         {
-            /* Is not first timer in list elapsed yet? */
-            if(tick_count_diff <= ((CTimer *)self->timer_list.head->data_ptr)->delta)
-            {
-                /* Update delta of first timer in list */
-                ((CTimer *)self->timer_list.head->data_ptr)->delta -= tick_count_diff;
-                tick_count_diff = 0U;
-            }
-            else    /* At least first timer in list elapsed */
-            {
-                /* Update tick count difference for next timer in list */
-                tick_count_diff -= ((CTimer *)self->timer_list.head->data_ptr)->delta;
-                /* First timer elapsed */
-                ((CTimer *)self->timer_list.head->data_ptr)->delta = 0U;
-            }
+            CTimer *timer_ptr = (CTimer *)node->data_ptr;
 
-            /* First timer in list elapsed? */
-            if(0U == ((CTimer *)self->timer_list.head->data_ptr)->delta)
+            /* Is timer not elapsed yet? */
+            if(tick_count_diff < timer_ptr->delta)
             {
-                /* Handle elapsed timer */
-                continue_loop = Tm_HandleElapsedTimer(self);
+                timer_ptr->delta -= tick_count_diff;
+                break;
             }
-            else    /* No elapsed timer in list. */
+            /* Timers of equal expiry time follow with a delta of zero */
+            if((expiry_points == 0U) || (timer_ptr->delta > 0U))
             {
-                /* First timer in list updated! Set trigger to inform application (see 
-                   Tm_CheckForNextService()) and stop TM service. */
-                self->set_service_timer = true;
-                continue_loop = false;
+                expiry_points++;
             }
+            /* Update tick count difference for next timer in list */
+            tick_count_diff -= timer_ptr->delta;
+            timer_ptr->delta = 0U;
+            timer_ptr->late = tick_count_diff;
+            node = node->next;
+        }
+
+        /* Handle elapsed timers */
+        while((self->timer_list.head != NULL) && 
+              (((CTimer *)self->timer_list.head->data_ptr)->delta == 0U))
+        {
+            Tm_HandleElapsedTimer(self);
+        }
+
+        if(self->timer_list.head != NULL)
+        {
+            /* First timer in list updated! Set trigger to inform application (see 
+               Tm_CheckForNextService()). */
+            self->set_service_timer = true;
+        }
+        if(expiry_points > 1U)
+        {
+            self->saved_wakeups += (uint32_t)expiry_points - 1U;
         }
     }
 }
@@ -169,13 +213,9 @@ static void Tm_UpdateTimers(CTimerManagement *self)
 /*! \brief  This function is called if the first timer in list is elapsed. The timer handler 
  *          callback function is invoked. If the timer is a periodic timer it is wound up again.
  *  \param  self    Instance pointer
- *  \return \c true if the next timer must be check.
- *  \return \c false if the wound up timer (periodic timer) is new head of timer list
  */
-static bool Tm_HandleElapsedTimer(CTimerManagement *self)
+static void Tm_HandleElapsedTimer(CTimerManagement *self)
 {
-    bool ret_val = true;
-
     CDlNode *node = self->timer_list.head;
     /* Reset flag to be able to check if timer object has changed within handler 
         callback function */
@@ -198,22 +238,407 @@ static bool Tm_HandleElapsedTimer(CTimerManagement *self)
                                 ((CTimer *)node->data_ptr),
                                 ((CTimer *)node->data_ptr)->handler_fptr,
                                 ((CTimer *)node->data_ptr)->args_ptr,
+                                Tm_GetReloadTime(self, (CTimer *)node->data_ptr),
                                 ((CTimer *)node->data_ptr)->period,
-                                ((CTimer *)node->data_ptr)->period);
+                                ((CTimer *)node->data_ptr)->slack);
+        }
+    }
+}
+
+/*! \brief  Checks if at least one timer is running.
+ *  \param  self    Instance pointer
+ *  \return \c true if at least one timer is running, otherwise \c false.
+ */
+static bool Tm_IsAnyTimerRunning(CTimerManagement *self)
+{
+    return (self->timer_list.head != NULL);
+}
+
+/*! \brief  Calculates the latest time period until the next TM service run which meets the slack
+ *          of all timers. All timers whose expiry time lies before this deadline are handled 
+ *          within the same TM service run. The list is only processed up to the deadline.
+ *  \param  self            Instance pointer
+ *  \param  new_time_ptr    Reference to the returned time period
+ *  \return \c true if a timer is running and \c new_time_ptr is valid, otherwise \c false.
+ */
+static bool Tm_GetNextTimeout(CTimerManagement *self, Tm_Tick_t *new_time_ptr)
+{
+    bool ret_val = false;
+    Tm_Tick_t current_tick_count;
+    Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
 
-            if(node == self->timer_list.head)  /* Is current timer new head of list? */
+    if(self->timer_list.head != NULL)
+    {
+        Tm_Tick_t diff = (Tm_Tick_t)(current_tick_count - self->last_tick_count);
+        uint32_t expiry = 0U;
+        uint32_t deadline = 0xFFFFFFFFU;
+        CDlNode *node = self->timer_list.head;
+
+        /* Expiry times and deadline are related to the last TM service run */
+        while((node != NULL) && (expiry <= deadline))
+        {
+            expiry += ((CTimer *)node->data_ptr)->delta;
+            if((expiry + ((CTimer *)node->data_ptr)->slack) < deadline)
             {
-                /* Set trigger to inform application (see Tm_CheckForNextService()) and
-                   stop TM service. */
-                self->set_service_timer = true;
-                ret_val = false;
+                deadline = expiry + ((CTimer *)node->data_ptr)->slack;
             }
+            node = node->next;
+        }
+
+        /* Deadline passed since last TM service? */
+        if(diff >= deadline)
+        {
+            *new_time_ptr = 1U;  /* Return minimum value */
+        }
+        else if((deadline - diff) > (uint32_t)TM_TICK_MAX)
+        {
+            *new_time_ptr = TM_TICK_MAX;
         }
+        else
+        {
+            /* Calculate new timeout */
+            *new_time_ptr = (Tm_Tick_t)(deadline - diff);
+        }
+        ret_val = true;
     }
 
     return ret_val;
 }
 
+#else
+/*! \brief If event TM_EVENT_UPDATE_TIMERS is set this function is called. Advances the timer 
+ *         wheel up to the current time. All timers of an elapsed slot are handled in one batch.
+ *         Ticks without any timer in the lower levels are skipped.
+ *  \param self    Instance pointer
+ */
+static void Tm_UpdateTimers(CTimerManagement *self)
+{
+    uint32_t current_time = Tm_GetCurrentTime(self);
+    uint16_t expiry_points = 0U;
+
+    while((self->timer_cnt > 0U) && ((int32_t)(current_time - self->wheel_time) >= 0))
+    {
+        uint32_t processed_tick = self->wheel_time;
+
+        Tm_WheelCascade(self);
+        if(Tm_WheelProcessSlot(self, (uint8_t)(processed_tick & (TM_WHEEL_SLOTS - 1U))) != false)
+        {
+            expiry_points++;
+        }
+        /* Wheel time is re-synchronized if a timer was added to an empty wheel within a handler */
+        if(self->wheel_time == processed_tick)
+        {
+            self->wheel_time = Tm_WheelGetNextTick(self, current_time);
+        }
+    }
+
+    if(expiry_points > 1U)
+    {
+        self->saved_wakeups += (uint32_t)expiry_points - 1U;
+    }
+    if(self->timer_cnt > 0U)
+    {
+        /* Set trigger to inform application (see Tm_CheckForNextService()) */
+        self->set_service_timer = true;
+    }
+}
+
+/*! \brief  Returns the current time of the timer wheel. The time is accumulated from the 
+ *          differences of the application tick count.
+ *  \param  self    Instance pointer
+ *  \return The current time in ticks of the timer wheel
+ */
+static uint32_t Tm_GetCurrentTime(CTimerManagement *self)
+{
+    Tm_Tick_t current_tick_count;
+    Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
+
+    self->current_time += (Tm_Tick_t)(current_tick_count - self->last_tick_count);
+    self->last_tick_count = current_tick_count;
+
+    return self->current_time;
+}
+
+/*! \brief  Adds a timer to the slot of the timer wheel which matches its expiry time. The level
+ *          is selected by the distance between expiry time and wheel time. A timer which is due
+ *          while the expired timers are handled is added to the list of expired timers. The slot
+ *          of the wheel time is the one currently processed and is not visited again before the
+ *          wheel has turned once.
+ *  \param  self        Instance pointer
+ *  \param  timer_ptr   Reference to the timer object
+ */
+static void Tm_WheelInsert(CTimerManagement *self, CTimer *timer_ptr)
+{
+    if((self->handled_timer_ptr != NULL) && ((int32_t)(timer_ptr->expiry - self->wheel_time) <= 0))
+    {
+        /* Timer is due within a timer handler -> handle it within the same TM service run */
+        timer_ptr->level = (uint8_t)TM_WHEEL_LEVELS;
+        timer_ptr->list_ptr = &self->expired_list;
+        Dl_InsertTail(timer_ptr->list_ptr, &timer_ptr->node);
+    }
+    else
+    {
+        uint32_t slot_time = timer_ptr->expiry;
+        uint32_t delta;
+        uint8_t level = 0U;
+
+        if((int32_t)(timer_ptr->expiry - self->wheel_time) < 0)
+        {
+            slot_time = self->wheel_time;               /* Timer is overdue -> next processed tick */
+        }
+        delta = slot_time - self->wheel_time;
+
+        while((level < (TM_WHEEL_LEVELS - 1U)) &&
+              (delta >= ((uint32_t)1U << (TM_WHEEL_SLOT_BITS * (level + 1U)))))
+        {
+            level++;
+        }
+        if(delta >= ((uint32_t)1U << (TM_WHEEL_SLOT_BITS * TM_WHEEL_LEVELS)))
+        {
+            /* Beyond range of the wheel -> park timer in the last slot, it is cascaded again */
+            slot_time = self->wheel_time + (((uint32_t)1U << (TM_WHEEL_SLOT_BITS * TM_WHEEL_LEVELS)) - 1U);
+        }
+
+        timer_ptr->level = level;
+        timer_ptr->slot = (uint8_t)((slot_time >> (TM_WHEEL_SLOT_BITS * level)) & (TM_WHEEL_SLOTS - 1U));
+        timer_ptr->list_ptr = &self->wheel[level][timer_ptr->slot];
+        Dl_InsertTail(timer_ptr->list_ptr, &timer_ptr->node);
+        self->slot_mask[level] |= ((uint32_t)1U << timer_ptr->slot);
+    }
+    self->timer_cnt++;
+}
+
+/*! \brief  Removes a timer from the timer wheel or from the list of expired timers.
+ *  \param  self        Instance pointer
+ *  \param  timer_ptr   Reference to the timer object
+ */
+static void Tm_WheelRemove(CTimerManagement *self, CTimer *timer_ptr)
+{
+    if((timer_ptr->list_ptr != NULL) && (Dl_Remove(timer_ptr->list_ptr, &timer_ptr->node) == DL_OK))
+    {
+        if((timer_ptr->level < TM_WHEEL_LEVELS) && (Dl_GetSize(timer_ptr->list_ptr) == 0U))
+        {
+            self->slot_mask[timer_ptr->level] &= ~((uint32_t)1U << timer_ptr->slot);
+        }
+        self->timer_cnt--;
+    }
+    timer_ptr->list_ptr = NULL;
+}
+
+/*! \brief  Moves the timers of the slots which start at the current wheel time to the next lower
+ *          level. Higher levels are cascaded first.
+ *  \param  self    Instance pointer
+ */
+static void Tm_WheelCascade(CTimerManagement *self)
+{
+    uint8_t level;
+
+    for(level = (uint8_t)(TM_WHEEL_LEVELS - 1U); level > 0U; level--)
+    {
+        uint32_t granularity_mask = ((uint32_t)1U << (TM_WHEEL_SLOT_BITS * level)) - 1U;
+
+        if((self->wheel_time & granularity_mask) == 0U)
+        {
+            uint8_t slot = (uint8_t)((self->wheel_time >> (TM_WHEEL_SLOT_BITS * level)) & (TM_WHEEL_SLOTS - 1U));
+            CDlNode *node = Dl_PopHead(&self->wheel[level][slot]);
+
+            self->slot_mask[level] &= ~((uint32_t)1U << slot);
+            while(node != NULL)
+            {
+                self->timer_cnt--;
+                Tm_WheelInsert(self, (CTimer *)node->data_ptr);
+                node = Dl_PopHead(&self->wheel[level][slot]);
+            }
+        }
+    }
+}
+
+/*! \brief  Handles all timers of the given slot of the first level. The timers are moved to the 
+ *          list of expired timers before the timer handlers are invoked. Thus, timers which are 
+ *          wound up again within a handler are not handled twice.
+ *  \param  self    Instance pointer
+ *  \param  slot    Slot index of the first level
+ *  \return \c true if at least one timer has been handled, otherwise \c false.
+ */
+static bool Tm_WheelProcessSlot(CTimerManagement *self, uint8_t slot)
+{
+    bool ret_val = false;
+
+    if((self->slot_mask[0] & ((uint32_t)1U << slot)) != 0U)
+    {
+        CDlNode *node;
+
+        ret_val = true;
+
+        self->slot_mask[0] &= ~((uint32_t)1U << slot);
+        Dl_AppendList(&self->expired_list, &self->wheel[0][slot]);
+        for(node = self->expired_list.head; node != NULL; node = node->next)
+        {
+            ((CTimer *)node->data_ptr)->list_ptr = &self->expired_list;
+            ((CTimer *)node->data_ptr)->level = (uint8_t)TM_WHEEL_LEVELS;
+        }
+
+        node = Dl_PopHead(&self->expired_list);
+        while(node != NULL)
+        {
+            CTimer *timer_ptr = (CTimer *)node->data_ptr;
+
+            timer_ptr->list_ptr = NULL;
+            self->timer_cnt--;
+            /* Reset flag to be able to check if timer object has changed within handler 
+               callback function */
+            timer_ptr->changed = false;
+            /* Call timer handler callback function */
+            self->handled_timer_ptr = timer_ptr;
+            timer_ptr->handler_fptr(timer_ptr->args_ptr);
+            self->handled_timer_ptr = NULL;
+
+            /* Timer object hasn't changed within handler callback function? */
+            if(false == timer_ptr->changed)
+            {
+                /* Mark timer as unused */
+                timer_ptr->in_use = false;
+                /* Is current timer a periodic timer? */
+                if(timer_ptr->period > 0U)
+                {
+                    /* Reload current timer */
+                    Tm_SetTimerInternal(self,
+                                        timer_ptr,
+                                        timer_ptr->handler_fptr,
+                                        timer_ptr->args_ptr,
+                                        Tm_GetReloadTime(self, timer_ptr),
+                                        timer_ptr->period,
+                                        timer_ptr->slack);
+                }
+            }
+            node = Dl_PopHead(&self->expired_list);
+        }
+    }
+
+    return ret_val;
+}
+
+/*! \brief  Calculates the next tick of the timer wheel which has to be processed. If the lower 
+ *          levels are empty the ticks up to the next cascade of the lowest occupied level are 
+ *          skipped. The result never exceeds the tick following the current time.
+ *  \param  self            Instance pointer
+ *  \param  current_time    Current time of the timer wheel
+ *  \return Next tick which has to be processed
+ */
+static uint32_t Tm_WheelGetNextTick(CTimerManagement *self, uint32_t current_time)
+{
+    uint32_t next_tick = self->wheel_time + 1U;
+    uint8_t level = 0U;
+
+    while((level < (TM_WHEEL_LEVELS - 1U)) && (self->slot_mask[level] == 0U))
+    {
+        level++;
+    }
+    if(level > 0U)
+    {
+        next_tick = (self->wheel_time | (((uint32_t)1U << (TM_WHEEL_SLOT_BITS * level)) - 1U)) + 1U;
+    }
+    if((int32_t)(next_tick - (current_time + 1U)) > 0)
+    {
+        next_tick = current_time + 1U;
+    }
+
+    return next_tick;
+}
+
+/*! \brief  Calculates the latest time of the next TM service run which meets the slack of all 
+ *          running timers. The slots of one level are arranged in time order beginning with the 
+ *          slot of the current wheel time. Thus, only slots which start before the deadline found 
+ *          so far need to be inspected.
+ *  \param  self            Instance pointer
+ *  \param  deadline_ptr    Reference to the returned deadline
+ *  \return \c true if a timer is running and \c deadline_ptr is valid, otherwise \c false.
+ */
+static bool Tm_WheelGetDeadline(CTimerManagement *self, uint32_t *deadline_ptr)
+{
+    bool ret_val = false;
+    uint8_t level;
+
+    for(level = 0U; level < TM_WHEEL_LEVELS; level++)
+    {
+        if(self->slot_mask[level] != 0U)
+        {
+            uint8_t shift = (uint8_t)(TM_WHEEL_SLOT_BITS * level);
+            uint8_t slot = (uint8_t)((self->wheel_time >> shift) & (TM_WHEEL_SLOTS - 1U));
+            uint32_t slot_time = (self->wheel_time >> shift) << shift;
+            uint8_t i;
+
+            for(i = 0U; i < TM_WHEEL_SLOTS; i++)
+            {
+                if((ret_val != false) && ((int32_t)(slot_time - *deadline_ptr) > 0))
+                {
+                    break;          /* Remaining slots start after the deadline */
+                }
+                if((self->slot_mask[level] & ((uint32_t)1U << slot)) != 0U)
+                {
+                    CDlNode *node;
+
+                    for(node = self->wheel[level][slot].head; node != NULL; node = node->next)
+                    {
+                        uint32_t deadline = ((CTimer *)node->data_ptr)->expiry + ((CTimer *)node->data_ptr)->slack;
+
+                        if((ret_val == false) || ((int32_t)(deadline - *deadline_ptr) < 0))
+                        {
+                            *deadline_ptr = deadline;
+                            ret_val = true;
+                        }
+                    }
+                }
+                slot = (uint8_t)((slot + 1U) & (TM_WHEEL_SLOTS - 1U));
+                slot_time += (uint32_t)1U << shift;
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+/*! \brief  Checks if at least one timer is running.
+ *  \param  self    Instance pointer
+ *  \return \c true if at least one timer is running, otherwise \c false.
+ */
+static bool Tm_IsAnyTimerRunning(CTimerManagement *self)
+{
+    return (self->timer_cnt > 0U);
+}
+
+/*! \brief  Calculates the latest time period until the next TM service run which meets the slack
+ *          of all timers.
+ *  \param  self            Instance pointer
+ *  \param  new_time_ptr    Reference to the returned time period
+ *  \return \c true if a timer is running and \c new_time_ptr is valid, otherwise \c false.
+ */
+static bool Tm_GetNextTimeout(CTimerManagement *self, Tm_Tick_t *new_time_ptr)
+{
+    uint32_t deadline = 0U;
+    uint32_t current_time = Tm_GetCurrentTime(self);
+    bool ret_val = Tm_WheelGetDeadline(self, &deadline);
+
+    if(ret_val != false)
+    {
+        if((int32_t)(deadline - current_time) <= 0)
+        {
+            *new_time_ptr = 1U;         /* Return minimum value */
+        }
+        else if((deadline - current_time) > (uint32_t)TM_TICK_MAX)
+        {
+            *new_time_ptr = TM_TICK_MAX;
+        }
+        else
+        {
+            *new_time_ptr = (Tm_Tick_t)(deadline - current_time);
+        }
+    }
+
+    return ret_val;
+}
+#endif
+
 /*! \brief Calls an application callback function to inform the application that the UCS must be 
  *         serviced not later than the passed time period. If the timer list is empty a possible
  *         running application timer will be stopped. This function is called at the end of
@@ -224,26 +649,13 @@ void Tm_CheckForNextService(CTimerManagement *self)
 {
     if(self->delayed_tm_service_enabled != false)
     {
-        uint16_t current_tick_count;
-        Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
         /* Has head of timer list changed? */
         if(self->set_service_timer != false)
         {
-            uint16_t new_time;
-            uint16_t diff = current_tick_count - self->last_tick_count;
+            Tm_Tick_t new_time;
             self->set_service_timer = false;
-            if (self->timer_list.head != NULL)
+            if(Tm_GetNextTimeout(self, &new_time) != false)
             {
-                /* Timer expired since last TM service? */
-                if(diff >= ((CTimer *)self->timer_list.head->data_ptr)->delta)
-                {
-                    new_time = 1U;  /* Return minimum value */
-                }
-                else
-                {
-                    /* Calculate new timeout */
-                    new_time = (uint16_t)(((CTimer *)self->timer_list.head->data_ptr)->delta - diff);
-                }
                 /* Inform the application that the UCS must be serviced not later than the passed
                    time period. */
                 Ssub_Notify(&self->set_application_timer_subject, &new_time, false);
@@ -263,7 +675,7 @@ void Tm_CheckForNextService(CTimerManagement *self)
  */
 void Tm_TriggerService(CTimerManagement *self)
 {
-    if(self->timer_list.head != NULL)      /* At least one timer is running? */
+    if(Tm_IsAnyTimerRunning(self) != false)      /* At least one timer is running? */
     {
         Srv_SetEvent(&self->tm_srv, TM_EVENT_UPDATE_TIMERS);
     }
@@ -274,7 +686,11 @@ void Tm_TriggerService(CTimerManagement *self)
  */
 void Tm_StopService(CTimerManagement *self)
 {
-    uint16_t new_time = 0U;
+    Tm_Tick_t new_time = 0U;
+#ifndef TM_FOOTPRINT_TINY
+    uint8_t level;
+    uint8_t slot;
+#endif
 
     /* Clear probable running application timer */
     Ssub_Notify(&self->set_application_timer_subject, &new_time, false);
@@ -282,8 +698,100 @@ void Tm_StopService(CTimerManagement *self)
     /* Reset the service timer. Not necessary ?  */
     self->set_service_timer = false;
 
-    /* Clear the timer head queue to prevent any event to be set */
-    self->timer_list.head = NULL;
+#ifdef TM_FOOTPRINT_TINY
+    /* Release all timers of the list to prevent any event to be set */
+    Tm_ReleaseTimers(&self->timer_list);
+#else
+    /* Release all timers of the wheel to prevent any event to be set */
+    for(level = 0U; level < TM_WHEEL_LEVELS; level++)
+    {
+        for(slot = 0U; slot < TM_WHEEL_SLOTS; slot++)
+        {
+            Tm_ReleaseTimers(&self->wheel[level][slot]);
+        }
+        self->slot_mask[level] = 0U;
+    }
+    Tm_ReleaseTimers(&self->expired_list);
+    if(self->handled_timer_ptr != NULL)
+    {
+        /* Timer service is stopped within a timer handler -> do not reload the timer */
+        self->handled_timer_ptr->in_use = false;
+        self->handled_timer_ptr->changed = true;
+    }
+    self->timer_cnt = 0U;
+#endif
+}
+
+/*! \brief  Calculates the elapse time which reloads a periodic timer at its next nominal expiry
+ *          time. The nominal expiry times follow each other in steps of the period, independent
+ *          of the delay of the actual expiry. Thus, the delay tolerated by the slack does not
+ *          accumulate. Expiries which have been missed completely are skipped.
+ *  \param  self        Instance pointer
+ *  \param  timer_ptr   Reference to the expired periodic timer
+ *  \return The elapse time until the next nominal expiry time, in milliseconds
+ */
+static Tm_Tick_t Tm_GetReloadTime(CTimerManagement *self, CTimer *timer_ptr)
+{
+    uint32_t late;
+#ifdef TM_FOOTPRINT_TINY
+    Tm_Tick_t current_tick_count;
+    Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
+
+    /* Delay at the last TM service run plus the time spent since then */
+    late = (uint32_t)timer_ptr->late + (uint32_t)(Tm_Tick_t)(current_tick_count - self->last_tick_count);
+#else
+    uint32_t current_time = Tm_GetCurrentTime(self);
+
+    late = 0U;
+    if((int32_t)(current_time - timer_ptr->expiry) > 0)
+    {
+        late = current_time - timer_ptr->expiry;
+    }
+#endif
+
+    return (Tm_Tick_t)((uint32_t)timer_ptr->period - (late % (uint32_t)timer_ptr->period));
+}
+
+/*! \brief  Removes all timers from the given list and marks them as unused. A timer which is
+ *          released within its own handler callback function is not handled again afterwards.
+ *  \param  list_ptr    Reference to the timer list
+ */
+static void Tm_ReleaseTimers(CDlList *list_ptr)
+{
+    CDlNode *node = Dl_PopHead(list_ptr);
+
+    while(node != NULL)
+    {
+        CTimer *timer_ptr = (CTimer *)node->data_ptr;
+#ifndef TM_FOOTPRINT_TINY
+        timer_ptr->list_ptr = NULL;
+#endif
+        timer_ptr->in_use = false;
+        timer_ptr->changed = true;
+        node = Dl_PopHead(list_ptr);
+    }
+}
+
+/*! \brief  Returns the number of timer expiry points which were handled together with a later 
+ *          expiry point within the same TM service run, i.e. the number of saved service calls.
+ *  \param  self            Instance pointer
+ *  \return Number of saved wakeups
+ */
+uint32_t Tm_GetSavedWakeups(CTimerManagement *self)
+{
+    return self->saved_wakeups;
+}
+
+/*! \brief  Returns the current tick count of the application
+ *  \param  self            Instance pointer
+ *  \return The current tick count
+ */
+Tm_Tick_t Tm_GetTickCount(CTimerManagement *self)
+{
+    Tm_Tick_t current_tick_count;
+    Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
+
+    return current_tick_count;
 }
 
 /*! \brief Creates a new timer. The timer expires at the specified elapse time and then after 
@@ -304,17 +812,47 @@ void Tm_SetTimer(CTimerManagement *self,
                  CTimer *timer_ptr,
                  Tm_Handler_t handler_fptr,
                  void *args_ptr,
-                 uint16_t elapse,
-                 uint16_t period)
+                 Tm_Tick_t elapse,
+                 Tm_Tick_t period)
+{
+    Tm_SetTimerEx(self, timer_ptr, handler_fptr, args_ptr, elapse, period, 0U);
+}
+
+/*! \brief Creates a new timer which tolerates a delayed expiry. The timer expires not before the 
+ *         specified elapse time and not later than elapse time plus slack. Timers with overlapping
+ *         windows are handled within the same TM service run. The application timer is set to the 
+ *         latest time which meets the windows of all timers. A periodic timer is reloaded from
+ *         its nominal expiry time, i.e. the slack is a window per expiry and does not delay the
+ *         following expiries.
+ *  \param self            Instance pointer
+ *  \param timer_ptr       Reference to the timer object
+ *  \param handler_fptr    Callback function which is called when the timer expires
+ *  \param args_ptr        Reference to an optional parameter which is passed to the specified
+ *                         callback function
+ *  \param elapse          The elapse value before the timer expires for the first time, in
+ *                         milliseconds
+ *  \param period          The period of the timer, in milliseconds. If this parameter is zero, the
+ *                         timer is signaled once. If the parameter is greater than zero, the timer
+ *                         is periodic.
+ *  \param slack           The tolerated delay of each expiry, in milliseconds
+ *  \note  Elapse time, period and slack are limited to \ref TM_TIMEOUT_MAX.
+ */
+void Tm_SetTimerEx(CTimerManagement *self,
+                   CTimer *timer_ptr,
+                   Tm_Handler_t handler_fptr,
+                   void *args_ptr,
+                   Tm_Tick_t elapse,
+                   Tm_Tick_t period,
+                   Tm_Tick_t slack)
 {
     (void)Tm_ClearTimer(self, timer_ptr);       /* Clear timer if running */
     /* Call the internal method to set the new timer (-> does not trigger TM service!) */
-    Tm_SetTimerInternal(self, timer_ptr, handler_fptr, args_ptr, elapse, period);
+    Tm_SetTimerInternal(self, timer_ptr, handler_fptr, args_ptr, elapse, period, slack);
     Tm_TriggerService(self);                    /* New timer added -> trigger timer list update */
 }
 
 /*! \brief This function contains the internal part when adding a new timer. The function is
- *         called within Tm_SetTimer() and within Tm_UpdateTimers().
+ *         called within Tm_SetTimerEx() and within Tm_UpdateTimers().
  *  \param self            Instance pointer
  *  \param timer_ptr       Reference to the timer object
  *  \param handler_fptr    Callback function which is called when the timer expires
@@ -325,16 +863,38 @@ void Tm_SetTimer(CTimerManagement *self,
  *  \param period          The period of the timer, in milliseconds. If this parameter is zero, the
  *                         timer is signaled once. If the parameter is greater than zero, the timer
  *                         is periodic.
+ *  \param slack           The tolerated delay of each expiry, in milliseconds
  */
 static void Tm_SetTimerInternal(CTimerManagement *self,
                                 CTimer *timer_ptr,
                                 Tm_Handler_t handler_fptr,
                                 void *args_ptr,
-                                uint16_t elapse,
-                                uint16_t period)
+                                Tm_Tick_t elapse,
+                                Tm_Tick_t period,
+                                Tm_Tick_t slack)
 {
-    uint16_t current_tick_count;
+#ifdef TM_FOOTPRINT_TINY
+    Tm_Tick_t current_tick_count;
     Ssub_Notify(&self->get_tick_count_subject, &current_tick_count, false);
+#else
+    uint32_t current_time = Tm_GetCurrentTime(self);
+#endif
+
+#ifdef UCS_TICK_COUNT_32BIT
+    /* Keep expiry time plus slack within the range of the signed time comparison */
+    if(elapse > TM_TIMEOUT_MAX)
+    {
+        elapse = TM_TIMEOUT_MAX;
+    }
+    if(period > TM_TIMEOUT_MAX)
+    {
+        period = TM_TIMEOUT_MAX;
+    }
+    if(slack > TM_TIMEOUT_MAX)
+    {
+        slack = TM_TIMEOUT_MAX;
+    }
+#endif
 
     /* Save timer specific values */
     timer_ptr->changed = true;                  /* Flag is needed by Tm_UpdateTimers() */
@@ -343,11 +903,17 @@ static void Tm_SetTimerInternal(CTimerManagement *self,
     timer_ptr->args_ptr = args_ptr;
     timer_ptr->elapse = elapse;
     timer_ptr->period = period;
-    timer_ptr->delta = elapse;
+    timer_ptr->slack = slack;
+#ifdef TM_FOOTPRINT_TINY
+    timer_ptr->late = 0U;
+#endif
 
     /* Create back link to be able to point from node to timer object */
     timer_ptr->node.data_ptr = (void *)timer_ptr;
 
+#ifdef TM_FOOTPRINT_TINY
+    timer_ptr->delta = elapse;
+
     if(self->timer_list.head == NULL)            /* Is timer list empty? */
     {
         Dl_InsertHead(&self->timer_list, &timer_ptr->node);    /* Add first timer to list */
@@ -359,7 +925,7 @@ static void Tm_SetTimerInternal(CTimerManagement *self,
         CDlNode *result_ptr = NULL;
 
         /* Set delta value in relation to last saved tick count (last TM service) */
-        timer_ptr->delta += (uint16_t)(current_tick_count - self->last_tick_count);
+        timer_ptr->delta += (Tm_Tick_t)(current_tick_count - self->last_tick_count);
 
         /* Search slot where new timer must be inserted. Update delta of new timer
            and delta of the following timer in the list. */
@@ -376,6 +942,15 @@ static void Tm_SetTimerInternal(CTimerManagement *self,
             Dl_InsertTail(&self->timer_list, &timer_ptr->node);
         }
     }
+#else
+    if(self->timer_cnt == 0U)                   /* Is timer wheel empty? */
+    {
+        /* Synchronize wheel time with current time */
+        self->wheel_time = current_time;
+    }
+    timer_ptr->expiry = current_time + elapse;
+    Tm_WheelInsert(self, timer_ptr);
+#endif
 }
 
 /*! \brief     Removes the specified timer from the timer list.
@@ -390,6 +965,7 @@ void Tm_ClearTimer(CTimerManagement *self, CTimer *timer_ptr)
     {
         timer_ptr->changed = true;          /* Flag is needed by Tm_UpdateTimers() */
 
+#ifdef TM_FOOTPRINT_TINY
         if(timer_ptr->node.next != NULL)     /* Has deleted timer a follower? */
         {
             /* Adjust delta of following timer */
@@ -397,12 +973,16 @@ void Tm_ClearTimer(CTimerManagement *self, CTimer *timer_ptr)
         }
 
         (void)Dl_Remove(&self->timer_list, &timer_ptr->node);
+#else
+        Tm_WheelRemove(self, timer_ptr);
+#endif
         timer_ptr->in_use = false;
 
         Tm_TriggerService(self);            /* Timer removed -> trigger timer list update */
     }
 }
 
+#ifdef TM_FOOTPRINT_TINY
 /*! \brief  Used by Tm_SetTimer() to find the slot where the new timer must be inserted.
  *  \param  c_timer_ptr Reference to current timer processed by foreach loop
  *  \param  n_timer_ptr Reference to new timer
@@ -431,7 +1011,7 @@ static bool Tm_UpdateTimersAdd(void *c_timer_ptr, void *n_timer_ptr)
 
     return ret_val;
 }
-
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Implementation of class CTimer                                                                 */
@@ -110,6 +110,35 @@ void Trcv_RxReleaseMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr)
     }
 }
 
+/*! \brief   Detaches a received message from the flow control of the FIFO
+ *  \details Shall be called if the receiver retains the message for a longer period.
+ *           The message must be released by Trcv_RxReleaseDetachedMsg() afterwards.
+ *  \param   self    The instance
+ *  \param   tel_ptr The received message
+ *  \return  Returns \c true if the message is detached, otherwise \c false if the Rx pool
+ *           does not permit further detached messages. In this case the message must be
+ *           released by Trcv_RxReleaseMsg().
+ */
+bool Trcv_RxDetachMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr)
+{
+    return Fifo_RxDetachMsg(self->fifo_ptr, (CMessage*)(void*)tel_ptr);
+}
+
+/*! \brief   Releases a received message which was detached by Trcv_RxDetachMsg()
+ *  \param   self    The instance
+ *  \param   tel_ptr The received message
+ */
+void Trcv_RxReleaseDetachedMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr)
+{
+    CMessage *msg_ptr = (CMessage*)(void*)tel_ptr;
+    bool check_ok = !Dln_IsNodePartOfAList(Msg_GetNode(msg_ptr));
+    TR_ASSERT(self->ucs_user_ptr, "[TRCV]", check_ok);
+    if (check_ok)
+    {
+        Fifo_RxReleaseDetachedMsg(self->fifo_ptr, msg_ptr);
+    }
+}
+
 /*! \brief  Retrieves a message object from the pool
  *  \param  self    The instance
  *  \param  size    Size of the message in bytes. Valid range: 0..45.
@@ -169,6 +198,17 @@ void Trcv_TxReuseMsg(Msg_MostTel_t *tel_ptr)
     Msg_ReserveHeader(msg_ptr, PMP_PM_MAX_SIZE_HEADER + ENC_MAX_SIZE_CONTENT);
 }
 
+/*! \brief  Assigns the priority class a Tx message is queued with in the FIFO
+ *  \details Messages of a higher priority class overtake waiting messages of a lower
+ *          priority class. The default priority class is MSG_TX_PRIO_NORMAL.
+ *  \param  tel_ptr Reference to the Tx message object
+ *  \param  prio    The transmission priority class
+ */
+void Trcv_TxSetPriority(Msg_MostTel_t *tel_ptr, Msg_TxPrio_t prio)
+{
+    Msg_SetTxPrio((CMessage*)(void*)tel_ptr, prio);
+}
+
 /*! \brief   Transmits a given message object to the INIC
  *  \details After completed transmission the message object is released automatically
  *  \param   self    The instance
@@ -183,7 +223,7 @@ void Trcv_TxSendMsg(CTransceiver *self, Msg_MostTel_t *tel_ptr)
 
     TR_INFO((self->ucs_user_ptr, "[TRCV]", "Trcv_TxSendMsg(): FIFO: %u, MSG(tgt:0x%04X, id:%02X.%01X.%04X.%01X)", 6U, self->own_id, tel_ptr->destination_addr, tel_ptr->id.fblock_id, tel_ptr->id.instance_id, tel_ptr->id.function_id, tel_ptr->id.op_type));
     Msg_SetTxStatusHandler(msg_ptr, &Trcv_OnTxStatusInternal, self);        /* just release the message */
-    Fifo_Tx(self->fifo_ptr, msg_ptr, false);
+    Fifo_Tx(self->fifo_ptr, msg_ptr);
 }
 
 /*! \brief  Transmits a given message object to the INIC with a dedicated result callback 
@@ -215,7 +255,7 @@ void Trcv_TxSendMsgExt(CTransceiver *self, Msg_MostTel_t *tel_ptr, Msg_TxStatusC
 
     TR_INFO((self->ucs_user_ptr, "[TRCV]", "Trcv_TxSendMsgExt(): FIFO: %u, MSG(tgt:0x%04X, id:%02X.%01X.%04X.%01X)", 6U, self->own_id, tel_ptr->destination_addr, tel_ptr->id.fblock_id, tel_ptr->id.instance_id, tel_ptr->id.function_id, tel_ptr->id.op_type));
     Msg_SetTxStatusHandler(msg_ptr, callback_fptr, inst_ptr);
-    Fifo_Tx(self->fifo_ptr, msg_ptr, false);
+    Fifo_Tx(self->fifo_ptr, msg_ptr);
 }
 
 /*! \brief  Transmits a given message object to the INIC bypassing all other messages in the FIFO
@@ -245,7 +285,8 @@ void Trcv_TxSendMsgBypass(CTransceiver *self, Msg_MostTel_t *tel_ptr, Msg_TxStat
     }
 
     Msg_SetTxStatusHandler(msg_ptr, callback_fptr, inst_ptr);
-    Fifo_Tx(self->fifo_ptr, msg_ptr, true);
+    Msg_SetTxPrio(msg_ptr, MSG_TX_PRIO_BYPASS);
+    Fifo_Tx(self->fifo_ptr, msg_ptr);
 }
 
 /*! \brief  Callback function which is invoked instead of an external callback 
@@ -140,6 +140,7 @@ void Xrm_Ctor(CExtendedResourceManager *self, Xrm_InitData_t *data_ptr)
 
     /* Initialize XRM service */
     Srv_Ctor(&self->xrm_srv, XRM_SRV_PRIO, self, &Xrm_Service);
+    SRV_SET_NAME(&self->xrm_srv, "XRM");
     /* Add XRM service to scheduler */
     (void)Scd_AddService(&self->base_ptr->scd, &self->xrm_srv);
 }
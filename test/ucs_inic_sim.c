@@ -0,0 +1,1311 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Implementation of a simulated INIC which is connected to UNICENS as low-level driver
+ * \details The simulation answers the port message protocol of every FIFO. It grants a fixed 
+ *          number of credits on synchronization and acknowledges all data messages received in 
+ *          one service pass by a single flow status. Data messages to UNICENS are passed in the 
+ *          order of their generation, one per service pass, as long as the credits granted by 
+ *          UNICENS permit. If the credits are exhausted, the simulation requests a status by a 
+ *          command message.
+ *          The INIC FBlock answers DeviceVersion, DeviceStatus, DeviceAttach, MOSTNetworkStatus 
+ *          and MOSTNetworkConfiguration. Any other request is answered with an error.
+ *          Remote control messages are delivered to the simulated nodes. Each node answers
+ *          Hello.Get, Welcome.StartResult and Signature.Get of the ExtendedNetworkControl FBlock
+ *          and is reset by DeviceInit.Start. Resource and route building is not simulated,
+ *          thus any other request to a node is answered with an error.
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include "ucs_inic_sim.h"
+#include "ucs_inic.h"
+#include "ucs_exc.h"
+#include "ucs_message.h"
+#include "ucs_encoder.h"
+#include "ucs_misc.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Constants                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+#define ISIM_IDX_FPH            3U      /*!< \brief Index of the FIFO protocol header */
+#define ISIM_FPH_DIR_RX         0x01U   /*!< \brief Direction flag of messages sent by the INIC */
+#define ISIM_PMHL_CTRL          3U      /*!< \brief Port message header length of status and command messages */
+#define ISIM_PMHL_DATA          5U      /*!< \brief Port message header length of data messages */
+#define ISIM_TX_CREDITS         8U      /*!< \brief Credits granted to UNICENS on synchronization */
+#define ISIM_MAX_PASSES         1000U   /*!< \brief Maximum number of service passes per millisecond */
+#define ISIM_ERR_FKT_ID         0x03U   /*!< \brief Error code "FktID not available" */
+#define ISIM_ERR_OP_TYPE        0x04U   /*!< \brief Error code "OPType not available" */
+#define ISIM_NW_STATUS_SIZE     11U     /*!< \brief Size of INIC.MOSTNetworkStatus.Status */
+#define ISIM_NW_CONFIG_SIZE     5U      /*!< \brief Size of INIC.MOSTNetworkConfiguration.Status */
+#define ISIM_GROUP_ADDRESS      0x03C8U /*!< \brief Group address reported by the INIC */
+#define ISIM_PACKET_BW          52U     /*!< \brief Packet bandwidth reported by the INIC */
+#define ISIM_LLRBC              10U     /*!< \brief Low-level retry block count reported by the INIC */
+#define ISIM_POS_ADDR_LOCAL     0x0400U /*!< \brief Node position address of the local INIC */
+#define ISIM_MAC_47_32          0x0200U /*!< \brief Upper word of the MAC addresses, locally administered */
+#define ISIM_NUM_PORTS          1U      /*!< \brief Number of ports reported by the nodes */
+#define ISIM_CHIP_ID            0x18U   /*!< \brief Chip id reported by the nodes */
+#define ISIM_SIGNATURE_VERSION  1U      /*!< \brief Version of the signature reported by the nodes */
+#define ISIM_SIGNATURE_SIZE     26U     /*!< \brief Size of the signature v1 in bytes */
+#define ISIM_WELCOME_FAILED     1U      /*!< \brief Welcome.Result reports that the signature does not match */
+
+/*! \brief Payload of INIC.DeviceVersion.Status */
+static uint8_t ISIM_DEVICE_VERSION[18] =
+{
+    0x00U, 0x00U, 0x00U, 0x81U,         /* ProductIdentifier */
+    0x02U, 0x04U, 0x00U,                /* Major, minor and release version */
+    0x00U, 0x00U, 0x00U, 0x01U,         /* BuildVersion */
+    0x01U,                              /* HardwareRevision */
+    0x00U, 0x01U,                       /* DiagnosisID */
+    0x01U,                              /* ExtIdentifier "CFGS" */
+    0x02U, 0x04U, 0x00U                 /* Configuration string version */
+};
+
+/*! \brief Payload of INIC.DeviceStatus.Status */
+static uint8_t ISIM_DEVICE_STATUS[5] =
+{
+    (uint8_t)INIC_ATS_ATTACHED,         /* ConfigInterfaceState */
+    (uint8_t)INIC_ATS_ATTACHED,         /* AppInterfaceState */
+    (uint8_t)UCS_INIC_PWS_U_NORMAL,     /* PowerState */
+    (uint8_t)INIC_BIST_OK,              /* BIST */
+    (uint8_t)UCS_INIC_RST_STARTUP       /* LastResetReason */
+};
+
+/*------------------------------------------------------------------------------------------------*/
+/* Internal prototypes                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+static void Isim_OnError(Ucs_Error_t error_code, void *user_ptr);
+static Ucs_TickCount_t Isim_OnGetTickCount(void *user_ptr);
+static void Isim_OnSetAppTimer(Ucs_TickCount_t timeout, void *user_ptr);
+static void Isim_OnRequestService(void *user_ptr);
+static void Isim_OnLldStart(Ucs_Lld_Api_t *api_ptr, void *inst_ptr, void *lld_user_ptr);
+static void Isim_OnLldStop(void *lld_user_ptr);
+static void Isim_OnLldRxAvailable(void *lld_user_ptr);
+static void Isim_OnLldTransmit(Ucs_Lld_TxMsg_t *msg_ptr, void *lld_user_ptr);
+
+static void Isim_Reset(CInicSim *self);
+static bool Isim_Service(CInicSim *self);
+
+static void Isim_TxProcessMsg(CInicSim *self, Ucs_Lld_TxMsg_t *msg_ptr);
+static void Isim_TxProcessCommand(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[]);
+static void Isim_TxProcessStatus(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[]);
+static void Isim_TxProcessData(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[], uint8_t size);
+static void Isim_IcmOnRequest(CInicSim *self, Msg_MostTel_t *tel_ptr);
+static void Isim_IcmRespond(CInicSim *self, Msg_MostTel_t *tel_ptr, uint16_t function_id, Ucs_OpType_t op_type, 
+                            uint8_t data[], uint8_t size);
+static void Isim_McmOnMessage(CInicSim *self, Msg_MostTel_t *tel_ptr);
+static void Isim_RcmOnMessage(CInicSim *self, Msg_MostTel_t *tel_ptr);
+static bool Isim_IsNodeAddressed(Isim_Node_t *node_ptr, uint16_t address);
+static void Isim_ExcOnRequest(CInicSim *self, Isim_Node_t *node_ptr, Msg_MostTel_t *tel_ptr);
+static void Isim_RcmRespond(CInicSim *self, Isim_Node_t *node_ptr, Msg_MostTel_t *tel_ptr, uint16_t function_id,
+                            Ucs_OpType_t op_type, uint8_t data[], uint8_t size);
+static void Isim_Respond(CInicSim *self, Pmp_FifoId_t fifo_id, uint16_t source_addr, Msg_MostTel_t *tel_ptr,
+                         uint16_t function_id, Ucs_OpType_t op_type, uint8_t data[], uint8_t size);
+static void Isim_EncodeSignature(const Ucs_Signature_t *signature_ptr, uint8_t data[]);
+
+static bool Isim_RxService(CInicSim *self);
+static bool Isim_RxPass(CInicSim *self, Isim_PortMsg_t *pm_ptr);
+static void Isim_RxQueueCtrl(CInicSim *self, Pmp_FifoId_t fifo_id, Pmp_MsgType_t msg_type, uint8_t sid, 
+                             uint8_t ext_type, uint8_t ext_code, uint8_t data[], uint8_t size);
+static void Isim_RxQueueData(CInicSim *self, Pmp_FifoId_t fifo_id, Msg_MostTel_t *tel_ptr);
+static void Isim_SetHeader(uint8_t pm[], Pmp_FifoId_t fifo_id, Pmp_MsgType_t msg_type, uint8_t pmhl, uint8_t size);
+
+static void Isim_QueueCtor(Isim_Queue_t *self, Isim_PortMsg_t msgs[], uint8_t size);
+static Isim_PortMsg_t* Isim_QueuePush(Isim_Queue_t *self);
+static Isim_PortMsg_t* Isim_QueuePeek(Isim_Queue_t *self);
+static void Isim_QueuePop(Isim_Queue_t *self);
+
+/*------------------------------------------------------------------------------------------------*/
+/* Implementation                                                                                 */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Constructor of the simulated INIC
+ *  \details The local INIC is the first simulated node at node position address 0x0400.
+ *  \param  self            The instance
+ *  \param  node_address    Node address which is reported by the INIC
+ */
+void Isim_Ctor(CInicSim *self, uint16_t node_address)
+{
+    MISC_MEM_SET(self, 0, sizeof(*self));
+    self->node_address = node_address;
+    (void)Isim_AddNode(self, node_address);
+    Isim_Reset(self);
+}
+
+/*! \brief  Assigns the general and the low-level driver callbacks to the initialization data
+ *  \details The function shall be called after Ucs_SetDefaultConfig(). The simulation is used 
+ *           as \c user_ptr of the general callbacks and as \c lld_user_ptr.
+ *  \param  self        The instance
+ *  \param  init_ptr    Reference to the initialization data of UNICENS
+ */
+void Isim_SetupInitData(CInicSim *self, Ucs_InitData_t *init_ptr)
+{
+    init_ptr->user_ptr = self;
+    init_ptr->general.error_fptr = &Isim_OnError;
+    init_ptr->general.get_tick_count_fptr = &Isim_OnGetTickCount;
+    init_ptr->general.set_application_timer_fptr = &Isim_OnSetAppTimer;
+    init_ptr->general.request_service_fptr = &Isim_OnRequestService;
+
+    init_ptr->lld.lld_user_ptr = self;
+    init_ptr->lld.start_fptr = &Isim_OnLldStart;
+    init_ptr->lld.stop_fptr = &Isim_OnLldStop;
+    init_ptr->lld.rx_available_fptr = &Isim_OnLldRxAvailable;
+    init_ptr->lld.tx_transmit_fptr = &Isim_OnLldTransmit;
+}
+
+/*! \brief  Adds a remote node behind the last simulated node
+ *  \details The node position address and a unique MAC address are derived from the position
+ *           of the node. The firmware and configuration string versions are the ones of the
+ *           local INIC.
+ *  \param  self            The instance
+ *  \param  node_address    Node address which is reported in the signature of the node
+ *  \return Returns \c true if the node was added, or \c false if \ref ISIM_MAX_NODES nodes
+ *          are already simulated.
+ */
+bool Isim_AddNode(CInicSim *self, uint16_t node_address)
+{
+    bool ret = false;
+
+    if (self->num_nodes < ISIM_MAX_NODES)
+    {
+        Ucs_Signature_t *sig_ptr = &self->nodes[self->num_nodes].signature;
+
+        MISC_MEM_SET(&self->nodes[self->num_nodes], 0, sizeof(Isim_Node_t));
+        sig_ptr->node_address = node_address;
+        sig_ptr->group_address = ISIM_GROUP_ADDRESS;
+        sig_ptr->mac_47_32 = ISIM_MAC_47_32;
+        sig_ptr->mac_31_16 = 0x0000U;
+        sig_ptr->mac_15_0 = (uint16_t)self->num_nodes + 1U;
+        sig_ptr->node_pos_addr = ISIM_POS_ADDR_LOCAL + (uint16_t)self->num_nodes;
+        sig_ptr->diagnosis_id = (uint16_t)self->num_nodes + 1U;
+        sig_ptr->num_ports = ISIM_NUM_PORTS;
+        sig_ptr->chip_id = ISIM_CHIP_ID;
+        sig_ptr->fw_major = ISIM_DEVICE_VERSION[4];
+        sig_ptr->fw_minor = ISIM_DEVICE_VERSION[5];
+        sig_ptr->fw_release = ISIM_DEVICE_VERSION[6];
+        sig_ptr->fw_build = ((uint32_t)ISIM_DEVICE_VERSION[9] << 8) | (uint32_t)ISIM_DEVICE_VERSION[10];
+        sig_ptr->cs_major = ISIM_DEVICE_VERSION[15];
+        sig_ptr->cs_minor = ISIM_DEVICE_VERSION[16];
+        sig_ptr->cs_release = ISIM_DEVICE_VERSION[17];
+        self->num_nodes++;
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*! \brief  Runs UNICENS and the simulated INIC on the virtual clock
+ *  \details Within each millisecond UNICENS and the INIC are serviced until both are idle. 
+ *           Afterwards the virtual clock is advanced and an expired application timer is 
+ *           reported by Ucs_ReportTimeout().
+ *  \param  self        The instance
+ *  \param  ucs_ptr     The UNICENS instance
+ *  \param  duration    Maximum time to run in milliseconds
+ *  \param  done_ptr    Optional reference to a flag which stops the simulation if it is set 
+ *                      by a callback function. Set to \c NULL to run for the whole \c duration.
+ *  \return Returns \c true if the simulation was stopped by \c done_ptr, otherwise \c false.
+ */
+bool Isim_Run(CInicSim *self, Ucs_Inst_t *ucs_ptr, uint32_t duration, const bool *done_ptr)
+{
+    uint32_t end_time = self->now + duration;
+    bool done = false;
+
+    while ((done == false) && (self->now != end_time))
+    {
+        bool busy = true;
+        uint16_t passes = 0U;
+
+        while ((busy != false) && (passes < ISIM_MAX_PASSES))
+        {
+            busy = Isim_Service(self);
+
+            if (self->service_request != false)
+            {
+                self->service_request = false;
+                self->stats.ucs_services++;
+                Ucs_Service(ucs_ptr);
+                busy = true;
+            }
+            passes++;
+        }
+
+        if ((done_ptr != NULL) && (*done_ptr != false))
+        {
+            done = true;
+        }
+        else
+        {
+            self->now++;
+
+            if ((self->timer_active != false) && (self->now == self->timer_due))
+            {
+                self->timer_active = false;
+                Ucs_ReportTimeout(ucs_ptr);
+            }
+        }
+    }
+
+    return done;
+}
+
+/*! \brief  Retrieves the virtual time
+ *  \param  self    The instance
+ *  \return The virtual time in milliseconds
+ */
+uint32_t Isim_GetTime(CInicSim *self)
+{
+    return self->now;
+}
+
+/*! \brief  Checks if UNICENS has started the low-level driver
+ *  \param  self    The instance
+ *  \return Returns \c true if the low-level driver is started, otherwise \c false.
+ */
+bool Isim_IsStarted(CInicSim *self)
+{
+    return self->started;
+}
+
+/*! \brief  Checks if a FIFO is synchronized
+ *  \param  self    The instance
+ *  \param  fifo_id The FIFO
+ *  \return Returns \c true if the FIFO is synchronized, otherwise \c false.
+ */
+bool Isim_IsFifoSynced(CInicSim *self, Pmp_FifoId_t fifo_id)
+{
+    return self->fifos[fifo_id].synced;
+}
+
+/*! \brief  Checks if a simulated node was welcomed by the Node Discovery service
+ *  \param  self    The instance
+ *  \param  index   Index of the node, the local INIC has index 0
+ *  \return Returns \c true if the node was welcomed, otherwise \c false.
+ */
+bool Isim_IsNodeWelcomed(CInicSim *self, uint8_t index)
+{
+    bool ret = false;
+
+    if (index < self->num_nodes)
+    {
+        ret = self->nodes[index].welcomed;
+    }
+
+    return ret;
+}
+
+/*! \brief  Retrieves the statistics of the simulated INIC
+ *  \param  self        The instance
+ *  \param  stats_ptr   Reference to the structure which is filled with the statistics
+ */
+void Isim_GetStats(CInicSim *self, Isim_Stats_t *stats_ptr)
+{
+    *stats_ptr = self->stats;
+}
+
+/*! \brief  Resets the protocol state as done by an INIC startup
+ *  \param  self    The instance
+ */
+static void Isim_Reset(CInicSim *self)
+{
+    MISC_MEM_SET(&self->fifos[0], 0, sizeof(self->fifos));
+    Isim_QueueCtor(&self->ctrl_queue, &self->ctrl_msgs[0], ISIM_CTRL_QUEUE_SIZE);
+    Isim_QueueCtor(&self->data_queue, &self->data_msgs[0], ISIM_DATA_QUEUE_SIZE);
+    self->tx_head_ptr = NULL;
+    self->tx_tail_ptr = NULL;
+    self->rx_blocked = false;
+}
+
+/*! \brief  Processes all Tx messages, transmits due flow states and passes Rx messages
+ *  \param  self    The instance
+ *  \return Returns \c true if any message was processed, otherwise \c false.
+ */
+static bool Isim_Service(CInicSim *self)
+{
+    bool busy = false;
+
+    if (self->started != false)
+    {
+        uint8_t cnt;
+
+        while (self->tx_head_ptr != NULL)
+        {
+            Ucs_Lld_TxMsg_t *msg_ptr = self->tx_head_ptr;
+
+            self->tx_head_ptr = msg_ptr->custom_next_msg_ptr;
+            if (self->tx_head_ptr == NULL)
+            {
+                self->tx_tail_ptr = NULL;
+            }
+
+            msg_ptr->custom_next_msg_ptr = NULL;
+            Isim_TxProcessMsg(self, msg_ptr);
+            self->api_ptr->tx_release_fptr(self->ucs_inst_ptr, msg_ptr);
+            busy = true;
+        }
+
+        for (cnt = 0U; cnt < PMP_MAX_NUM_FIFOS; cnt++)      /* one flow status per FIFO and pass */
+        {
+            if (self->fifos[cnt].tx_status_req != false)
+            {
+                self->fifos[cnt].tx_status_req = false;
+                Isim_RxQueueCtrl(self, (Pmp_FifoId_t)cnt, PMP_MSG_TYPE_STATUS, self->fifos[cnt].tx_last_sid, 
+                                 (uint8_t)PMP_STATUS_TYPE_FLOW, (uint8_t)PMP_STATUS_CODE_SUCCESS, NULL, 0U);
+            }
+        }
+
+        if (Isim_RxService(self) != false)
+        {
+            busy = true;
+        }
+    }
+
+    return busy;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Callback functions                                                                             */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Counts general errors reported by UNICENS
+ *  \param  error_code  The error code
+ *  \param  user_ptr    The instance
+ */
+static void Isim_OnError(Ucs_Error_t error_code, void *user_ptr)
+{
+    CInicSim *self = (CInicSim*)user_ptr;
+    self->stats.ucs_errors++;
+    MISC_UNUSED(error_code);
+}
+
+/*! \brief  Returns the virtual tick count
+ *  \param  user_ptr    The instance
+ *  \return The virtual tick count in milliseconds
+ */
+static Ucs_TickCount_t Isim_OnGetTickCount(void *user_ptr)
+{
+    CInicSim *self = (CInicSim*)user_ptr;
+    return (Ucs_TickCount_t)self->now;
+}
+
+/*! \brief  Starts or stops the application timer
+ *  \param  timeout     The timeout in milliseconds or \c 0 to stop the timer
+ *  \param  user_ptr    The instance
+ */
+static void Isim_OnSetAppTimer(Ucs_TickCount_t timeout, void *user_ptr)
+{
+    CInicSim *self = (CInicSim*)user_ptr;
+
+    if (timeout == 0U)
+    {
+        self->timer_active = false;
+    }
+    else
+    {
+        self->timer_due = self->now + (uint32_t)timeout;
+        self->timer_active = true;
+    }
+}
+
+/*! \brief  Notes that UNICENS requests a call of Ucs_Service()
+ *  \param  user_ptr    The instance
+ */
+static void Isim_OnRequestService(void *user_ptr)
+{
+    CInicSim *self = (CInicSim*)user_ptr;
+    self->service_request = true;
+}
+
+/*! \brief  Starts the low-level driver and resets the INIC
+ *  \param  api_ptr         LLD interface of UNICENS
+ *  \param  inst_ptr        Internal UNICENS handler
+ *  \param  lld_user_ptr    The instance
+ */
+static void Isim_OnLldStart(Ucs_Lld_Api_t *api_ptr, void *inst_ptr, void *lld_user_ptr)
+{
+    CInicSim *self = (CInicSim*)lld_user_ptr;
+
+    Isim_Reset(self);
+    self->api_ptr = api_ptr;
+    self->ucs_inst_ptr = inst_ptr;
+    self->started = true;
+}
+
+/*! \brief  Stops the low-level driver. Pending messages are discarded.
+ *  \param  lld_user_ptr    The instance
+ */
+static void Isim_OnLldStop(void *lld_user_ptr)
+{
+    CInicSim *self = (CInicSim*)lld_user_ptr;
+
+    self->started = false;
+    Isim_Reset(self);
+}
+
+/*! \brief  Resumes the Rx after UNICENS has provided Rx message objects again
+ *  \param  lld_user_ptr    The instance
+ */
+static void Isim_OnLldRxAvailable(void *lld_user_ptr)
+{
+    CInicSim *self = (CInicSim*)lld_user_ptr;
+    self->rx_blocked = false;
+}
+
+/*! \brief  Queues a single Tx message or a chain of Tx messages for processing
+ *  \param  msg_ptr         The first Tx message
+ *  \param  lld_user_ptr    The instance
+ */
+static void Isim_OnLldTransmit(Ucs_Lld_TxMsg_t *msg_ptr, void *lld_user_ptr)
+{
+    CInicSim *self = (CInicSim*)lld_user_ptr;
+    Ucs_Lld_TxMsg_t *tail_ptr = msg_ptr;
+
+    while (tail_ptr->custom_next_msg_ptr != NULL)
+    {
+        tail_ptr = tail_ptr->custom_next_msg_ptr;
+    }
+
+    if (self->tx_tail_ptr == NULL)
+    {
+        self->tx_head_ptr = msg_ptr;
+    }
+    else
+    {
+        self->tx_tail_ptr->custom_next_msg_ptr = msg_ptr;
+    }
+
+    self->tx_tail_ptr = tail_ptr;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Tx processing (EHC -> INIC)                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Copies a Tx message into one buffer and dispatches it according to its type
+ *  \param  self    The instance
+ *  \param  msg_ptr The Tx message
+ */
+static void Isim_TxProcessMsg(CInicSim *self, Ucs_Lld_TxMsg_t *msg_ptr)
+{
+    uint8_t pm[ISIM_PM_SIZE_MAX];
+    uint8_t size = 0U;
+    Ucs_Mem_Buffer_t *buf_ptr;
+
+    for (buf_ptr = msg_ptr->memory_ptr; buf_ptr != NULL; buf_ptr = buf_ptr->next_buffer_ptr)
+    {
+        uint16_t cnt = buf_ptr->data_size;
+
+        if (((uint16_t)size + cnt) > ISIM_PM_SIZE_MAX)
+        {
+            cnt = (uint16_t)ISIM_PM_SIZE_MAX - (uint16_t)size;
+        }
+
+        MISC_MEM_CPY(&pm[size], buf_ptr->data_ptr, (size_t)cnt);
+        size += (uint8_t)cnt;
+    }
+
+    if (size >= PMP_PM_MIN_SIZE_HEADER)
+    {
+        uint8_t pml = Pmp_GetPml(pm);
+        uint8_t pmhl = Pmp_GetPmhl(pm);
+        Pmp_FifoId_t fifo_id = Pmp_GetFifoId(pm);
+
+        if ((pmhl >= ISIM_PMHL_CTRL) && (pmhl <= ISIM_PMHL_DATA) && (pml >= (pmhl + 1U)) && 
+            (((uint16_t)pml + 2U) <= (uint16_t)size) && ((uint8_t)fifo_id < PMP_MAX_NUM_FIFOS))
+        {
+            switch (Pmp_GetMsgType(pm))
+            {
+                case PMP_MSG_TYPE_CMD:
+                    Isim_TxProcessCommand(self, fifo_id, pm);
+                    break;
+                case PMP_MSG_TYPE_STATUS:
+                    Isim_TxProcessStatus(self, fifo_id, pm);
+                    break;
+                case PMP_MSG_TYPE_DATA:
+                    Isim_TxProcessData(self, fifo_id, pm, pml + 2U);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+/*! \brief  Processes a command message of UNICENS
+ *  \param  self    The instance
+ *  \param  fifo_id The FIFO
+ *  \param  pm      The port message
+ */
+static void Isim_TxProcessCommand(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[])
+{
+    CPmh header;
+    Pmp_CommandType_t type;
+    Pmp_CommandCode_t code;
+    Isim_Fifo_t *fifo_ptr = &self->fifos[fifo_id];
+
+    Pmh_DecodeHeader(&header, pm);
+    type = Pmh_GetExtCommandType(&header);
+    code = Pmh_GetExtCommandCode(&header);
+    self->stats.tx_ctrl_msgs++;
+
+    if ((type == PMP_CMD_TYPE_SYNCHRONIZATION) && (code == PMP_CMD_CODE_SYNC) && (Pmp_GetDataSize(pm) == 4U))
+    {
+        uint8_t sync_data[4];
+
+        sync_data[0] = ISIM_TX_CREDITS;                     /* grant own credits and confirm parameters */
+        sync_data[1] = Pmp_GetData(pm, 1U);
+        sync_data[2] = Pmp_GetData(pm, 2U);
+        sync_data[3] = Pmp_GetData(pm, 3U);
+
+        fifo_ptr->synced = true;
+        fifo_ptr->tx_last_sid = header.sid;
+        fifo_ptr->tx_status_req = false;
+        fifo_ptr->rx_next_sid = header.sid + 1U;
+        fifo_ptr->rx_acked_sid = header.sid;
+        fifo_ptr->rx_credits = Pmp_GetData(pm, 0U) & PMP_CREDITS_MASK;
+        fifo_ptr->rx_status_req = false;
+        Isim_RxQueueCtrl(self, fifo_id, PMP_MSG_TYPE_STATUS, header.sid, (uint8_t)PMP_STATUS_TYPE_SYNCED, 0U, sync_data, 4U);
+    }
+    else if ((type == PMP_CMD_TYPE_SYNCHRONIZATION) && (code == PMP_CMD_CODE_UNSYNC))
+    {
+        fifo_ptr->synced = false;
+        Isim_RxQueueCtrl(self, fifo_id, PMP_MSG_TYPE_STATUS, 0U, (uint8_t)PMP_STATUS_TYPE_UNSYNCED_RDY, 
+                         (uint8_t)PMP_UNSYNC_R_COMMAND, NULL, 0U);
+    }
+    else if (type == PMP_CMD_TYPE_REQ_STATUS)
+    {
+        if (fifo_ptr->synced != false)
+        {
+            Isim_RxQueueCtrl(self, fifo_id, PMP_MSG_TYPE_STATUS, fifo_ptr->tx_last_sid, (uint8_t)PMP_STATUS_TYPE_FLOW, 
+                             (uint8_t)PMP_STATUS_CODE_SUCCESS, NULL, 0U);
+        }
+        else
+        {
+            Isim_RxQueueCtrl(self, fifo_id, PMP_MSG_TYPE_STATUS, 0U, (uint8_t)PMP_STATUS_TYPE_UNSYNCED_RDY, 
+                             (uint8_t)PMP_UNSYNC_R_STARTUP, NULL, 0U);
+        }
+    }
+    else
+    {
+        /* message actions are not expected since the simulation never reports a failure */
+    }
+}
+
+/*! \brief  Processes a status message of UNICENS which acknowledges Rx data messages
+ *  \param  self    The instance
+ *  \param  fifo_id The FIFO
+ *  \param  pm      The port message
+ */
+static void Isim_TxProcessStatus(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[])
+{
+    CPmh header;
+    Isim_Fifo_t *fifo_ptr = &self->fifos[fifo_id];
+
+    Pmh_DecodeHeader(&header, pm);
+    self->stats.tx_ctrl_msgs++;
+
+    if ((fifo_ptr->synced != false) && (Pmh_GetExtStatusType(&header) == PMP_STATUS_TYPE_FLOW))
+    {
+        uint8_t acked_sid = header.sid;                     /* "success" acknowledges the SID itself */
+        uint8_t outstanding = (uint8_t)((uint8_t)(fifo_ptr->rx_next_sid - 1U) - fifo_ptr->rx_acked_sid);
+
+        if (Pmh_GetExtStatusCode(&header) == PMP_STATUS_CODE_BUSY)
+        {
+            acked_sid = header.sid - 1U;                    /* "busy" acknowledges the preceding SIDs */
+        }
+
+        if (((uint8_t)(acked_sid - fifo_ptr->rx_acked_sid) <= outstanding) && (acked_sid != fifo_ptr->rx_acked_sid))
+        {
+            fifo_ptr->rx_acked_sid = acked_sid;
+            fifo_ptr->rx_status_req = false;                /* credits returned, a new request is possible */
+        }
+    }
+}
+
+/*! \brief  Processes a data message of UNICENS
+ *  \param  self    The instance
+ *  \param  fifo_id The FIFO
+ *  \param  pm      The port message
+ *  \param  size    The size of the port message
+ */
+static void Isim_TxProcessData(CInicSim *self, Pmp_FifoId_t fifo_id, uint8_t pm[], uint8_t size)
+{
+    Isim_Fifo_t *fifo_ptr = &self->fifos[fifo_id];
+
+    self->stats.tx_data_msgs++;
+
+    if ((fifo_ptr->synced != false) && (Pmp_GetSid(pm) == (uint8_t)(fifo_ptr->tx_last_sid + 1U)))
+    {
+        IEncoder *enc_ptr = Enc_GetEncoder(ENC_CONTENT_00);
+        uint8_t hdr_sz = Pmp_GetPmhl(pm) + 3U + enc_ptr->msg_hdr_sz;
+
+        fifo_ptr->tx_last_sid++;
+        fifo_ptr->tx_status_req = true;
+
+        if (size >= hdr_sz)
+        {
+            Msg_MostTel_t tel;
+
+            MISC_MEM_SET(&tel, 0, sizeof(tel));
+            /* parasoft suppress item MISRA2004-17_4 reason "necessary offset usage" */
+            enc_ptr->decode_fptr(&tel, &pm[hdr_sz - enc_ptr->msg_hdr_sz]);
+            /* parasoft unsuppress item MISRA2004-17_4 reason "necessary offset usage" */
+
+            if ((uint8_t)(size - hdr_sz) >= tel.tel.tel_len)
+            {
+                if (fifo_id == PMP_FIFO_ID_ICM)
+                {
+                    Isim_IcmOnRequest(self, &tel);
+                }
+                else if (fifo_id == PMP_FIFO_ID_MCM)
+                {
+                    Isim_McmOnMessage(self, &tel);
+                }
+                else
+                {
+                    Isim_RcmOnMessage(self, &tel);
+                }
+            }
+        }
+    }
+}
+
+/*! \brief  Answers a request to the INIC FBlock
+ *  \param  self    The instance
+ *  \param  tel_ptr The request
+ */
+static void Isim_IcmOnRequest(CInicSim *self, Msg_MostTel_t *tel_ptr)
+{
+    uint8_t error_code = 0U;
+
+    if ((tel_ptr->destination_addr == MSG_ADDR_INIC) && (tel_ptr->id.fblock_id == FB_INIC))
+    {
+        uint8_t data[ISIM_NW_STATUS_SIZE];
+
+        switch (tel_ptr->id.function_id)
+        {
+            case INIC_FID_DEVICE_VERSION:
+                if (tel_ptr->id.op_type == UCS_OP_GET)
+                {
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_DEVICE_VERSION, UCS_OP_STATUS, ISIM_DEVICE_VERSION, (uint8_t)sizeof(ISIM_DEVICE_VERSION));
+                }
+                else
+                {
+                    error_code = ISIM_ERR_OP_TYPE;
+                }
+                break;
+            case INIC_FID_DEVICE_STATUS:
+                if (tel_ptr->id.op_type == UCS_OP_GET)
+                {
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_DEVICE_STATUS, UCS_OP_STATUS, ISIM_DEVICE_STATUS, (uint8_t)sizeof(ISIM_DEVICE_STATUS));
+                }
+                else
+                {
+                    error_code = ISIM_ERR_OP_TYPE;
+                }
+                break;
+            case INIC_FID_DEVICE_ATTACH:
+                if (tel_ptr->id.op_type == UCS_OP_STARTRESULT)
+                {                                           /* the attached EHC receives the current states */
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_DEVICE_ATTACH, UCS_OP_RESULT, NULL, 0U);
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_DEVICE_STATUS, UCS_OP_STATUS, ISIM_DEVICE_STATUS, (uint8_t)sizeof(ISIM_DEVICE_STATUS));
+                    tel_ptr->id.function_id = INIC_FID_MOST_NW_STATUS;
+                    tel_ptr->id.op_type = UCS_OP_GET;
+                    Isim_IcmOnRequest(self, tel_ptr);
+                }
+                else
+                {
+                    error_code = ISIM_ERR_OP_TYPE;
+                }
+                break;
+            case INIC_FID_MOST_NW_STATUS:
+                if (tel_ptr->id.op_type == UCS_OP_GET)
+                {
+                    data[0] = 0x00U;                        /* Events */
+                    data[1] = 0x00U;
+                    data[2] = (uint8_t)UCS_NW_NOT_AVAILABLE;
+                    data[3] = (uint8_t)UCS_NW_AVAIL_INFO_REGULAR;
+                    data[4] = (uint8_t)UCS_NW_AV_TR_CA_NO_TRANSITION;
+                    data[5] = MISC_HB(self->node_address);
+                    data[6] = MISC_LB(self->node_address);
+                    data[7] = 0x00U;                        /* NodePosition */
+                    data[8] = 0x00U;                        /* MaxPosition */
+                    data[9] = MISC_HB(ISIM_PACKET_BW);
+                    data[10] = MISC_LB(ISIM_PACKET_BW);
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_MOST_NW_STATUS, UCS_OP_STATUS, data, ISIM_NW_STATUS_SIZE);
+                }
+                else
+                {
+                    error_code = ISIM_ERR_OP_TYPE;
+                }
+                break;
+            case INIC_FID_MOST_NW_CFG:
+                if (tel_ptr->id.op_type == UCS_OP_GET)
+                {
+                    data[0] = MISC_HB(self->node_address);
+                    data[1] = MISC_LB(self->node_address);
+                    data[2] = MISC_HB(ISIM_GROUP_ADDRESS);
+                    data[3] = MISC_LB(ISIM_GROUP_ADDRESS);
+                    data[4] = ISIM_LLRBC;
+                    Isim_IcmRespond(self, tel_ptr, INIC_FID_MOST_NW_CFG, UCS_OP_STATUS, data, ISIM_NW_CONFIG_SIZE);
+                }
+                else
+                {
+                    error_code = ISIM_ERR_OP_TYPE;
+                }
+                break;
+            default:
+                error_code = ISIM_ERR_FKT_ID;
+                break;
+        }
+    }
+
+    if (error_code != 0U)
+    {
+        self->stats.unknown_requests++;
+        Isim_IcmRespond(self, tel_ptr, tel_ptr->id.function_id, UCS_OP_ERROR, &error_code, 1U);
+    }
+}
+
+/*! \brief  Queues a message of the INIC FBlock to the sender of a request
+ *  \param  self        The instance
+ *  \param  tel_ptr     The request
+ *  \param  function_id The function of the response
+ *  \param  op_type     The operation type of the response
+ *  \param  data        The payload of the response
+ *  \param  size        The size of the payload
+ */
+static void Isim_IcmRespond(CInicSim *self, Msg_MostTel_t *tel_ptr, uint16_t function_id, Ucs_OpType_t op_type, 
+                            uint8_t data[], uint8_t size)
+{
+    Isim_Respond(self, PMP_FIFO_ID_ICM, MSG_ADDR_INIC, tel_ptr, function_id, op_type, data, size);
+}
+
+/*! \brief  Loops back a message of the MCM FIFO as if the destination node has sent it
+ *  \param  self    The instance
+ *  \param  tel_ptr The message
+ */
+static void Isim_McmOnMessage(CInicSim *self, Msg_MostTel_t *tel_ptr)
+{
+    if (tel_ptr->destination_addr != MSG_ADDR_INIC)
+    {
+        tel_ptr->source_addr = tel_ptr->destination_addr;
+        tel_ptr->destination_addr = self->node_address;
+        Isim_RxQueueData(self, PMP_FIFO_ID_MCM, tel_ptr);
+    }
+}
+
+/*! \brief  Delivers a remote control message to all addressed nodes
+ *  \param  self    The instance
+ *  \param  tel_ptr The message
+ */
+static void Isim_RcmOnMessage(CInicSim *self, Msg_MostTel_t *tel_ptr)
+{
+    uint8_t index;
+
+    for (index = 0U; index < self->num_nodes; index++)
+    {
+        Isim_Node_t *node_ptr = &self->nodes[index];
+
+        if (Isim_IsNodeAddressed(node_ptr, tel_ptr->destination_addr) != false)
+        {
+            if (tel_ptr->id.fblock_id == FB_EXC)
+            {
+                Isim_ExcOnRequest(self, node_ptr, tel_ptr);
+            }
+            else if ((tel_ptr->destination_addr != UCS_ADDR_BROADCAST_BLOCKING) &&
+                     (tel_ptr->destination_addr != UCS_ADDR_BROADCAST_UNBLOCKING))
+            {                                               /* resource and route building is not simulated */
+                uint8_t error_code = ISIM_ERR_FKT_ID;
+
+                self->stats.unknown_requests++;
+                Isim_RcmRespond(self, node_ptr, tel_ptr, tel_ptr->id.function_id, UCS_OP_ERROR, &error_code, 1U);
+            }
+            else
+            {
+                /* broadcast messages to other FBlocks are ignored */
+            }
+        }
+    }
+}
+
+/*! \brief  Checks if a node is addressed by a remote control message
+ *  \param  node_ptr    The node
+ *  \param  address     The destination address of the message
+ *  \return Returns \c true if the node is addressed, otherwise \c false.
+ */
+static bool Isim_IsNodeAddressed(Isim_Node_t *node_ptr, uint16_t address)
+{
+    bool ret = false;
+
+    if ((address == UCS_ADDR_BROADCAST_BLOCKING) || (address == UCS_ADDR_BROADCAST_UNBLOCKING) ||
+        (address == node_ptr->signature.node_address) || (address == node_ptr->signature.node_pos_addr))
+    {
+        ret = true;
+    }
+    else if ((address == MSG_ADDR_INIC) && (node_ptr->signature.node_pos_addr == ISIM_POS_ADDR_LOCAL))
+    {
+        ret = true;
+    }
+    else
+    {
+        /* message is addressed to another node */
+    }
+
+    return ret;
+}
+
+/*! \brief  Answers a request to the ExtendedNetworkControl FBlock of a node
+ *  \param  self        The instance
+ *  \param  node_ptr    The addressed node
+ *  \param  tel_ptr     The request
+ */
+static void Isim_ExcOnRequest(CInicSim *self, Isim_Node_t *node_ptr, Msg_MostTel_t *tel_ptr)
+{
+    uint8_t data[ISIM_SIGNATURE_SIZE + 2U];
+    uint8_t error_code = 0U;
+    uint8_t i;
+
+    switch (tel_ptr->id.function_id)
+    {
+        case EXC_FID_HELLO:
+            if (tel_ptr->id.op_type == UCS_OP_GET)
+            {
+                if (node_ptr->welcomed == false)            /* welcomed nodes do not answer again */
+                {
+                    data[0] = ISIM_SIGNATURE_VERSION;
+                    Isim_EncodeSignature(&node_ptr->signature, &data[1]);
+                    Isim_RcmRespond(self, node_ptr, tel_ptr, EXC_FID_HELLO, UCS_OP_STATUS, data, ISIM_SIGNATURE_SIZE + 1U);
+                }
+            }
+            else
+            {
+                error_code = ISIM_ERR_OP_TYPE;
+            }
+            break;
+        case EXC_FID_WELCOME:
+            if (tel_ptr->id.op_type == UCS_OP_STARTRESULT)
+            {                                               /* welcome succeeds if the signature matches */
+                data[0] = EXC_WELCOME_SUCCESS;
+                data[1] = ISIM_SIGNATURE_VERSION;
+                Isim_EncodeSignature(&node_ptr->signature, &data[2]);
+
+                if (tel_ptr->tel.tel_len < (ISIM_SIGNATURE_SIZE + 3U))
+                {
+                    data[0] = ISIM_WELCOME_FAILED;
+                }
+
+                for (i = 0U; (data[0] == EXC_WELCOME_SUCCESS) && (i < ISIM_SIGNATURE_SIZE); i++)
+                {
+                    if (tel_ptr->tel.tel_data_ptr[i + 3U] != data[i + 2U])
+                    {
+                        data[0] = ISIM_WELCOME_FAILED;
+                    }
+                }
+
+                if (data[0] == EXC_WELCOME_SUCCESS)
+                {
+                    node_ptr->welcomed = true;
+                }
+                Isim_RcmRespond(self, node_ptr, tel_ptr, EXC_FID_WELCOME, UCS_OP_RESULT, data, ISIM_SIGNATURE_SIZE + 2U);
+            }
+            else
+            {
+                error_code = ISIM_ERR_OP_TYPE;
+            }
+            break;
+        case EXC_FID_SIGNATURE:
+            if (tel_ptr->id.op_type == UCS_OP_GET)
+            {
+                data[0] = ISIM_SIGNATURE_VERSION;
+                Isim_EncodeSignature(&node_ptr->signature, &data[1]);
+                Isim_RcmRespond(self, node_ptr, tel_ptr, EXC_FID_SIGNATURE, UCS_OP_STATUS, data, ISIM_SIGNATURE_SIZE + 1U);
+            }
+            else
+            {
+                error_code = ISIM_ERR_OP_TYPE;
+            }
+            break;
+        case EXC_FID_DEVICE_INIT:
+            if (tel_ptr->id.op_type == UCS_OP_START)
+            {                                               /* the node resets and waits for a welcome */
+                node_ptr->welcomed = false;
+            }
+            else
+            {
+                error_code = ISIM_ERR_OP_TYPE;
+            }
+            break;
+        default:
+            error_code = ISIM_ERR_FKT_ID;
+            break;
+    }
+
+    if (error_code != 0U)
+    {
+        self->stats.unknown_requests++;
+        Isim_RcmRespond(self, node_ptr, tel_ptr, tel_ptr->id.function_id, UCS_OP_ERROR, &error_code, 1U);
+    }
+    else
+    {
+        self->stats.exc_requests++;
+    }
+}
+
+/*! \brief  Queues a remote control message of a node to the sender of a request
+ *  \param  self        The instance
+ *  \param  node_ptr    The responding node
+ *  \param  tel_ptr     The request
+ *  \param  function_id The function of the response
+ *  \param  op_type     The operation type of the response
+ *  \param  data        The payload of the response
+ *  \param  size        The size of the payload
+ */
+static void Isim_RcmRespond(CInicSim *self, Isim_Node_t *node_ptr, Msg_MostTel_t *tel_ptr, uint16_t function_id,
+                            Ucs_OpType_t op_type, uint8_t data[], uint8_t size)
+{
+    Isim_Respond(self, PMP_FIFO_ID_RCM, node_ptr->signature.node_address, tel_ptr, function_id, op_type, data, size);
+}
+
+/*! \brief  Queues a response to the sender of a request
+ *  \param  self        The instance
+ *  \param  fifo_id     The FIFO of the response
+ *  \param  source_addr The source address of the response
+ *  \param  tel_ptr     The request
+ *  \param  function_id The function of the response
+ *  \param  op_type     The operation type of the response
+ *  \param  data        The payload of the response
+ *  \param  size        The size of the payload
+ */
+static void Isim_Respond(CInicSim *self, Pmp_FifoId_t fifo_id, uint16_t source_addr, Msg_MostTel_t *tel_ptr,
+                         uint16_t function_id, Ucs_OpType_t op_type, uint8_t data[], uint8_t size)
+{
+    Msg_MostTel_t rsp;
+    uint8_t payload[ISIM_PM_SIZE_MAX];
+
+    MISC_MEM_SET(&rsp, 0, sizeof(rsp));
+
+    if (size > 0U)
+    {
+        MISC_MEM_CPY(&payload[0], data, (size_t)size);
+    }
+
+    rsp.source_addr = source_addr;
+    rsp.destination_addr = tel_ptr->source_addr;
+    rsp.id.fblock_id = tel_ptr->id.fblock_id;
+    rsp.id.instance_id = tel_ptr->id.instance_id;
+    rsp.id.function_id = function_id;
+    rsp.id.op_type = op_type;
+    rsp.tel.tel_len = size;
+    rsp.tel.tel_data_ptr = &payload[0];
+
+    Isim_RxQueueData(self, fifo_id, &rsp);
+}
+
+/*! \brief  Writes a signature v1 in the byte order of the ExtendedNetworkControl FBlock
+ *  \param  signature_ptr   The signature
+ *  \param  data            The target buffer of \ref ISIM_SIGNATURE_SIZE bytes
+ */
+static void Isim_EncodeSignature(const Ucs_Signature_t *signature_ptr, uint8_t data[])
+{
+    data[0]  = MISC_HB(signature_ptr->node_address);
+    data[1]  = MISC_LB(signature_ptr->node_address);
+    data[2]  = MISC_HB(signature_ptr->group_address);
+    data[3]  = MISC_LB(signature_ptr->group_address);
+    data[4]  = MISC_HB(signature_ptr->mac_47_32);
+    data[5]  = MISC_LB(signature_ptr->mac_47_32);
+    data[6]  = MISC_HB(signature_ptr->mac_31_16);
+    data[7]  = MISC_LB(signature_ptr->mac_31_16);
+    data[8]  = MISC_HB(signature_ptr->mac_15_0);
+    data[9]  = MISC_LB(signature_ptr->mac_15_0);
+    data[10] = MISC_HB(signature_ptr->node_pos_addr);
+    data[11] = MISC_LB(signature_ptr->node_pos_addr);
+    data[12] = MISC_HB(signature_ptr->diagnosis_id);
+    data[13] = MISC_LB(signature_ptr->diagnosis_id);
+    data[14] = signature_ptr->num_ports;
+    data[15] = signature_ptr->chip_id;
+    data[16] = signature_ptr->fw_major;
+    data[17] = signature_ptr->fw_minor;
+    data[18] = signature_ptr->fw_release;
+    data[19] = MISC_HB(signature_ptr->fw_build >> 16U);
+    data[20] = MISC_LB(signature_ptr->fw_build >> 16U);
+    data[21] = MISC_HB(signature_ptr->fw_build);
+    data[22] = MISC_LB(signature_ptr->fw_build);
+    data[23] = signature_ptr->cs_major;
+    data[24] = signature_ptr->cs_minor;
+    data[25] = signature_ptr->cs_release;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Rx processing (INIC -> EHC)                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Passes queued status and command messages and the next data message permitted by 
+ *          the credits to UNICENS
+ *  \param  self    The instance
+ *  \return Returns \c true if any message was passed or dropped, otherwise \c false.
+ */
+static bool Isim_RxService(CInicSim *self)
+{
+    bool busy = false;
+    bool stop = false;
+
+    while ((stop == false) && (self->rx_blocked == false) && (self->ctrl_queue.num > 0U))
+    {
+        if (Isim_RxPass(self, Isim_QueuePeek(&self->ctrl_queue)) != false)
+        {
+            Isim_QueuePop(&self->ctrl_queue);
+            self->stats.rx_ctrl_msgs++;
+            busy = true;
+        }
+        else
+        {
+            stop = true;
+        }
+    }
+
+    while ((stop == false) && (self->rx_blocked == false) && (self->data_queue.num > 0U))
+    {
+        Isim_PortMsg_t *pm_ptr = Isim_QueuePeek(&self->data_queue);
+        Pmp_FifoId_t fifo_id = Pmp_GetFifoId(pm_ptr->data);
+        Isim_Fifo_t *fifo_ptr = &self->fifos[fifo_id];
+        uint8_t outstanding = (uint8_t)((uint8_t)(fifo_ptr->rx_next_sid - 1U) - fifo_ptr->rx_acked_sid);
+
+        if (fifo_ptr->synced == false)
+        {
+            Isim_QueuePop(&self->data_queue);                       /* discard messages of an unsynced FIFO */
+            self->stats.rx_dropped_msgs++;
+            busy = true;
+        }
+        else if (outstanding >= fifo_ptr->rx_credits)
+        {
+            if (fifo_ptr->rx_status_req == false)                   /* request a status once per stall */
+            {
+                fifo_ptr->rx_status_req = true;
+                self->stats.rx_credit_stalls++;
+                Isim_RxQueueCtrl(self, fifo_id, PMP_MSG_TYPE_CMD, fifo_ptr->rx_next_sid - 1U, 
+                                 (uint8_t)PMP_CMD_TYPE_REQ_STATUS, (uint8_t)PMP_CMD_CODE_REQ_STATUS, NULL, 0U);
+                busy = true;
+            }
+            stop = true;
+        }
+        else
+        {
+            Pmp_SetSid(pm_ptr->data, fifo_ptr->rx_next_sid);
+
+            if (Isim_RxPass(self, pm_ptr) != false)
+            {
+                fifo_ptr->rx_next_sid++;
+                Isim_QueuePop(&self->data_queue);
+                self->stats.rx_data_msgs++;
+                busy = true;
+            }
+            stop = true;                                            /* one data message per pass like a serial port */
+        }
+    }
+
+    return busy;
+}
+
+/*! \brief  Passes a port message to UNICENS
+ *  \param  self    The instance
+ *  \param  pm_ptr  The port message
+ *  \return Returns \c true if the message was passed, or \c false if UNICENS provided no 
+ *          Rx message object. In the latter case the Rx is blocked until UNICENS invokes 
+ *          the callback \c rx_available_fptr.
+ */
+static bool Isim_RxPass(CInicSim *self, Isim_PortMsg_t *pm_ptr)
+{
+    bool ret = false;
+    Ucs_Lld_RxMsg_t *msg_ptr = self->api_ptr->rx_allocate_fptr(self->ucs_inst_ptr, (uint16_t)pm_ptr->size);
+
+    if (msg_ptr != NULL)
+    {
+        MISC_MEM_CPY(msg_ptr->data_ptr, &pm_ptr->data[0], (size_t)pm_ptr->size);
+        msg_ptr->data_size = (uint16_t)pm_ptr->size;
+        self->api_ptr->rx_receive_fptr(self->ucs_inst_ptr, msg_ptr);
+        ret = true;
+    }
+    else
+    {
+        self->rx_blocked = true;
+        self->stats.rx_alloc_stalls++;
+    }
+
+    return ret;
+}
+
+/*! \brief  Queues a status or command message for UNICENS
+ *  \param  self        The instance
+ *  \param  fifo_id     The FIFO
+ *  \param  msg_type    The message type, i.e. status or command
+ *  \param  sid         The sequence id
+ *  \param  ext_type    The status or command type
+ *  \param  ext_code    The status or command code
+ *  \param  data        Additional payload data
+ *  \param  size        The size of additional payload data, valid values: 0..4
+ */
+static void Isim_RxQueueCtrl(CInicSim *self, Pmp_FifoId_t fifo_id, Pmp_MsgType_t msg_type, uint8_t sid, 
+                             uint8_t ext_type, uint8_t ext_code, uint8_t data[], uint8_t size)
+{
+    Isim_PortMsg_t *pm_ptr = Isim_QueuePush(&self->ctrl_queue);
+
+    if (pm_ptr != NULL)
+    {
+        pm_ptr->size = PMP_PM_MIN_SIZE_HEADER + size;
+        Isim_SetHeader(pm_ptr->data, fifo_id, msg_type, ISIM_PMHL_CTRL, pm_ptr->size);
+        Pmp_SetSid(pm_ptr->data, sid);
+        Pmp_SetExtType(pm_ptr->data, ext_type, ext_code);
+
+        if (size > 0U)
+        {
+            MISC_MEM_CPY(&pm_ptr->data[PMP_PM_MIN_SIZE_HEADER], data, (size_t)size);
+        }
+    }
+    else
+    {
+        self->stats.rx_dropped_msgs++;
+    }
+}
+
+/*! \brief  Queues a data message for UNICENS. The sequence id is assigned when the message is passed.
+ *  \param  self        The instance
+ *  \param  fifo_id     The FIFO
+ *  \param  tel_ptr     The message
+ */
+static void Isim_RxQueueData(CInicSim *self, Pmp_FifoId_t fifo_id, Msg_MostTel_t *tel_ptr)
+{
+    Isim_PortMsg_t *pm_ptr = NULL;
+    IEncoder *enc_ptr = Enc_GetEncoder(ENC_CONTENT_00);
+
+    if (tel_ptr->tel.tel_len <= MSG_MAX_SIZE_PAYLOAD)
+    {
+        pm_ptr = Isim_QueuePush(&self->data_queue);
+    }
+
+    if (pm_ptr != NULL)
+    {
+        pm_ptr->size = enc_ptr->pm_hdr_sz + enc_ptr->msg_hdr_sz + tel_ptr->tel.tel_len;
+        Isim_SetHeader(pm_ptr->data, fifo_id, PMP_MSG_TYPE_DATA, ISIM_PMHL_DATA, pm_ptr->size);
+        Pmp_SetSid(pm_ptr->data, 0U);
+        Pmp_SetExtType(pm_ptr->data, 0U, 0U);
+        pm_ptr->data[PMP_PM_MIN_SIZE_HEADER] = 0U;                  /* stuffing bytes */
+        pm_ptr->data[PMP_PM_MIN_SIZE_HEADER + 1U] = 0U;
+        enc_ptr->encode_fptr(tel_ptr, &pm_ptr->data[enc_ptr->pm_hdr_sz]);
+
+        if (tel_ptr->tel.tel_len > 0U)
+        {
+            MISC_MEM_CPY(&pm_ptr->data[enc_ptr->pm_hdr_sz + enc_ptr->msg_hdr_sz], tel_ptr->tel.tel_data_ptr, 
+                         (size_t)tel_ptr->tel.tel_len);
+        }
+    }
+    else
+    {
+        self->stats.rx_dropped_msgs++;
+    }
+}
+
+/*! \brief  Sets the length fields and the FIFO protocol header of a port message sent by the INIC
+ *  \param  pm          The port message
+ *  \param  fifo_id     The FIFO
+ *  \param  msg_type    The message type
+ *  \param  pmhl        The port message header length
+ *  \param  size        The size of the port message
+ */
+static void Isim_SetHeader(uint8_t pm[], Pmp_FifoId_t fifo_id, Pmp_MsgType_t msg_type, uint8_t pmhl, uint8_t size)
+{
+    Pmp_SetPml(pm, size - 2U);
+    Pmp_SetPmhl(pm, pmhl);
+    Pmp_SetFph(pm, fifo_id, msg_type);
+    pm[ISIM_IDX_FPH] |= ISIM_FPH_DIR_RX;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Queue of port messages                                                                         */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief  Constructor of a queue of port messages
+ *  \param  self    The instance
+ *  \param  msgs    Storage of the queue
+ *  \param  size    Number of entries of the storage
+ */
+static void Isim_QueueCtor(Isim_Queue_t *self, Isim_PortMsg_t msgs[], uint8_t size)
+{
+    self->msgs_ptr = msgs;
+    self->size = size;
+    self->head = 0U;
+    self->num = 0U;
+}
+
+/*! \brief  Appends an entry to the queue
+ *  \param  self    The instance
+ *  \return The appended entry or \c NULL if the queue is full
+ */
+static Isim_PortMsg_t* Isim_QueuePush(Isim_Queue_t *self)
+{
+    Isim_PortMsg_t *ret_ptr = NULL;
+
+    if (self->num < self->size)
+    {
+        ret_ptr = &self->msgs_ptr[(self->head + self->num) % self->size];
+        self->num++;
+    }
+
+    return ret_ptr;
+}
+
+/*! \brief  Retrieves the front-most entry of the queue
+ *  \param  self    The instance
+ *  \return The front-most entry or \c NULL if the queue is empty
+ */
+static Isim_PortMsg_t* Isim_QueuePeek(Isim_Queue_t *self)
+{
+    Isim_PortMsg_t *ret_ptr = NULL;
+
+    if (self->num > 0U)
+    {
+        ret_ptr = &self->msgs_ptr[self->head];
+    }
+
+    return ret_ptr;
+}
+
+/*! \brief  Removes the front-most entry of the queue
+ *  \param  self    The instance
+ */
+static void Isim_QueuePop(Isim_Queue_t *self)
+{
+    if (self->num > 0U)
+    {
+        self->head = (uint8_t)((self->head + 1U) % self->size);
+        self->num--;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+
@@ -0,0 +1,173 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Declaration of a simulated INIC which is connected to UNICENS as low-level driver
+ * \details The simulation implements the low-level driver callbacks, the port message FIFO 
+ *          protocol (synchronization, credits and status) and a subset of the INIC FBlock, which 
+ *          is sufficient to run Ucs_Init() to completion. Application messages transmitted on the 
+ *          MCM FIFO are looped back as if the destination node responded with the same message. 
+ *          The local INIC and the remote nodes added by Isim_AddNode() answer the Hello, Welcome,
+ *          Signature and DeviceInit functions of the ExtendedNetworkControl FBlock, which are used
+ *          by the Node Discovery service. Resource and route building is not simulated.
+ *          All timing is based on a virtual millisecond clock, which is advanced by Isim_Run(). 
+ *          Thus, initialization and message traffic can be tested and benchmarked on a host 
+ *          without INIC hardware.
+ */
+
+#ifndef UCS_INIC_SIM_H
+#define UCS_INIC_SIM_H
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include "ucs_api.h"
+#include "ucs_pmp.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/* Macros                                                                                         */
+/*------------------------------------------------------------------------------------------------*/
+#define ISIM_PM_SIZE_MAX        72U     /*!< \brief Maximum size of a port message in bytes */
+#define ISIM_CTRL_QUEUE_SIZE    16U     /*!< \brief Number of status and command messages which can wait for Rx */
+#define ISIM_DATA_QUEUE_SIZE    64U     /*!< \brief Number of data messages which can wait for Rx */
+#define ISIM_MAX_NODES          8U      /*!< \brief Maximum number of simulated nodes including the local INIC */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Types                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Statistics of the simulated INIC */
+typedef struct Isim_Stats_
+{
+    uint32_t tx_data_msgs;      /*!< \brief Data messages received from UNICENS */
+    uint32_t tx_ctrl_msgs;      /*!< \brief Status and command messages received from UNICENS */
+    uint32_t rx_data_msgs;      /*!< \brief Data messages passed to UNICENS */
+    uint32_t rx_ctrl_msgs;      /*!< \brief Status and command messages passed to UNICENS */
+    uint32_t rx_credit_stalls;  /*!< \brief Number of times a data message waited for credits */
+    uint32_t rx_alloc_stalls;   /*!< \brief Number of times UNICENS provided no Rx message object */
+    uint32_t rx_dropped_msgs;   /*!< \brief Messages dropped due to a full queue or an unsynced FIFO */
+    uint32_t unknown_requests;  /*!< \brief INIC and EXC requests which are answered with an error */
+    uint32_t exc_requests;      /*!< \brief EXC requests which are processed by the simulated nodes */
+    uint32_t ucs_services;      /*!< \brief Number of calls of Ucs_Service() */
+    uint32_t ucs_errors;        /*!< \brief Number of general errors reported by UNICENS */
+
+} Isim_Stats_t;
+
+/*! \brief Protocol state of a simulated port message FIFO */
+typedef struct Isim_Fifo_
+{
+    bool    synced;             /*!< \brief \c true if the FIFO is synchronized */
+    uint8_t tx_last_sid;        /*!< \brief SID of the latest data message received from UNICENS */
+    bool    tx_status_req;      /*!< \brief A flow status is due for received data messages */
+    uint8_t rx_next_sid;        /*!< \brief SID of the next data message passed to UNICENS */
+    uint8_t rx_acked_sid;       /*!< \brief SID of the latest data message acknowledged by UNICENS */
+    uint8_t rx_credits;         /*!< \brief Number of credits granted by UNICENS */
+    bool    rx_status_req;      /*!< \brief A status request is pending since credits ran out */
+
+} Isim_Fifo_t;
+
+/*! \brief Simulated node which answers requests to the ExtendedNetworkControl FBlock */
+typedef struct Isim_Node_
+{
+    Ucs_Signature_t signature;  /*!< \brief Signature reported by the node */
+    bool            welcomed;   /*!< \brief \c true if the node was welcomed. The node ignores Hello.Get
+                                 *          until it receives DeviceInit.Start. */
+} Isim_Node_t;
+
+/*! \brief Port message which waits for Rx */
+typedef struct Isim_PortMsg_
+{
+    uint8_t data[ISIM_PM_SIZE_MAX];     /*!< \brief Raw port message */
+    uint8_t size;                       /*!< \brief Size of the port message in bytes */
+
+} Isim_PortMsg_t;
+
+/*! \brief Queue of port messages which wait for Rx */
+typedef struct Isim_Queue_
+{
+    Isim_PortMsg_t *msgs_ptr;           /*!< \brief Storage of the queue */
+    uint8_t         size;               /*!< \brief Number of entries of the storage */
+    uint8_t         head;               /*!< \brief Index of the front-most entry */
+    uint8_t         num;                /*!< \brief Number of queued entries */
+
+} Isim_Queue_t;
+
+/*! \brief Class structure of the simulated INIC */
+typedef struct CInicSim_
+{
+    Ucs_Lld_Api_t  *api_ptr;            /*!< \brief LLD interface of UNICENS */
+    void           *ucs_inst_ptr;       /*!< \brief Internal UNICENS handler passed to the LLD interface */
+    bool            started;            /*!< \brief \c true between the start and stop of the LLD */
+    bool            rx_blocked;         /*!< \brief Waits until UNICENS provides Rx message objects again */
+    Ucs_Lld_TxMsg_t *tx_head_ptr;       /*!< \brief First Tx message which waits for processing */
+    Ucs_Lld_TxMsg_t *tx_tail_ptr;       /*!< \brief Last Tx message which waits for processing */
+    Isim_PortMsg_t  ctrl_msgs[ISIM_CTRL_QUEUE_SIZE];
+    Isim_PortMsg_t  data_msgs[ISIM_DATA_QUEUE_SIZE];
+    Isim_Queue_t    ctrl_queue;         /*!< \brief Status and command messages, passed first */
+    Isim_Queue_t    data_queue;         /*!< \brief Data messages, passed as credits permit */
+    Isim_Fifo_t     fifos[PMP_MAX_NUM_FIFOS];
+    uint16_t        node_address;       /*!< \brief Node address reported by the INIC */
+    Isim_Node_t     nodes[ISIM_MAX_NODES];  /*!< \brief Local INIC at index 0 followed by the remote nodes */
+    uint8_t         num_nodes;          /*!< \brief Number of simulated nodes including the local INIC */
+    uint32_t        now;                /*!< \brief Virtual time in milliseconds */
+    uint32_t        timer_due;          /*!< \brief Expiry time of the application timer */
+    bool            timer_active;       /*!< \brief \c true if the application timer is running */
+    bool            service_request;    /*!< \brief UNICENS requested a call of Ucs_Service() */
+    Isim_Stats_t    stats;              /*!< \brief Statistics */
+
+} CInicSim;
+
+/*------------------------------------------------------------------------------------------------*/
+/* Function prototypes                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+extern void Isim_Ctor(CInicSim *self, uint16_t node_address);
+extern void Isim_SetupInitData(CInicSim *self, Ucs_InitData_t *init_ptr);
+extern bool Isim_AddNode(CInicSim *self, uint16_t node_address);
+extern bool Isim_Run(CInicSim *self, Ucs_Inst_t *ucs_ptr, uint32_t duration, const bool *done_ptr);
+extern uint32_t Isim_GetTime(CInicSim *self);
+extern bool Isim_IsStarted(CInicSim *self);
+extern bool Isim_IsFifoSynced(CInicSim *self, Pmp_FifoId_t fifo_id);
+extern bool Isim_IsNodeWelcomed(CInicSim *self, uint8_t index);
+extern void Isim_GetStats(CInicSim *self, Isim_Stats_t *stats_ptr);
+
+#ifdef __cplusplus
+}                                                   /* extern "C" */
+#endif
+
+#endif                                              /* UCS_INIC_SIM_H */
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+
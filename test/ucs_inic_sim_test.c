@@ -0,0 +1,433 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Host test which runs the UNICENS initialization and application message traffic 
+ *          against the simulated INIC.
+ * \details The test is built on the host together with all UNICENS sources and the simulated 
+ *          INIC. Build and run it from the repository root:
+ *
+ *              gcc -std=c99 -Wall -Iinc -Icfg test/ucs_inic_sim_test.c test/ucs_inic_sim.c \
+ *                  src/\*.c -o isim_test
+ *              ./isim_test
+ *
+ *          Add \c -DUCS_AMS_SIZE_TX_MSG=200 and \c -DUCS_AMS_SIZE_RX_MSG=200 to test the loopback 
+ *          of a segmented message. The throughput test prints the virtual time which is needed 
+ *          to transfer a stream of application messages. The node discovery test welcomes the
+ *          local INIC and two remote nodes. Resource and route building (Ucs_Rm_Start()) is out
+ *          of scope, since the simulated nodes answer those requests with an error. The program
+ *          returns 0 if all test cases pass.
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "ucs_inic_sim.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test environment                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+#define TEST_NODE_ADDRESS       0x0101U
+#define TEST_DEST_ADDRESS       0x0200U
+#define TEST_MSG_ID             0x1234U
+#define TEST_SEGMENTED_SIZE     200U
+#define TEST_BENCH_MSGS         500U
+#define TEST_BENCH_SIZE         45U
+#define TEST_INIT_TIMEOUT       3000U
+#define TEST_MSG_TIMEOUT        1000U
+#define TEST_NUM_NODES          3U
+#define TEST_REMOTE_ADDRESS     0x0110U
+#define TEST_ND_TIMEOUT         2000U
+#define TEST_ND_PERIOD          6000U
+
+#define TEST_CHECK(cond)    Test_Check((cond), #cond, __LINE__)
+
+static CInicSim             test_sim;
+static Ucs_Inst_t          *test_ucs_ptr;
+
+static bool                 test_init_done;
+static Ucs_InitResult_t     test_init_result;
+static bool                 test_stop_done;
+static Ucs_StdResult_t      test_stop_result;
+static uint16_t             test_tx_completed;
+static uint16_t             test_tx_failed;
+static uint16_t             test_rx_received;
+static uint16_t             test_rx_mismatches;
+static uint16_t             test_rx_expected_size;
+static uint16_t             test_nd_known;
+static uint8_t              test_nd_welcomed;
+static uint8_t              test_nd_multi;
+static uint8_t              test_nd_others;
+static bool                 test_nd_stopped;
+static uint32_t             test_failures;
+
+static void Test_Check(bool cond, const char *expr, int line)
+{
+    if (cond == false)
+    {
+        (void)printf("FAILED line %d: %s\n", line, expr);
+        test_failures++;
+    }
+}
+
+static void Test_OnInitResult(Ucs_InitResult_t result, void *user_ptr)
+{
+    (void)user_ptr;
+    test_init_result = result;
+    test_init_done = true;
+}
+
+static void Test_OnStopped(Ucs_StdResult_t result, void *user_ptr)
+{
+    (void)user_ptr;
+    test_stop_result = result;
+    test_stop_done = true;
+}
+
+static void Test_OnTxComplete(Ucs_AmsTx_Msg_t* msg_ptr, Ucs_AmsTx_Result_t result, Ucs_AmsTx_Info_t info, void *user_ptr)
+{
+    (void)msg_ptr;
+    (void)info;
+    (void)user_ptr;
+
+    if (result == UCS_AMSTX_RES_SUCCESS)
+    {
+        test_tx_completed++;
+    }
+    else
+    {
+        test_tx_failed++;
+    }
+}
+
+static void Test_OnRxMsgReceived(void *user_ptr)
+{
+    (void)user_ptr;
+}
+
+/*! \brief Welcomes nodes which are not yet known and asks to check the other ones */
+static Ucs_Nd_CheckResult_t Test_OnNdEvaluate(Ucs_Signature_t *signature, void *user_ptr)
+{
+    Ucs_Nd_CheckResult_t ret = UCS_ND_CHK_UNKNOWN;
+    uint16_t index = signature->node_pos_addr - 0x0400U;
+
+    (void)user_ptr;
+
+    if (index < TEST_NUM_NODES)
+    {
+        if ((test_nd_known & (1U << index)) == 0U)
+        {
+            ret = UCS_ND_CHK_WELCOME;
+        }
+        else
+        {
+            ret = UCS_ND_CHK_UNIQUE;
+        }
+    }
+
+    return ret;
+}
+
+static void Test_OnNdReport(Ucs_Nd_ResCode_t code, Ucs_Signature_t *signature, void *user_ptr)
+{
+    (void)user_ptr;
+
+    if (code == UCS_ND_RES_WELCOME_SUCCESS)
+    {
+        test_nd_known |= (uint16_t)(1U << (signature->node_pos_addr - 0x0400U));
+        test_nd_welcomed++;
+    }
+    else if (code == UCS_ND_RES_MULTI)
+    {
+        test_nd_multi++;
+    }
+    else if (code == UCS_ND_RES_STOPPED)
+    {
+        test_nd_stopped = true;
+    }
+    else
+    {
+        test_nd_others++;
+    }
+}
+
+static uint8_t Test_Pattern(uint16_t index)
+{
+    return (uint8_t)((index * 7U) + 3U);
+}
+
+/*! \brief Verifies and releases all received application messages */
+static void Test_DrainRx(void)
+{
+    Ucs_AmsRx_Msg_t *msg_ptr = Ucs_AmsRx_PeekMsg(test_ucs_ptr);
+
+    while (msg_ptr != NULL)
+    {
+        bool match = (msg_ptr->source_address == TEST_DEST_ADDRESS) && (msg_ptr->msg_id == TEST_MSG_ID) && 
+                     (msg_ptr->data_size == test_rx_expected_size);
+        uint16_t i;
+
+        for (i = 0U; (match != false) && (i < msg_ptr->data_size); i++)
+        {
+            match = (msg_ptr->data_ptr[i] == Test_Pattern(i));
+        }
+
+        if (match == false)
+        {
+            test_rx_mismatches++;
+        }
+
+        test_rx_received++;
+        Ucs_AmsRx_ReleaseMsg(test_ucs_ptr);
+        msg_ptr = Ucs_AmsRx_PeekMsg(test_ucs_ptr);
+    }
+}
+
+/*! \brief Allocates and sends an application message, returns false if no message object is available */
+static bool Test_SendMsg(uint16_t size)
+{
+    bool ret = false;
+    Ucs_AmsTx_Msg_t *msg_ptr = Ucs_AmsTx_AllocMsg(test_ucs_ptr, size);
+
+    if (msg_ptr != NULL)
+    {
+        uint16_t i;
+
+        for (i = 0U; i < size; i++)
+        {
+            msg_ptr->data_ptr[i] = Test_Pattern(i);
+        }
+
+        msg_ptr->destination_address = TEST_DEST_ADDRESS;
+        msg_ptr->msg_id = TEST_MSG_ID;
+        msg_ptr->data_size = size;
+        TEST_CHECK(Ucs_AmsTx_SendMsg(test_ucs_ptr, msg_ptr, &Test_OnTxComplete) == UCS_RET_SUCCESS);
+        ret = true;
+    }
+
+    return ret;
+}
+
+static void Test_ResetCounters(uint16_t rx_expected_size)
+{
+    test_tx_completed = 0U;
+    test_tx_failed = 0U;
+    test_rx_received = 0U;
+    test_rx_mismatches = 0U;
+    test_rx_expected_size = rx_expected_size;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test cases                                                                                     */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Initialization synchronizes all FIFOs and attaches to the simulated INIC */
+static void Test_Init(void)
+{
+    Ucs_InitData_t init_data;
+
+    (void)Ucs_SetDefaultConfig(&init_data);
+    Isim_Ctor(&test_sim, TEST_NODE_ADDRESS);
+    Isim_SetupInitData(&test_sim, &init_data);
+    init_data.ams.rx.message_received_fptr = &Test_OnRxMsgReceived;
+    init_data.nd.eval_fptr = &Test_OnNdEvaluate;
+    init_data.nd.report_fptr = &Test_OnNdReport;
+    TEST_CHECK(Isim_AddNode(&test_sim, TEST_REMOTE_ADDRESS) != false);
+    TEST_CHECK(Isim_AddNode(&test_sim, TEST_REMOTE_ADDRESS + 1U) != false);
+
+    test_ucs_ptr = Ucs_CreateInstance();
+    TEST_CHECK(test_ucs_ptr != NULL);
+
+    if (test_ucs_ptr != NULL)
+    {
+        TEST_CHECK(Ucs_Init(test_ucs_ptr, &init_data, &Test_OnInitResult) == UCS_RET_SUCCESS);
+        TEST_CHECK(Isim_Run(&test_sim, test_ucs_ptr, TEST_INIT_TIMEOUT, &test_init_done) != false);
+        TEST_CHECK(test_init_result == UCS_INIT_RES_SUCCESS);
+        TEST_CHECK(Isim_IsStarted(&test_sim) != false);
+        TEST_CHECK(Isim_IsFifoSynced(&test_sim, PMP_FIFO_ID_ICM) != false);
+        TEST_CHECK(Isim_IsFifoSynced(&test_sim, PMP_FIFO_ID_MCM) != false);
+        TEST_CHECK(Isim_IsFifoSynced(&test_sim, PMP_FIFO_ID_RCM) != false);
+        (void)printf("ucs_inic_sim_test: initialization finished after %u ms\n", (unsigned int)Isim_GetTime(&test_sim));
+    }
+}
+
+/*! \brief An application message is looped back by the simulated INIC */
+static void Test_Loopback(uint16_t size)
+{
+    uint32_t start = Isim_GetTime(&test_sim);
+
+    Test_ResetCounters(size);
+    TEST_CHECK(Test_SendMsg(size) != false);
+
+    while ((test_rx_received == 0U) && ((Isim_GetTime(&test_sim) - start) < TEST_MSG_TIMEOUT))
+    {
+        (void)Isim_Run(&test_sim, test_ucs_ptr, 1U, NULL);
+        Test_DrainRx();
+    }
+
+    TEST_CHECK(test_tx_completed == 1U);
+    TEST_CHECK(test_tx_failed == 0U);
+    TEST_CHECK(test_rx_received == 1U);
+    TEST_CHECK(test_rx_mismatches == 0U);
+}
+
+/*! \brief A stream of application messages is transferred in both directions under flow control */
+static void Test_Throughput(void)
+{
+    uint32_t start = Isim_GetTime(&test_sim);
+    uint16_t sent = 0U;
+    Isim_Stats_t stats;
+
+    Test_ResetCounters(TEST_BENCH_SIZE);
+
+    while ((test_rx_received < TEST_BENCH_MSGS) && ((Isim_GetTime(&test_sim) - start) < (TEST_BENCH_MSGS * 10U)))
+    {
+        while ((sent < TEST_BENCH_MSGS) && (Test_SendMsg(TEST_BENCH_SIZE) != false))
+        {
+            sent++;
+        }
+
+        (void)Isim_Run(&test_sim, test_ucs_ptr, 1U, NULL);
+        Test_DrainRx();
+    }
+
+    Isim_GetStats(&test_sim, &stats);
+    TEST_CHECK(test_tx_completed == TEST_BENCH_MSGS);
+    TEST_CHECK(test_tx_failed == 0U);
+    TEST_CHECK(test_rx_received == TEST_BENCH_MSGS);
+    TEST_CHECK(test_rx_mismatches == 0U);
+    TEST_CHECK(stats.rx_dropped_msgs == 0U);
+    (void)printf("ucs_inic_sim_test: %u messages in %u ms, %u services, %u credit stalls, %u allocation stalls\n", 
+                 (unsigned int)TEST_BENCH_MSGS, (unsigned int)(Isim_GetTime(&test_sim) - start), 
+                 (unsigned int)stats.ucs_services, (unsigned int)stats.rx_credit_stalls, 
+                 (unsigned int)stats.rx_alloc_stalls);
+}
+
+/*! \brief Runs the Node Discovery service until the expected number of reports or the timeout */
+static void Test_RunNodeDiscovery(const uint8_t *count_ptr, uint8_t expected)
+{
+    uint32_t start = Isim_GetTime(&test_sim);
+
+    test_nd_stopped = false;
+    TEST_CHECK(Ucs_Nd_Start(test_ucs_ptr) == UCS_RET_SUCCESS);
+
+    while ((*count_ptr < expected) && ((Isim_GetTime(&test_sim) - start) < TEST_ND_TIMEOUT))
+    {
+        (void)Isim_Run(&test_sim, test_ucs_ptr, 1U, NULL);
+    }
+
+    (void)printf("ucs_inic_sim_test: node discovery reported %u nodes after %u ms\n", (unsigned int)*count_ptr,
+                 (unsigned int)(Isim_GetTime(&test_sim) - start));
+}
+
+/*! \brief Node Discovery welcomes all nodes, welcomed nodes remain silent until DeviceInit.Start */
+static void Test_NodeDiscovery(void)
+{
+    uint8_t i;
+
+    test_nd_known = 0U;
+    test_nd_welcomed = 0U;
+    test_nd_multi = 0U;
+    test_nd_others = 0U;
+
+    Test_RunNodeDiscovery(&test_nd_welcomed, TEST_NUM_NODES);
+    (void)Isim_Run(&test_sim, test_ucs_ptr, TEST_ND_PERIOD, NULL);     /* periodic Hello.Get is not answered */
+    TEST_CHECK(test_nd_welcomed == TEST_NUM_NODES);
+    TEST_CHECK(test_nd_multi == 0U);
+    TEST_CHECK(test_nd_others == 0U);
+
+    for (i = 0U; i < TEST_NUM_NODES; i++)
+    {
+        TEST_CHECK(Isim_IsNodeWelcomed(&test_sim, i) != false);
+    }
+
+    TEST_CHECK(Ucs_Nd_Stop(test_ucs_ptr) == UCS_RET_SUCCESS);
+    TEST_CHECK(Isim_Run(&test_sim, test_ucs_ptr, TEST_MSG_TIMEOUT, &test_nd_stopped) != false);
+
+    /* after DeviceInit.Start all nodes answer again, the known local INIC is checked by Signature.Get */
+    TEST_CHECK(Ucs_Nd_InitAll(test_ucs_ptr) == UCS_RET_SUCCESS);
+    (void)Isim_Run(&test_sim, test_ucs_ptr, 10U, NULL);
+    TEST_CHECK(Isim_IsNodeWelcomed(&test_sim, 0U) == false);
+    test_nd_known = 1U;
+    test_nd_welcomed = 0U;
+
+    Test_RunNodeDiscovery(&test_nd_welcomed, TEST_NUM_NODES - 1U);
+    TEST_CHECK(test_nd_welcomed == (TEST_NUM_NODES - 1U));
+    TEST_CHECK(test_nd_multi == 1U);
+    TEST_CHECK(test_nd_others == 0U);
+    TEST_CHECK(Ucs_Nd_Stop(test_ucs_ptr) == UCS_RET_SUCCESS);
+    TEST_CHECK(Isim_Run(&test_sim, test_ucs_ptr, TEST_MSG_TIMEOUT, &test_nd_stopped) != false);
+}
+
+/*! \brief Termination stops the low-level driver */
+static void Test_Stop(void)
+{
+    TEST_CHECK(Ucs_Stop(test_ucs_ptr, &Test_OnStopped) == UCS_RET_SUCCESS);
+    TEST_CHECK(Isim_Run(&test_sim, test_ucs_ptr, TEST_MSG_TIMEOUT, &test_stop_done) != false);
+    TEST_CHECK(test_stop_result.code == UCS_RES_SUCCESS);
+    TEST_CHECK(Isim_IsStarted(&test_sim) == false);
+}
+
+int main(void)
+{
+    int ret = 1;
+
+    Test_Init();
+
+    if (test_failures == 0U)
+    {
+        Isim_Stats_t stats;
+
+        Test_Loopback(TEST_BENCH_SIZE);
+#if (UCS_AMS_SIZE_TX_MSG >= TEST_SEGMENTED_SIZE) && (UCS_AMS_SIZE_RX_MSG >= TEST_SEGMENTED_SIZE)
+        Test_Loopback(TEST_SEGMENTED_SIZE);
+#endif
+        Test_Throughput();
+        Test_NodeDiscovery();
+        Test_Stop();
+
+        Isim_GetStats(&test_sim, &stats);
+        TEST_CHECK(stats.unknown_requests == 0U);
+        TEST_CHECK(stats.ucs_errors == 0U);
+    }
+
+    if (test_failures == 0U)
+    {
+        (void)printf("ucs_inic_sim_test: all test cases passed\n");
+        ret = 0;
+    }
+
+    return ret;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
+
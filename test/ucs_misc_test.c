@@ -0,0 +1,283 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Unit test of Misc_MemSet() and Misc_MemCpy() which compares their results with the
+ *          C library and measures their run time.
+ * \details The test is built on the host together with the miscellaneous functions. Build and
+ *          run it from the repository root for both variants of the functions:
+ *
+ *              gcc -std=c99 -Wall -O2 -Iinc -Icfg test/ucs_misc_test.c src/ucs_misc.c -o misc_test
+ *              ./misc_test
+ *
+ *          Add \c -DUCS_MEM_WORD_ACCESS to test the word-wide variant. Every size up to
+ *          \ref TEST_MAX_SIZE is checked at all combinations of source and destination
+ *          misalignment, including the bytes around the destination. The benchmark prints the
+ *          time per call for UNICENS and the C library. The program returns 0 if all test cases
+ *          pass, the benchmark results do not affect the return value.
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ucs_misc.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test environment                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+#define TEST_MAX_SIZE       300U
+#define TEST_MAX_OFFSET     8U
+#define TEST_GUARD_SIZE     16U
+#define TEST_BUF_SIZE       (TEST_GUARD_SIZE + TEST_MAX_OFFSET + TEST_MAX_SIZE + TEST_GUARD_SIZE)
+#define TEST_BENCH_BYTES    (16UL * 1024UL * 1024UL)
+#define TEST_BENCH_BUF_SIZE 1040U
+
+#define TEST_CHECK(cond)    Test_Check((cond), #cond, __LINE__)
+
+/*! \brief Buffers which are aligned like memory returned by malloc() */
+typedef union Test_Buffer_
+{
+    uint8_t     bytes[TEST_BUF_SIZE];
+    long double align_ld;
+    void       *align_ptr;
+
+} Test_Buffer_t;
+
+/*! \brief Benchmark buffers which are aligned like memory returned by malloc() */
+typedef union Test_BenchBuffer_
+{
+    uint8_t     bytes[TEST_BENCH_BUF_SIZE];
+    long double align_ld;
+    void       *align_ptr;
+
+} Test_BenchBuffer_t;
+
+/*! \brief Signature of Misc_MemCpy() and of the wrapper of memcpy() */
+typedef void (*Test_CopyFunc_t)(void *dst_ptr, void *src_ptr, uint32_t size);
+/*! \brief Signature of Misc_MemSet() and of the wrapper of memset() */
+typedef void (*Test_SetFunc_t)(void *dst_ptr, int32_t value, uint32_t size);
+
+static Test_Buffer_t        test_src;
+static Test_Buffer_t        test_dst;
+static Test_Buffer_t        test_ref;
+static Test_BenchBuffer_t   test_bench_src;
+static Test_BenchBuffer_t   test_bench_dst;
+static volatile uint8_t     test_sink;
+static uint32_t             test_failures;
+
+static void Test_Check(bool cond, const char *expr, int line)
+{
+    if (cond == false)
+    {
+        (void)printf("FAILED line %d: %s\n", line, expr);
+        test_failures++;
+    }
+}
+
+static uint8_t Test_Pattern(uint32_t index)
+{
+    return (uint8_t)((index * 13U) + 7U);
+}
+
+/*! \brief Fills destination and reference buffer with the same background pattern */
+static void Test_ResetDst(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BUF_SIZE; i++)
+    {
+        test_dst.bytes[i] = (uint8_t)(0xA5U ^ i);
+        test_ref.bytes[i] = (uint8_t)(0xA5U ^ i);
+    }
+}
+
+static void Test_LibMemCpy(void *dst_ptr, void *src_ptr, uint32_t size)
+{
+    (void)memcpy(dst_ptr, src_ptr, (size_t)size);
+}
+
+static void Test_LibMemSet(void *dst_ptr, int32_t value, uint32_t size)
+{
+    (void)memset(dst_ptr, (int)value, (size_t)size);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test cases                                                                                     */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Misc_MemCpy() matches memcpy() for all sizes and misalignments */
+static void Test_MemCpy(void)
+{
+    uint32_t mismatches = 0U;
+    uint32_t dst_off;
+    uint32_t src_off;
+    uint32_t size;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BUF_SIZE; i++)
+    {
+        test_src.bytes[i] = Test_Pattern(i);
+    }
+
+    for (dst_off = 0U; dst_off < TEST_MAX_OFFSET; dst_off++)
+    {
+        for (src_off = 0U; src_off < TEST_MAX_OFFSET; src_off++)
+        {
+            for (size = 0U; size <= TEST_MAX_SIZE; size++)
+            {
+                Test_ResetDst();
+                Misc_MemCpy(&test_dst.bytes[TEST_GUARD_SIZE + dst_off], &test_src.bytes[TEST_GUARD_SIZE + src_off], size);
+                (void)memcpy(&test_ref.bytes[TEST_GUARD_SIZE + dst_off], &test_src.bytes[TEST_GUARD_SIZE + src_off], (size_t)size);
+
+                if (memcmp(&test_dst.bytes[0], &test_ref.bytes[0], TEST_BUF_SIZE) != 0)
+                {
+                    if (mismatches == 0U)
+                    {
+                        (void)printf("Misc_MemCpy() differs: dst_off %u, src_off %u, size %u\n",
+                                     (unsigned int)dst_off, (unsigned int)src_off, (unsigned int)size);
+                    }
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    TEST_CHECK(mismatches == 0U);
+}
+
+/*! \brief Misc_MemSet() matches memset() for all sizes, misalignments and byte values */
+static void Test_MemSet(void)
+{
+    static const int32_t values[] = { 0x00, 0x5A, 0xFF, -1, 0x1234 };
+    uint32_t mismatches = 0U;
+    uint32_t dst_off;
+    uint32_t size;
+    uint32_t v;
+
+    for (v = 0U; v < (sizeof(values) / sizeof(values[0])); v++)
+    {
+        for (dst_off = 0U; dst_off < TEST_MAX_OFFSET; dst_off++)
+        {
+            for (size = 0U; size <= TEST_MAX_SIZE; size++)
+            {
+                Test_ResetDst();
+                Misc_MemSet(&test_dst.bytes[TEST_GUARD_SIZE + dst_off], values[v], size);
+                (void)memset(&test_ref.bytes[TEST_GUARD_SIZE + dst_off], (int)values[v], (size_t)size);
+
+                if (memcmp(&test_dst.bytes[0], &test_ref.bytes[0], TEST_BUF_SIZE) != 0)
+                {
+                    if (mismatches == 0U)
+                    {
+                        (void)printf("Misc_MemSet() differs: value 0x%X, dst_off %u, size %u\n",
+                                     (unsigned int)values[v], (unsigned int)dst_off, (unsigned int)size);
+                    }
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    TEST_CHECK(mismatches == 0U);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Benchmark                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Returns the time per call in nanoseconds of a copy function */
+static double Test_BenchCopy(Test_CopyFunc_t func_fptr, uint32_t dst_off, uint32_t src_off, uint32_t size)
+{
+    uint32_t loops = (uint32_t)(TEST_BENCH_BYTES / size);
+    clock_t start = clock();
+    uint32_t i;
+
+    for (i = 0U; i < loops; i++)
+    {
+        func_fptr(&test_bench_dst.bytes[dst_off], &test_bench_src.bytes[src_off], size);
+        test_sink = test_bench_dst.bytes[dst_off + (i % size)];
+    }
+
+    return ((double)(clock() - start) * 1.0e9) / ((double)CLOCKS_PER_SEC * (double)loops);
+}
+
+/*! \brief Returns the time per call in nanoseconds of a set function */
+static double Test_BenchSet(Test_SetFunc_t func_fptr, uint32_t dst_off, uint32_t size)
+{
+    uint32_t loops = (uint32_t)(TEST_BENCH_BYTES / size);
+    clock_t start = clock();
+    uint32_t i;
+
+    for (i = 0U; i < loops; i++)
+    {
+        func_fptr(&test_bench_dst.bytes[dst_off], (int32_t)i, size);
+        test_sink = test_bench_dst.bytes[dst_off + (i % size)];
+    }
+
+    return ((double)(clock() - start) * 1.0e9) / ((double)CLOCKS_PER_SEC * (double)loops);
+}
+
+/*! \brief Prints the time per call of UNICENS and the C library for typical message sizes */
+static void Test_Benchmark(void)
+{
+    static const uint32_t sizes[] = { 8U, 16U, 45U, 64U, 256U, 1024U };
+    uint32_t s;
+
+    (void)printf("ucs_misc_test: ns per call    Misc_MemCpy   memcpy  (unaligned)  Misc_MemSet   memset\n");
+
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        (void)printf("ucs_misc_test: %4u bytes   %10.1f %8.1f  %5.1f %6.1f  %10.1f %8.1f\n", (unsigned int)sizes[s],
+                     Test_BenchCopy(&Misc_MemCpy, 0U, 0U, sizes[s]), Test_BenchCopy(&Test_LibMemCpy, 0U, 0U, sizes[s]),
+                     Test_BenchCopy(&Misc_MemCpy, 1U, 2U, sizes[s]), Test_BenchCopy(&Test_LibMemCpy, 1U, 2U, sizes[s]),
+                     Test_BenchSet(&Misc_MemSet, 0U, sizes[s]), Test_BenchSet(&Test_LibMemSet, 0U, sizes[s]));
+    }
+}
+
+int main(void)
+{
+    int ret = 1;
+
+    Test_MemCpy();
+    Test_MemSet();
+    Test_Benchmark();
+
+    if (test_failures == 0U)
+    {
+        (void)printf("ucs_misc_test: all test cases passed\n");
+        ret = 0;
+    }
+
+    return ret;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,347 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Unit test of the slab memory manager which allocates every size class until it is
+ *          exhausted and compares the message capacity with the static memory manager.
+ * \details The test is built on the host together with all UNICENS sources. Build and run it
+ *          from the repository root:
+ *
+ *              gcc -std=c99 -Wall -Iinc -Icfg test/ucs_slab_test.c src/\*.c -o slab_test
+ *              ./slab_test
+ *
+ *          The capacity test prints the number of Rx and Tx messages with single telegram
+ *          payload which fit into an arena of the size of the static memory manager. The
+ *          program returns 0 if all test cases pass.
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "ucs_slab.h"
+#include "ucs_smm.h"
+#include "ucs_amsmessage.h"
+#include "ucs_misc.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test environment                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+#define TEST_ARENA_SIZE     32768U
+#define TEST_MAX_BLOCKS     1024U
+#define TEST_MAX_MSGS       512U
+#define TEST_PAYLOAD_SIZE   45U
+
+#define TEST_CHECK(cond)    Test_Check((cond), #cond, __LINE__)
+
+/*! \brief Arena which is aligned like memory returned by malloc() and which is at least as
+ *         large as the static memory manager
+ */
+typedef union Test_Arena_
+{
+    uint8_t     bytes[TEST_ARENA_SIZE];
+    CStaticMemoryManager smm;
+    long double align_ld;
+    void       *align_ptr;
+
+} Test_Arena_t;
+
+/*! \brief Rx and Tx messages which are allocated by the capacity test */
+typedef struct Test_Msgs_
+{
+    void    *mem_ptrs[TEST_MAX_MSGS * 2U];
+    void    *info_ptrs[TEST_MAX_MSGS * 2U];
+    Ams_MemUsage_t types[TEST_MAX_MSGS * 2U];
+    uint16_t num_mem;
+    uint16_t num_rx;
+    uint16_t num_tx;
+
+} Test_Msgs_t;
+
+static Test_Arena_t         test_arena;
+static CSlabMemoryManager   test_slab;
+static CStaticMemoryManager test_smm;
+static Ams_MemAllocator_t   test_allocator;
+static void                *test_blocks[TEST_MAX_BLOCKS];
+static void                *test_infos[TEST_MAX_BLOCKS];
+static Test_Msgs_t          test_msgs;
+static uint32_t             test_failures;
+
+static void Test_Check(bool cond, const char *expr, int line)
+{
+    if (cond == false)
+    {
+        (void)printf("FAILED line %d: %s\n", line, expr);
+        test_failures++;
+    }
+}
+
+/*! \brief Returns the number of blocks which are not yet carved from the partition of a size class */
+static uint32_t Test_ClassCapacity(uint8_t index)
+{
+    return test_slab.classes[index].area_remaining / (uint32_t)test_slab.classes[index].block_size;
+}
+
+/*! \brief Allocates memory and its custom information, returns false if the allocator fails */
+static bool Test_Alloc(uint16_t mem_size, Ams_MemUsage_t type, void **mem_pptr, void **info_pptr)
+{
+    *info_pptr = NULL;
+    *mem_pptr = test_allocator.alloc_fptr(test_allocator.inst_ptr, mem_size, type, info_pptr);
+
+    return (*mem_pptr != NULL);
+}
+
+/*! \brief Allocates an object and its payload, the object is freed again if no payload is available */
+static bool Test_AllocMsg(Ams_MemUsage_t obj_type, uint16_t obj_size, Ams_MemUsage_t payload_type)
+{
+    bool ret = false;
+    uint16_t n = test_msgs.num_mem;
+
+    if (Test_Alloc(obj_size, obj_type, &test_msgs.mem_ptrs[n], &test_msgs.info_ptrs[n]) != false)
+    {
+        if (Test_Alloc(TEST_PAYLOAD_SIZE, payload_type, &test_msgs.mem_ptrs[n + 1U], &test_msgs.info_ptrs[n + 1U]) != false)
+        {
+            test_msgs.types[n] = obj_type;
+            test_msgs.types[n + 1U] = payload_type;
+            test_msgs.num_mem += 2U;
+            ret = true;
+        }
+        else
+        {
+            test_allocator.free_fptr(test_allocator.inst_ptr, test_msgs.mem_ptrs[n], obj_type, test_msgs.info_ptrs[n]);
+        }
+    }
+
+    return ret;
+}
+
+/*! \brief Allocates Rx and/or Tx messages with single telegram payload until the allocator fails */
+static void Test_FillMsgs(bool rx, bool tx)
+{
+    bool rx_full = (rx == false);
+    bool tx_full = (tx == false);
+
+    test_msgs.num_mem = 0U;
+    test_msgs.num_rx = 0U;
+    test_msgs.num_tx = 0U;
+
+    while (((rx_full == false) || (tx_full == false)) && (test_msgs.num_mem < ((TEST_MAX_MSGS * 2U) - 4U)))
+    {
+        if (tx_full == false)
+        {
+            tx_full = (Test_AllocMsg(AMS_MU_TX_OBJECT, (uint16_t)AMSG_TX_OBJECT_SZ, AMS_MU_TX_PAYLOAD) == false);
+            if (tx_full == false)
+            {
+                test_msgs.num_tx++;
+            }
+        }
+
+        if (rx_full == false)
+        {
+            rx_full = (Test_AllocMsg(AMS_MU_RX_OBJECT, (uint16_t)AMSG_RX_OBJECT_SZ, AMS_MU_RX_PAYLOAD) == false);
+            if (rx_full == false)
+            {
+                test_msgs.num_rx++;
+            }
+        }
+    }
+}
+
+/*! \brief Frees all messages of Test_FillMsgs() */
+static void Test_FreeMsgs(void)
+{
+    uint16_t i;
+
+    for (i = 0U; i < test_msgs.num_mem; i++)
+    {
+        test_allocator.free_fptr(test_allocator.inst_ptr, test_msgs.mem_ptrs[i], test_msgs.types[i], test_msgs.info_ptrs[i]);
+    }
+
+    test_msgs.num_mem = 0U;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test cases                                                                                     */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Allocates blocks of one size class until the arena is exhausted. The size class and
+ *         all larger size classes are used up, blocks do not overlap and are reused after free.
+ */
+static void Test_ClassExhaustion(uint8_t index)
+{
+    uint32_t own_capacity;
+    uint32_t lender_capacity = 0U;
+    uint32_t own = 0U;
+    uint32_t num = 0U;
+    uint32_t i;
+    uint16_t block_size;
+    uint8_t c;
+
+    Slab_Ctor(&test_slab, &test_arena, TEST_ARENA_SIZE, NULL);
+    TEST_CHECK(Slab_LoadPlugin(&test_slab, &test_allocator, (uint16_t)UCS_AMS_SIZE_RX_MSG) == UCS_RET_SUCCESS);
+    block_size = test_slab.classes[index].block_size;
+    own_capacity = Test_ClassCapacity(index);
+
+    for (c = 0U; c < SLAB_NUM_CLASSES; c++)
+    {
+        if ((c != index) && (test_slab.classes[c].block_size >= block_size))
+        {
+            lender_capacity += Test_ClassCapacity(c);
+        }
+    }
+
+    while ((num < TEST_MAX_BLOCKS) && (Test_Alloc(block_size, AMS_MU_TX_PAYLOAD, &test_blocks[num], &test_infos[num]) != false))
+    {
+        TEST_CHECK(((uintptr_t)test_blocks[num] % 16U) == 0U);
+        TEST_CHECK((uint8_t*)test_blocks[num] >= &test_arena.bytes[0]);
+        TEST_CHECK(&((uint8_t*)test_blocks[num])[block_size] <= &test_arena.bytes[TEST_ARENA_SIZE]);
+        MISC_MEM_SET(test_blocks[num], (int32_t)(num & 0xFFU), (size_t)block_size);
+
+        if (test_infos[num] == &test_slab.classes[index])
+        {
+            own++;
+        }
+        num++;
+    }
+
+    for (i = 0U; i < num; i++)                      /* overlapping blocks overwrite each other */
+    {
+        TEST_CHECK(((uint8_t*)test_blocks[i])[0] == (uint8_t)(i & 0xFFU));
+        TEST_CHECK(((uint8_t*)test_blocks[i])[block_size - 1U] == (uint8_t)(i & 0xFFU));
+    }
+
+    TEST_CHECK(own_capacity > 0U);
+    TEST_CHECK(own == own_capacity);
+    TEST_CHECK(num == (own_capacity + lender_capacity));
+    (void)printf("ucs_slab_test: class %u of %u bytes: %u own blocks, %u borrowed blocks\n", (unsigned int)index,
+                 (unsigned int)block_size, (unsigned int)own, (unsigned int)(num - own));
+
+    for (i = 0U; i < num; i++)
+    {
+        test_allocator.free_fptr(test_allocator.inst_ptr, test_blocks[i], AMS_MU_TX_PAYLOAD, test_infos[i]);
+    }
+
+    for (i = 0U; (i < num) && (Test_Alloc(block_size, AMS_MU_TX_PAYLOAD, &test_blocks[i], &test_infos[i]) != false); i++)
+    {
+    }
+
+    TEST_CHECK(i == num);                           /* freed blocks are reused */
+    TEST_CHECK(Test_Alloc(block_size, AMS_MU_TX_PAYLOAD, &test_blocks[0], &test_infos[0]) == false);
+}
+
+/*! \brief Memory which is larger than the largest size class cannot be allocated */
+static void Test_TooLarge(void)
+{
+    void *mem_ptr;
+    void *info_ptr;
+
+    Slab_Ctor(&test_slab, &test_arena, TEST_ARENA_SIZE, NULL);
+    TEST_CHECK(Slab_LoadPlugin(&test_slab, &test_allocator, (uint16_t)UCS_AMS_SIZE_RX_MSG) == UCS_RET_SUCCESS);
+    TEST_CHECK(Test_Alloc((uint16_t)(test_slab.classes[SLAB_NUM_CLASSES - 1U].block_size + 1U), AMS_MU_RX_PAYLOAD,
+                          &mem_ptr, &info_ptr) == false);
+}
+
+/*! \brief An arena which cannot hold one Rx and one Tx message is rejected */
+static void Test_ArenaTooSmall(void)
+{
+    Slab_Ctor(&test_slab, &test_arena, (uint32_t)(AMSG_RX_OBJECT_SZ + AMSG_TX_OBJECT_SZ), NULL);
+    TEST_CHECK(Slab_LoadPlugin(&test_slab, &test_allocator, (uint16_t)UCS_AMS_SIZE_RX_MSG) == UCS_RET_ERR_PARAM);
+}
+
+/*! \brief Compares the number of messages in flight with the static memory manager, whose
+ *         memory is used as arena size
+ */
+static void Test_MsgCapacity(void)
+{
+    uint16_t smm_rx;
+    uint16_t smm_tx;
+    uint16_t slab_rx;
+    uint16_t slab_tx;
+    uint16_t slab_rx_only;
+    uint16_t slab_tx_only;
+    uint32_t arena_size = (uint32_t)sizeof(CStaticMemoryManager);
+
+    Smm_Ctor(&test_smm, NULL);
+    TEST_CHECK(Smm_LoadPlugin(&test_smm, &test_allocator, (uint16_t)UCS_AMS_SIZE_RX_MSG) == UCS_RET_SUCCESS);
+    Test_FillMsgs(true, true);
+    smm_rx = test_msgs.num_rx;
+    smm_tx = test_msgs.num_tx;
+    Test_FreeMsgs();
+    TEST_CHECK(smm_rx == (uint16_t)SMM_NUM_RX_MSGS);
+    TEST_CHECK(smm_tx == (uint16_t)SMM_NUM_TX_MSGS);
+
+    Slab_Ctor(&test_slab, &test_arena, arena_size, NULL);
+    TEST_CHECK(Slab_LoadPlugin(&test_slab, &test_allocator, (uint16_t)UCS_AMS_SIZE_RX_MSG) == UCS_RET_SUCCESS);
+    Test_FillMsgs(true, true);
+    slab_rx = test_msgs.num_rx;
+    slab_tx = test_msgs.num_tx;
+    Test_FreeMsgs();
+    Test_FillMsgs(true, false);
+    slab_rx_only = test_msgs.num_rx;
+    Test_FreeMsgs();
+    Test_FillMsgs(false, true);
+    slab_tx_only = test_msgs.num_tx;
+    Test_FreeMsgs();
+
+    (void)printf("ucs_slab_test: %u bytes, static: %u Rx + %u Tx, slab: %u Rx + %u Tx, %u Rx only, %u Tx only\n",
+                 (unsigned int)arena_size, (unsigned int)smm_rx, (unsigned int)smm_tx, (unsigned int)slab_rx,
+                 (unsigned int)slab_tx, (unsigned int)slab_rx_only, (unsigned int)slab_tx_only);
+    TEST_CHECK(slab_rx_only > smm_rx);
+    TEST_CHECK(slab_tx_only > smm_tx);
+#if (UCS_AMS_SIZE_RX_MSG == 45) && (UCS_AMS_SIZE_TX_MSG == 45)  /* large payload blocks take the pairs' memory otherwise */
+    TEST_CHECK((slab_rx + slab_tx) >= (smm_rx + smm_tx));
+#endif
+}
+
+int main(void)
+{
+    int ret = 1;
+    uint8_t index;
+
+    for (index = 0U; index < SLAB_NUM_CLASSES; index++)
+    {
+        Test_ClassExhaustion(index);
+    }
+
+    Test_TooLarge();
+    Test_ArenaTooSmall();
+    Test_MsgCapacity();
+
+    if (test_failures == 0U)
+    {
+        (void)printf("ucs_slab_test: all test cases passed\n");
+        ret = 0;
+    }
+
+    return ret;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/
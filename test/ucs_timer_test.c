@@ -0,0 +1,466 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS V2.1.0-3564                                                                            */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+
+/*!
+ * \file
+ * \brief   Unit test of the timer management which drives a virtual clock across the wrap point 
+ *          of the tick count and of the timer wheel.
+ * \details The test is built on the host together with the timer management and its dependencies.
+ *          Build and run it from the repository root for each tick count variant:
+ *
+ *              gcc -std=c99 -Wall -Iinc -Icfg test/ucs_timer_test.c src/ucs_timer.c \
+ *                  src/ucs_scheduler.c src/ucs_obs.c src/ucs_dl.c src/ucs_misc.c -o tm_test
+ *              ./tm_test
+ *
+ *          Add \c -DUCS_TICK_COUNT_32BIT to test the 32 bit tick count and \c -DUCS_FOOTPRINT_TINY 
+ *          to test the timer list instead of the timer wheel. The program returns 0 if all test 
+ *          cases pass.
+ */
+
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "ucs_timer.h"
+#include "ucs_scheduler.h"
+#include "ucs_obs.h"
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test environment                                                                               */
+/*------------------------------------------------------------------------------------------------*/
+#define TEST_MAX_EXPIRIES   64U
+#define TEST_MAX_LOOPS      10000U
+
+#define TEST_CHECK(cond)    Test_Check((cond), #cond, __LINE__)
+
+/*! \brief Expiry record of a test timer */
+typedef struct Test_Expiry_
+{
+    uint8_t     id;
+    Tm_Tick_t   time;
+
+} Test_Expiry_t;
+
+/*! \brief Test timer which records its expiry times */
+typedef struct Test_Timer_
+{
+    CTimer      timer;
+    uint8_t     id;
+
+} Test_Timer_t;
+
+static CScheduler           test_scd;
+static CTimerManagement     test_tm;
+static CSingleObserver      test_service_request_obs;
+static CSingleObserver      test_get_tick_count_obs;
+static CSingleObserver      test_set_app_timer_obs;
+
+static Tm_Tick_t            test_clock;             /* virtual tick count */
+static Tm_Tick_t            test_app_timeout;       /* latest value passed to the application timer */
+static bool                 test_app_timer_running;
+static Test_Expiry_t        test_expiries[TEST_MAX_EXPIRIES];
+static uint8_t              test_expiry_cnt;
+static uint32_t             test_failures;
+static Test_Timer_t         test_chained_timer;     /* timer which is started by a timer handler */
+
+static void Test_Check(bool cond, const char *expr, int line)
+{
+    if (cond == false)
+    {
+        (void)printf("FAILED line %d: %s\n", line, expr);
+        test_failures++;
+    }
+}
+
+static void Test_OnServiceRequest(void *self, void *data_ptr)
+{
+    (void)self;
+    (void)data_ptr;
+}
+
+static void Test_OnGetTickCount(void *self, void *data_ptr)
+{
+    (void)self;
+    *((Tm_Tick_t *)data_ptr) = test_clock;
+}
+
+static void Test_OnSetAppTimer(void *self, void *data_ptr)
+{
+    (void)self;
+    test_app_timeout = *((Tm_Tick_t *)data_ptr);
+    test_app_timer_running = (test_app_timeout != 0U);
+}
+
+static void Test_OnTimer(void *args_ptr)
+{
+    Test_Timer_t *timer_ptr = (Test_Timer_t *)args_ptr;
+
+    if (test_expiry_cnt < TEST_MAX_EXPIRIES)
+    {
+        test_expiries[test_expiry_cnt].id = timer_ptr->id;
+        test_expiries[test_expiry_cnt].time = test_clock;
+    }
+    test_expiry_cnt++;
+}
+
+static void Test_OnChainTimer(void *args_ptr)
+{
+    Test_OnTimer(args_ptr);
+    T_Ctor(&test_chained_timer.timer);
+    test_chained_timer.id = 2U;
+    Tm_SetTimerEx(&test_tm, &test_chained_timer.timer, &Test_OnTimer, &test_chained_timer, 0U, 0U, 0U);
+}
+
+static void Test_OnStopTimer(void *args_ptr)
+{
+    Test_OnTimer(args_ptr);
+    Tm_StopService(&test_tm);                       /* as done on a general error */
+}
+
+/*! \brief  Sets up the timer management with the virtual clock
+ *  \param  start_tick      Initial tick count of the virtual clock
+ *  \param  wheel_offset    Initial time of the timer wheel. It is ignored by the timer list.
+ */
+static void Test_Setup(Tm_Tick_t start_tick, uint32_t wheel_offset)
+{
+    Scd_InitData_t scd_init;
+    Tm_InitData_t tm_init;
+
+    test_clock = start_tick;
+    test_app_timeout = 0U;
+    test_app_timer_running = false;
+    test_expiry_cnt = 0U;
+
+    Sobs_Ctor(&test_service_request_obs, NULL, &Test_OnServiceRequest);
+    Sobs_Ctor(&test_get_tick_count_obs, NULL, &Test_OnGetTickCount);
+    Sobs_Ctor(&test_set_app_timer_obs, NULL, &Test_OnSetAppTimer);
+    scd_init.service_request_obs_ptr = &test_service_request_obs;
+    tm_init.get_tick_count_obs_ptr = &test_get_tick_count_obs;
+    tm_init.set_application_timer_obs_ptr = &test_set_app_timer_obs;
+
+    Scd_Ctor(&test_scd, &scd_init, NULL);
+    Tm_Ctor(&test_tm, &test_scd, &tm_init, NULL);
+    test_tm.last_tick_count = start_tick;
+#ifndef TM_FOOTPRINT_TINY
+    test_tm.current_time = wheel_offset;
+#else
+    (void)wheel_offset;
+#endif
+}
+
+static void Test_StartTimer(Test_Timer_t *timer_ptr, uint8_t id, Tm_Tick_t elapse, Tm_Tick_t period, Tm_Tick_t slack)
+{
+    T_Ctor(&timer_ptr->timer);
+    timer_ptr->id = id;
+    Tm_SetTimerEx(&test_tm, &timer_ptr->timer, &Test_OnTimer, timer_ptr, elapse, period, slack);
+}
+
+/*! \brief Runs the UNICENS service loop once, as done by the application */
+static void Test_Service(void)
+{
+    Scd_Service(&test_scd);
+    Tm_CheckForNextService(&test_tm);
+}
+
+/*! \brief  Sleeps on the application timer and advances the virtual clock to each requested 
+ *          timeout, until the given number of expiries is reached.
+ *  \param  expiries    Number of expected timer expiries
+ */
+static void Test_RunOnAppTimer(uint8_t expiries)
+{
+    uint32_t loops = 0U;
+
+    Test_Service();
+    while ((test_expiry_cnt < expiries) && (test_app_timer_running != false) && (loops < TEST_MAX_LOOPS))
+    {
+        test_clock = (Tm_Tick_t)(test_clock + test_app_timeout);
+        test_app_timer_running = false;
+        Tm_TriggerService(&test_tm);                /* as done by Ucs_ReportTimeout() */
+        Test_Service();
+        loops++;
+    }
+}
+
+/*! \brief  Advances the virtual clock in steps of one millisecond and services UNICENS on each step
+ *  \param  ticks   Number of milliseconds
+ */
+static void Test_RunStepwise(uint32_t ticks)
+{
+    uint32_t i;
+
+    Test_Service();
+    for (i = 0U; i < ticks; i++)
+    {
+        test_clock++;
+        Tm_TriggerService(&test_tm);
+        Test_Service();
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* Test cases                                                                                     */
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief Single-shot timers which expire before, at and after the wrap point of the tick count */
+static void Test_SingleShotAcrossWrap(uint32_t wheel_offset)
+{
+    Test_Timer_t t1, t2, t3;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 49U);
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 30U, 0U, 0U);          /* expires before the wrap point */
+    Test_StartTimer(&t2, 2U, 50U, 0U, 0U);          /* expires at tick count 0 */
+    Test_StartTimer(&t3, 3U, 1000U, 0U, 0U);        /* expires after the wrap point */
+    Test_RunOnAppTimer(3U);
+
+    TEST_CHECK(test_expiry_cnt == 3U);
+    TEST_CHECK((test_expiries[0].id == 1U) && (test_expiries[0].time == (Tm_Tick_t)(start + 30U)));
+    TEST_CHECK((test_expiries[1].id == 2U) && (test_expiries[1].time == 0U));
+    TEST_CHECK((test_expiries[2].id == 3U) && (test_expiries[2].time == (Tm_Tick_t)(start + 1000U)));
+    TEST_CHECK(T_IsTimerInUse(&t3.timer) == false);
+}
+
+/*! \brief A periodic timer which is serviced every millisecond while the tick count wraps */
+static void Test_PeriodicAcrossWrap(uint32_t wheel_offset)
+{
+    Test_Timer_t t1;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 19U);
+    uint8_t i;
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 7U, 7U, 0U);
+    Test_RunStepwise(100U);
+
+    TEST_CHECK(test_expiry_cnt == 14U);
+    for (i = 0U; (i < test_expiry_cnt) && (i < TEST_MAX_EXPIRIES); i++)
+    {
+        TEST_CHECK(test_expiries[i].time == (Tm_Tick_t)(start + (7U * (i + 1U))));
+    }
+    Tm_ClearTimer(&test_tm, &t1.timer);
+    TEST_CHECK(T_IsTimerInUse(&t1.timer) == false);
+}
+
+/*! \brief Timers with overlapping slack are handled within one wakeup across the wrap point */
+static void Test_SlackAcrossWrap(uint32_t wheel_offset)
+{
+    Test_Timer_t t1, t2;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 99U);
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 80U, 0U, 60U);         /* window 80..140 spans the wrap point */
+    Test_StartTimer(&t2, 2U, 120U, 0U, 0U);
+    Test_RunOnAppTimer(2U);
+
+    TEST_CHECK(test_expiry_cnt == 2U);
+    TEST_CHECK((test_expiries[0].id == 1U) && (test_expiries[0].time == (Tm_Tick_t)(start + 120U)));
+    TEST_CHECK((test_expiries[1].id == 2U) && (test_expiries[1].time == (Tm_Tick_t)(start + 120U)));
+    TEST_CHECK(Tm_GetSavedWakeups(&test_tm) == 1U);
+}
+
+/*! \brief A periodic timer with slack keeps its nominal period if it is serviced at the end of
+ *         each window
+ */
+static void Test_PeriodicSlack(uint32_t wheel_offset)
+{
+    Test_Timer_t t1;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 99U);
+    uint8_t i;
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 50U, 50U, 20U);
+    Test_RunOnAppTimer(5U);
+
+    TEST_CHECK(test_expiry_cnt == 5U);
+    for (i = 0U; (i < test_expiry_cnt) && (i < TEST_MAX_EXPIRIES); i++)
+    {
+        TEST_CHECK(test_expiries[i].time == (Tm_Tick_t)(start + (50U * (i + 1U)) + 20U));
+    }
+
+    test_clock = (Tm_Tick_t)(test_clock + 170U);    /* service is delayed beyond two periods */
+    Tm_TriggerService(&test_tm);
+    Test_Service();
+    Test_RunOnAppTimer(7U);
+    TEST_CHECK(test_expiry_cnt == 7U);
+    TEST_CHECK(test_expiries[5].time == (Tm_Tick_t)(start + 440U));
+    TEST_CHECK(test_expiries[6].time == (Tm_Tick_t)(start + 470U));
+    Tm_ClearTimer(&test_tm, &t1.timer);
+}
+
+/*! \brief Timers are released by Tm_StopService() and can be cleared and started again */
+static void Test_StopService(uint32_t wheel_offset)
+{
+    Test_Timer_t t1, t2;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 20U);
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 10U, 0U, 0U);
+    Test_StartTimer(&t2, 2U, 5U, 5U, 0U);
+    Tm_StopService(&test_tm);
+
+    TEST_CHECK(T_IsTimerInUse(&t1.timer) == false);
+    TEST_CHECK(T_IsTimerInUse(&t2.timer) == false);
+    Tm_ClearTimer(&test_tm, &t1.timer);
+    Tm_ClearTimer(&test_tm, &t2.timer);
+
+    Test_StartTimer(&t1, 1U, 30U, 0U, 0U);
+    Test_RunStepwise(100U);
+    TEST_CHECK(test_expiry_cnt == 1U);
+    TEST_CHECK((test_expiries[0].id == 1U) && (test_expiries[0].time == (Tm_Tick_t)(start + 30U)));
+    TEST_CHECK(T_IsTimerInUse(&t1.timer) == false);
+}
+
+/*! \brief Tm_StopService() within a timer handler neither reloads the periodic timer nor 
+ *         invokes the handlers of other expired timers
+ */
+static void Test_StopServiceInHandler(uint32_t wheel_offset)
+{
+    Test_Timer_t t1, t2;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 20U);
+
+    Test_Setup(start, wheel_offset);
+    T_Ctor(&t1.timer);
+    t1.id = 1U;
+    Tm_SetTimerEx(&test_tm, &t1.timer, &Test_OnStopTimer, &t1, 10U, 10U, 0U);
+    Test_StartTimer(&t2, 2U, 10U, 10U, 0U);
+    Test_RunStepwise(50U);
+
+    TEST_CHECK(test_expiry_cnt == 1U);
+    TEST_CHECK((test_expiries[0].id == 1U) && (test_expiries[0].time == (Tm_Tick_t)(start + 10U)));
+    TEST_CHECK(T_IsTimerInUse(&t1.timer) == false);
+    TEST_CHECK(T_IsTimerInUse(&t2.timer) == false);
+    Tm_ClearTimer(&test_tm, &t2.timer);
+
+    Test_StartTimer(&t2, 2U, 5U, 0U, 0U);
+    Test_RunStepwise(10U);
+    TEST_CHECK(test_expiry_cnt == 2U);
+    TEST_CHECK(test_expiries[1].id == 2U);
+}
+
+/*! \brief A timer which is started without elapse time within a timer handler expires within
+ *         the same TM service run
+ */
+static void Test_DueTimerInHandler(uint32_t wheel_offset)
+{
+    Test_Timer_t t1, t3;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 9U);
+
+    Test_Setup(start, wheel_offset);
+    T_Ctor(&t1.timer);
+    t1.id = 1U;
+    Tm_SetTimerEx(&test_tm, &t1.timer, &Test_OnChainTimer, &t1, 10U, 0U, 0U);
+    Test_StartTimer(&t3, 3U, 200U, 0U, 0U);         /* keeps the wheel running */
+    Test_RunOnAppTimer(2U);
+
+    TEST_CHECK(test_expiry_cnt == 2U);
+    TEST_CHECK((test_expiries[0].id == 1U) && (test_expiries[0].time == (Tm_Tick_t)(start + 10U)));
+    TEST_CHECK((test_expiries[1].id == 2U) && (test_expiries[1].time == (Tm_Tick_t)(start + 10U)));
+    TEST_CHECK(T_IsTimerInUse(&test_chained_timer.timer) == false);
+    TEST_CHECK(test_app_timeout == 190U);
+
+    Test_RunOnAppTimer(3U);
+    TEST_CHECK((test_expiry_cnt == 3U) && (test_expiries[2].time == (Tm_Tick_t)(start + 200U)));
+}
+
+#ifdef UCS_TICK_COUNT_32BIT
+/*! \brief A timer beyond the 16 bit range is served by a single application timer period */
+static void Test_LongSleep(uint32_t wheel_offset)
+{
+    Test_Timer_t t1;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 1000U);
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 100000U, 0U, 0U);
+    Test_Service();
+
+    TEST_CHECK(test_app_timer_running != false);
+    TEST_CHECK(test_app_timeout == 100000U);
+    Test_RunOnAppTimer(1U);
+    TEST_CHECK(test_expiry_cnt == 1U);
+    TEST_CHECK(test_expiries[0].time == (Tm_Tick_t)(start + 100000U));
+}
+
+/*! \brief Elapse and slack values beyond the signed compare range are limited instead of 
+ *         being handled as overdue
+ */
+static void Test_TimeoutLimit(uint32_t wheel_offset)
+{
+    Test_Timer_t t1;
+    Tm_Tick_t start = (Tm_Tick_t)(TM_TICK_MAX - 1000U);
+
+    Test_Setup(start, wheel_offset);
+    Test_StartTimer(&t1, 1U, 0x80000000U, 0U, 0xF0000000U);
+    Test_RunStepwise(10U);
+
+    TEST_CHECK(test_expiry_cnt == 0U);
+    TEST_CHECK(T_IsTimerInUse(&t1.timer) != false);
+    TEST_CHECK(test_app_timer_running != false);
+    TEST_CHECK(test_app_timeout > (TM_TIMEOUT_MAX - 10U));
+
+    Test_RunOnAppTimer(1U);
+    TEST_CHECK(test_expiry_cnt == 1U);
+    TEST_CHECK((test_expiries[0].time - (Tm_Tick_t)(start + TM_TIMEOUT_MAX)) <= TM_TIMEOUT_MAX);
+}
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+/* Main                                                                                           */
+/*------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    int ret = 1;
+    /* The timer wheel starts at 0 and shortly before its own wrap point */
+    static const uint32_t wheel_offsets[] = { 0U, 0xFFFFFF00U };
+    uint8_t i;
+
+    for (i = 0U; i < (uint8_t)(sizeof(wheel_offsets) / sizeof(wheel_offsets[0])); i++)
+    {
+        Test_SingleShotAcrossWrap(wheel_offsets[i]);
+        Test_PeriodicAcrossWrap(wheel_offsets[i]);
+        Test_SlackAcrossWrap(wheel_offsets[i]);
+        Test_PeriodicSlack(wheel_offsets[i]);
+        Test_StopService(wheel_offsets[i]);
+        Test_StopServiceInHandler(wheel_offsets[i]);
+        Test_DueTimerInHandler(wheel_offsets[i]);
+#ifdef UCS_TICK_COUNT_32BIT
+        Test_LongSleep(wheel_offsets[i]);
+        Test_TimeoutLimit(wheel_offsets[i]);
+#endif
+    }
+
+    if (test_failures == 0U)
+    {
+        (void)printf("ucs_timer_test: all test cases passed\n");
+        ret = 0;
+    }
+
+    return ret;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/* End of file                                                                                    */
+/*------------------------------------------------------------------------------------------------*/